@@ -17,6 +17,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include "spline_cubico.h"
+#include "remuestreo_spline.h"
 
 /* ============================================================================
    CONFIGURACIÓN DE LA FUNCIÓN A ANALIZAR
@@ -26,17 +28,18 @@
    ============================================================================ */
 
 #define FUNCION_DESCRIPCION "f(x) = e^(2·sin(x)) · [1 + ln(x)]"
+#define FILAS_EN_PANTALLA 40    /* Tablas más largas se muestran resumidas */
 
 /* ============================================================================
    PROTOTIPOS DE FUNCIONES
    ============================================================================ */
 
 double f_exacta(double x);
-void construirSistemaSplines(double *x, double *y, int n, double *A, double *b_vec);
-void eliminacionGaussiana(double *A, double *b_vec, double *solution, int n);
-double evaluarSpline(double x_eval, double *x, double *y, double *M, int n);
 void generarTablaEquiespaciada(double *x_orig, double *y_orig, int n_orig, 
-                               double **x_equi, double **y_equi, int *n_equi, double h_objetivo);
+                               double **x_equi, double **y_equi, int *n_equi, double h_objetivo,
+                               const CondicionFrontera *frontera, PoolHilos *pool);
+void calcularErrores(const double *x, const double *y, int n,
+                     double *y_exacta, double *error, PoolHilos *pool);
 int leerDatosDesdeArchivo(const char *filename, double **x, double **y);
 
 /* ============================================================================
@@ -93,6 +96,21 @@ int main(void)
         return 1;
     }
     
+    /* Condición de frontera de las splines */
+    CondicionFrontera frontera = { FRONTERA_NATURAL, 0.0, 0.0 };
+    int tipo_frontera;
+    printf("\nCondición de frontera (1 = natural, 2 = sujeta, 3 = not-a-knot, 4 = periódica): ");
+    if (scanf("%d", &tipo_frontera) == 1 && tipo_frontera >= 1 && tipo_frontera <= 4) {
+        frontera.tipo = (TipoFrontera)(tipo_frontera - 1);
+    } else {
+        printf("[ADVERTENCIA] Opción no válida: se usa la frontera natural.\n");
+    }
+    if (frontera.tipo == FRONTERA_SUJETA) {
+        printf("Ingrese S'(x_0) y S'(x_n): ");
+        scanf("%lf %lf", &frontera.derivada_inicial, &frontera.derivada_final);
+    }
+    while (getchar() != '\n');  // Limpiar buffer
+    
     double rango = x_original[n_original-1] - x_original[0];
     int puntos_estimados = (int)(rango / h_objetivo) + 1;
     printf("  ✓ Con h = %.4lf se generarán aproximadamente %d puntos\n", h_objetivo, puntos_estimados);
@@ -104,9 +122,27 @@ int main(void)
     printf("\n╔══════════════════════════════════════════════════════╗\n");
     printf("║   Tabla Equiespaciada con Splines (h = %.4lf)       ║\n", h_objetivo);
     printf("╚══════════════════════════════════════════════════════╝\n");
+    /* Un hilo por núcleo para evaluar y escribir la tabla (NULL: todo en este hilo) */
+    PoolHilos *pool = crearPoolHilos(0);
     generarTablaEquiespaciada(x_original, y_original, n_original,
-                             &x_equi, &y_equi, &n_equi, h_objetivo);
-    
+                             &x_equi, &y_equi, &n_equi, h_objetivo, &frontera, pool);
+    double *y_exacta = (n_equi > 0) ? (double *)malloc(n_equi * sizeof(double)) : NULL;
+    double *error = (n_equi > 0) ? (double *)malloc(n_equi * sizeof(double)) : NULL;
+    if (y_exacta == NULL || error == NULL) {
+        if (n_equi > 0) {
+            printf("[ERROR] Error de asignación de memoria\n");
+        }
+        destruirPoolHilos(pool);
+        free(x_original);
+        free(y_original);
+        free(x_equi);
+        free(y_equi);
+        free(y_exacta);
+        free(error);
+        return 1;
+    }
+    calcularErrores(x_equi, y_equi, n_equi, y_exacta, error, pool);
+
     /* Calcular valores exactos y errores */
     printf("\n┌──────┬──────────┬────────────────┬────────────────┬──────────────┐\n");
     printf("│  i   │   x_i    │  y (spline)    │  y (exacta)    │   Error      │\n");
@@ -116,14 +152,18 @@ int main(void)
     double error_prom = 0.0;
     
     for (int i = 0; i < n_equi; i++) {
-        double y_exacta = f_exacta(x_equi[i]);
-        double error = fabs(y_equi[i] - y_exacta);
-        
-        error_prom += error;
-        if (error > error_max) error_max = error;
-        
+        error_prom += error[i];
+        if (error[i] > error_max) error_max = error[i];
+    }
+    for (int i = 0; i < n_equi; i++) {
+        /* Con tablas largas sólo se muestran las primeras y las últimas filas */
+        if (n_equi > FILAS_EN_PANTALLA && i == FILAS_EN_PANTALLA / 2) {
+            printf("│ ...  │   ...    │  (%8d filas más)                            │\n",
+                   n_equi - FILAS_EN_PANTALLA);
+            i = n_equi - FILAS_EN_PANTALLA / 2;
+        }
         printf("│ %3d  │  %.2lf    │  %12.6lf  │  %12.6lf  │  %10.6lf  │\n",
-               i, x_equi[i], y_equi[i], y_exacta, error);
+               i, x_equi[i], y_equi[i], y_exacta[i], error[i]);
     }
     
     printf("└──────┴──────────┴────────────────┴────────────────┴──────────────┘\n");
@@ -146,25 +186,48 @@ int main(void)
     FILE *archivo = fopen("resultados.txt", "w");
     if (archivo != NULL) {
         fprintf(archivo, "# Splines\n");
-        fprintf(archivo, "# %s\n\n", FUNCION_DESCRIPCION);
+        fprintf(archivo, "# %s\n", FUNCION_DESCRIPCION);
+        fprintf(archivo, "# Frontera: %s\n\n", nombreFrontera(frontera.tipo));
         
         fprintf(archivo, "# Tabla equiespaciada (h = %.4lf)\n", h_objetivo);
         fprintf(archivo, "# i\tx\ty_spline\ty_exacta\terror\n");
-        for (int i = 0; i < n_equi; i++) {
-            fprintf(archivo, "%d\t%.2lf\t%.6lf\t%.6lf\t%.6lf\n",
-                    i, x_equi[i], y_equi[i], f_exacta(x_equi[i]), 
-                    fabs(y_equi[i] - f_exacta(x_equi[i])));
-        }
+        /* Mismo formato que "%d\t%.2lf\t%.6lf\t%.6lf\t%.6lf\n", formateado en paralelo
+           (la columna NULL es el índice i) */
+        const double *columnas[5] = { NULL, x_equi, y_equi, y_exacta, error };
+        int decimales[5] = { 0, 2, 6, 6, 6 };
+        int fallo = escribirColumnasTexto(archivo, n_equi, 5, columnas, decimales, '\t', pool);
 
         fclose(archivo);
-        printf("\n✓ Resultados guardados en 'resultados.txt'\n");
+        if (!fallo) {
+            printf("\n✓ Resultados guardados en 'resultados.txt'\n");
+        }
+    }
+
+    /* Opcional: las mismas columnas (sin el índice) en binario */
+    char respuesta = 'n';
+    printf("\n¿Guardar también las columnas x, y_spline, y_exacta, error en binario (resultados.bin)? (s/n): ");
+    if (scanf(" %c", &respuesta) == 1 && (respuesta == 's' || respuesta == 'S')) {
+        FILE *binario = fopen("resultados.bin", "wb");
+        if (binario == NULL) {
+            printf("[ERROR] No se pudo crear el archivo resultados.bin\n");
+        } else {
+            const double *columnas[4] = { x_equi, y_equi, y_exacta, error };
+            int fallo = escribirColumnasBinario(binario, n_equi, 4, columnas);
+            fclose(binario);
+            if (!fallo) {
+                printf("✓ %d filas x 4 columnas (double) guardadas en 'resultados.bin'\n", n_equi);
+            }
+        }
     }
     
     /* Liberar memoria */
+    destruirPoolHilos(pool);
     free(x_original);
     free(y_original);
     free(x_equi);
     free(y_equi);
+    free(y_exacta);
+    free(error);
     
     return 0;
 }
@@ -182,151 +245,79 @@ double f_exacta(double x)
 }
 
 /**
- * Genera tabla equiespaciada usando splines cúbicas
+ * Genera tabla equiespaciada usando splines cúbicas con la condición de frontera dada
  */
 void generarTablaEquiespaciada(double *x_orig, double *y_orig, int n_orig,
-                               double **x_equi, double **y_equi, int *n_equi, double h_objetivo)
+                               double **x_equi, double **y_equi, int *n_equi, double h_objetivo,
+                               const CondicionFrontera *frontera, PoolHilos *pool)
 {
-    printf("\nConstruyendo splines cúbicas...\n");
-    
-    /* Construir sistema para splines */
-    double *A = (double *)malloc(n_orig * n_orig * sizeof(double));
-    double *b_vec = (double *)malloc(n_orig * sizeof(double));
-    double *M = (double *)malloc(n_orig * sizeof(double));
+    printf("\nConstruyendo splines cúbicas (frontera %s)...\n", nombreFrontera(frontera->tipo));
     
-    construirSistemaSplines(x_orig, y_orig, n_orig, A, b_vec);
-    eliminacionGaussiana(A, b_vec, M, n_orig);
+    SplineCubico S;
+    *n_equi = 0;
+    if (crearSplineCubicoFrontera(&S, x_orig, y_orig, n_orig, frontera) != 0) {
+        return; // crearSplineCubicoFrontera ya informó el error
+    }
     
     printf("Splines calculadas\n");
     
     /* Generar tabla equiespaciada */
     double a = x_orig[0];
     double b = x_orig[n_orig - 1];
-    *n_equi = (int)((b - a) / h_objetivo) + 1;
+    int n = (int)((b - a) / h_objetivo) + 1;
     
-    *x_equi = (double *)malloc(*n_equi * sizeof(double));
-    *y_equi = (double *)malloc(*n_equi * sizeof(double));
+    *x_equi = (double *)malloc(n * sizeof(double));
+    *y_equi = (double *)malloc(n * sizeof(double));
+    if (*x_equi == NULL || *y_equi == NULL) {
+        printf("[ERROR] Error de asignación de memoria\n");
+        free(*x_equi);
+        free(*y_equi);
+        *x_equi = *y_equi = NULL;
+        liberarSplineCubico(&S);
+        return;
+    }
     
-    printf("Generando %d puntos equiespaciados...\n", *n_equi);
+    printf("Generando %d puntos equiespaciados...\n", n);
     
-    for (int i = 0; i < *n_equi; i++) {
-        (*x_equi)[i] = a + i * h_objetivo;
-        (*y_equi)[i] = evaluarSpline((*x_equi)[i], x_orig, y_orig, M, n_orig);
-    }
+    /* Cada hilo evalúa un bloque contiguo de la grilla recorriendo los tramos una sola vez */
+    remuestrearSplineEquiespaciado(&S, a, h_objetivo, n, *x_equi, *y_equi, pool);
+    *n_equi = n;
     
     printf("Tabla generada\n");
     
-    free(A);
-    free(b_vec);
-    free(M);
+    liberarSplineCubico(&S);
 }
 
-/**
- * Construye sistema tridiagonal para splines cúbicas naturales
- */
-void construirSistemaSplines(double *x, double *y, int n, double *A, double *b_vec)
-{
-    for (int i = 0; i < n * n; i++) A[i] = 0.0;
-    
-    double *h = (double *)malloc((n-1) * sizeof(double));
-    for (int i = 0; i < n-1; i++) {
-        h[i] = x[i+1] - x[i];
-    }
-    
-    A[0] = 1.0;
-    b_vec[0] = 0.0;
-    
-    for (int i = 1; i < n-1; i++) {
-        A[i * n + (i-1)] = h[i-1];
-        A[i * n + i] = 2.0 * (h[i-1] + h[i]);
-        A[i * n + (i+1)] = h[i];
-        b_vec[i] = 6.0 * ((y[i+1] - y[i]) / h[i] - (y[i] - y[i-1]) / h[i-1]);
-    }
-    
-    A[(n-1) * n + (n-1)] = 1.0;
-    b_vec[n-1] = 0.0;
-    
-    free(h);
-}
+/* Datos compartidos por los hilos de calcularErrores */
+typedef struct {
+    const double *x, *y;
+    int n;
+    double *y_exacta, *error;
+} ContextoErrores;
 
-/**
- * Eliminación Gaussiana con pivoteo parcial
- */
-void eliminacionGaussiana(double *A, double *b_vec, double *solution, int n)
+static void calcularErroresBloque(void *contexto, int id_hilo, int num_hilos)
 {
-    double *A_copy = (double *)malloc(n * n * sizeof(double));
-    double *b_copy = (double *)malloc(n * sizeof(double));
-    
-    for (int i = 0; i < n * n; i++) A_copy[i] = A[i];
-    for (int i = 0; i < n; i++) b_copy[i] = b_vec[i];
-    
-    for (int k = 0; k < n-1; k++) {
-        int max_row = k;
-        double max_val = fabs(A_copy[k * n + k]);
-        
-        for (int i = k+1; i < n; i++) {
-            if (fabs(A_copy[i * n + k]) > max_val) {
-                max_val = fabs(A_copy[i * n + k]);
-                max_row = i;
-            }
-        }
-        
-        if (max_row != k) {
-            for (int j = 0; j < n; j++) {
-                double temp = A_copy[k * n + j];
-                A_copy[k * n + j] = A_copy[max_row * n + j];
-                A_copy[max_row * n + j] = temp;
-            }
-            double temp = b_copy[k];
-            b_copy[k] = b_copy[max_row];
-            b_copy[max_row] = temp;
-        }
-        
-        for (int i = k+1; i < n; i++) {
-            double factor = A_copy[i * n + k] / A_copy[k * n + k];
-            for (int j = k; j < n; j++) {
-                A_copy[i * n + j] -= factor * A_copy[k * n + j];
-            }
-            b_copy[i] -= factor * b_copy[k];
-        }
+    ContextoErrores *c = (ContextoErrores *)contexto;
+    int inicio, fin;
+    rangoHilo(c->n, id_hilo, num_hilos, &inicio, &fin);
+    for (int i = inicio; i < fin; i++) {
+        c->y_exacta[i] = f_exacta(c->x[i]);
+        c->error[i] = fabs(c->y[i] - c->y_exacta[i]);
     }
-    
-    for (int i = n-1; i >= 0; i--) {
-        solution[i] = b_copy[i];
-        for (int j = i+1; j < n; j++) {
-            solution[i] -= A_copy[i * n + j] * solution[j];
-        }
-        solution[i] /= A_copy[i * n + i];
-    }
-    
-    free(A_copy);
-    free(b_copy);
 }
 
 /**
- * Evalúa spline cúbica en un punto
+ * Calcula y_exacta[i] = f(x[i]) y error[i] = |y[i] - f(x[i])|, repartido entre los hilos del pool
  */
-double evaluarSpline(double x_eval, double *x, double *y, double *M, int n)
+void calcularErrores(const double *x, const double *y, int n,
+                     double *y_exacta, double *error, PoolHilos *pool)
 {
-    int j = 0;
-    for (int i = 0; i < n-1; i++) {
-        if (x_eval >= x[i] && x_eval <= x[i+1]) {
-            j = i;
-            break;
-        }
+    ContextoErrores contexto = { x, y, n, y_exacta, error };
+    if (pool != NULL) {
+        ejecutarEnPool(pool, calcularErroresBloque, &contexto);
+    } else {
+        calcularErroresBloque(&contexto, 0, 1);
     }
-    
-    if (x_eval < x[0]) j = 0;
-    if (x_eval > x[n-1]) j = n-2;
-    
-    double h_j = x[j+1] - x[j];
-    
-    double t1 = (M[j] / 6.0) * pow(x[j+1] - x_eval, 3) / h_j;
-    double t2 = (M[j+1] / 6.0) * pow(x_eval - x[j], 3) / h_j;
-    double t3 = (y[j] - M[j] * h_j * h_j / 6.0) * (x[j+1] - x_eval) / h_j;
-    double t4 = (y[j+1] - M[j+1] * h_j * h_j / 6.0) * (x_eval - x[j]) / h_j;
-    
-    return t1 + t2 + t3 + t4;
 }
 
 /**
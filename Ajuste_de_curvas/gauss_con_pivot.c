@@ -31,6 +31,8 @@
 #include <stdlib.h>
 #include <math.h>
 #include "gauss_con_pivot.h"
+#include "../Sistema_Ecuaciones_Lineales/nucleos_simd/nucleos_simd.h"
+#include "../Sistema_Ecuaciones_Lineales/factorizacion_cholesky/factorizacion_cholesky.h"
 
 void gaussPivot (double **A, double *b, int n, double *x)
 {
@@ -79,11 +81,8 @@ void gaussPivot (double **A, double *b, int n, double *x)
             // Calcular el factor para anular A[j][i].
             factor = (-A[j][i] / A[i][i]);
 
-            // Actualizar el resto de la fila j en la matriz A.
-            for (size_t k = i; k < (size_t)n; k++)
-            {
-                A[j][k] += factor * A[i][k];
-            }
+            // Actualizar el resto de la fila j en la matriz A (cada fila es contigua).
+            axpySimd(&A[j][i], &A[i][i], factor, n - (int)i);
 
             // Actualizar el elemento correspondiente en el vector b.
             b[j] += factor * b[i];
@@ -112,9 +111,7 @@ void gaussPivot (double **A, double *b, int n, double *x)
         double suma = b[i];
 
         // Restar los términos A[i][j] * x[j] para j > i, donde los x[j] ya son conocidos.
-        for (int j = (i + 1); j < n; j++) {
-            suma -= A[i][j] * x[j];
-        }
+        suma -= productoEscalarSimd(&A[i][i + 1], &x[i + 1], n - i - 1);
 
         // Despejar x[i].
         x[i] = suma / A[i][i];
@@ -127,4 +124,106 @@ void gaussPivot (double **A, double *b, int n, double *x)
     for (size_t i = 0; i < (size_t)n; i++)
         printf("  a%zu = %10.6lf\n", i, x[i]);
     printf("--------------------------------------------------\n");
-}
\ No newline at end of file
+}
+
+int gaussPivotDensa (MatrizDensa *A, double *b, double *x)
+{
+    int n = A->filas;
+    double det = 1.0;
+
+    // --- FASE 1: Eliminación hacia adelante ---
+    for (int i = 0; i < n - 1; i++)
+    {
+        // a) Pivoteo Parcial: Encontrar la fila con el máximo pivote en la columna i.
+        int pivote_fila = i + indiceMaximoAbsSimd(&MD(A, i, i), n - i, A->stride);
+
+        // Intercambiar filas; cada fila es un tramo contiguo de memoria.
+        if (pivote_fila != i) {
+            double *fila_i = filaMatrizDensa(A, i);
+            double *fila_p = filaMatrizDensa(A, pivote_fila);
+            for (int m = i; m < n; m++)
+            {
+                double aux = fila_p[m];
+                fila_p[m] = fila_i[m];
+                fila_i[m] = aux;
+            }
+            double aux = b[pivote_fila];
+            b[pivote_fila] = b[i];
+            b[i] = aux;
+        }
+
+        const double *fila_pivote = filaMatrizDensa(A, i);
+        if (fila_pivote[i] == 0)
+        {
+            return 1; // Matriz singular
+        }
+
+        // b) Eliminación: Hacer cero los elementos debajo del pivote A[i][i].
+        for (int j = i + 1; j < n; j++)
+        {
+            double *fila_j = filaMatrizDensa(A, j);
+            double factor = (-fila_j[i] / fila_pivote[i]);
+
+            axpySimd(fila_j + i, fila_pivote + i, factor, n - i);
+            b[j] += factor * b[i];
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        det *= MD(A, i, i);
+    }
+    if (fabs(det) < 1e-12)
+    {
+        return 1;
+    }
+
+    // --- FASE 2: Sustitución hacia atrás (Retrosustitución) ---
+    for (int i = (n - 1); i >= 0; i--)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        double suma = b[i] - productoEscalarSimd(fila + i + 1, x + i + 1, n - i - 1);
+        x[i] = suma / fila[i];
+    }
+
+    return 0;
+}
+
+int gaussPivotEspacio(EspacioTrabajo *E)
+{
+    double det = 0.0;
+    MetodoFactorizacion metodo = FACTORIZACION_GAUSS;
+
+    // Las ecuaciones normales son simétricas: se resuelven con Cholesky (o LDLᵀ),
+    // con la mitad de operaciones. Si A no es simétrica, mismo algoritmo que
+    // gaussPivot() (pivoteo parcial + retrosustitución) sobre la matriz contigua.
+    EstadoSolver estado = resolverDetectandoSimetria(&E->A, E->b, E->x, &det, &metodo);
+    if (estado == SOLVER_ERROR_MEMORIA)
+    {
+        printf("\n[ERROR] No se pudo asignar memoria para la factorización.\n");
+        return 1;
+    }
+    // Cholesky y LDLᵀ ya deciden la singularidad por sus pivotes: un determinante
+    // chico (ecuaciones normales mal escaladas) no es motivo para descartarlas
+    if (estado != SOLVER_OK || (metodo == FACTORIZACION_GAUSS && fabs(det) < 1e-12))
+    {
+        printf("\n[ERROR] El sistema no tiene solución única (determinante es cero).\n");
+        return 1;
+    }
+    if (metodo == FACTORIZACION_LDLT && det == 0.0)
+    {
+        // Semidefinida: hay incógnitas libres y se informa una de las soluciones
+        printf("\n[ADVERTENCIA] La matriz es singular (semidefinida positiva): "
+               "la solución no es única.\n");
+    }
+    printf("\nMétodo: %s\n", nombreMetodoFactorizacion(metodo));
+    printf("Determinante de A: %.4lf\n", det);
+
+    // --- Presentación de la Solución ---
+    printf("\n--------------------------------------------------\n");
+    printf("Solución del sistema:\n");
+    printf("(Coeficientes del polinomio a0, a1, ...)\n");
+    for (int i = 0; i < E->n; i++)
+        printf("  a%d = %10.6lf\n", i, E->x[i]);
+    printf("--------------------------------------------------\n");
+    return 0;
+}
@@ -7,6 +7,9 @@
 #ifndef GAUSS_CON_PIVOT_H
 #define GAUSS_CON_PIVOT_H
 
+#include "../Sistema_Ecuaciones_Lineales/matriz_densa/matriz_densa.h"
+#include "../Sistema_Ecuaciones_Lineales/espacio_trabajo/espacio_trabajo.h"
+
 /**
  * @brief Resuelve un sistema de ecuaciones lineales A*x = b usando eliminación Gaussiana con pivoteo parcial.
  * @details Este método modifica la matriz A y el vector b en el proceso.
@@ -22,4 +25,28 @@
  */
 void gaussPivot(double **A, double *b, int n, double *x);
 
+/**
+ * @brief Versión de gaussPivot() sobre una MatrizDensa (bloque contiguo de memoria).
+ * @details Realiza el mismo algoritmo (pivoteo parcial + retrosustitución) pero sin
+ *          imprimir resultados, para poder usarse dentro de otros cálculos.
+ * @param A Matriz de coeficientes n x n (contigua). Será modificada.
+ * @param b Vector de términos independientes, de tamaño n. Será modificado.
+ * @param x Vector de salida donde se almacenará la solución, de tamaño n.
+ * @return 0 si el sistema se resolvió, 1 si la matriz es singular.
+ */
+int gaussPivotDensa(MatrizDensa *A, double *b, double *x);
+
+/**
+ * @brief Versión de gaussPivot() sobre un EspacioTrabajo, sin reservar memoria.
+ * @details Resuelve E->A * x = E->b e imprime el método, el determinante y la
+ *          solución como gaussPivot(). Si A es simétrica (ecuaciones normales) usa
+ *          Cholesky, o LDLᵀ si es semidefinida, en lugar de Gauss; ver
+ *          resolverDetectandoSimetria(). E->A y E->b pueden quedar modificados.
+ *          Pensada para programas que arman varios sistemas seguidos sobre el
+ *          mismo espacio de trabajo.
+ * @param E Espacio de trabajo con el sistema cargado; la solución queda en E->x.
+ * @return 0 si el sistema se resolvió, 1 si la matriz es singular.
+ */
+int gaussPivotEspacio(EspacioTrabajo *E);
+
 #endif // GAUSS_CON_PIVOT_H
\ No newline at end of file
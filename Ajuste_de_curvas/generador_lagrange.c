@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include "lagrange_baricentrico.h"
 
 /**
  * Lee los puntos de interpolación desde un archivo
@@ -54,21 +55,6 @@ void leerPuntosDesdeArchivo(const char *filename, double **x_puntos, double **y_
     fclose(archivo);
 }
 
-/**
- * Calcula el polinomio de Lagrange L_i(x) para un índice específico
- */
-double calcularLi(double *x_puntos, int n, int i, double x) {
-    double Li = 1.0;
-    
-    for (int j = 0; j < n; j++) {
-        if (j != i) {
-            Li *= (x - x_puntos[j]) / (x_puntos[i] - x_puntos[j]);
-        }
-    }
-    
-    return Li;
-}
-
 /**
  * Muestra información sobre los puntos leídos
  */
@@ -115,6 +101,26 @@ void generarTablasLagrange(double *x_puntos, double *y_puntos, int n) {
     }
     
     double h = (x_max - x_min) / (num_puntos - 1);
+
+    // Pesos baricéntricos (una vez, O(n²)) y, para cada x de la tabla, el
+    // denominador D(x) = Σ w_j / (x - x_j): con él L_i(x) = w_i / (x - x_i) / D(x)
+    // cuesta O(1) y todas las tablas juntas O(n * num_puntos)
+    InterpoladorBaricentrico P;
+    if (crearInterpoladorBaricentrico(&P, x_puntos, y_puntos, n) != 0)
+        return;
+    double *x_tabla = (double *)malloc(num_puntos * sizeof(double));
+    double *denominador = (double *)malloc(num_puntos * sizeof(double));
+    int *nodo = (int *)malloc(num_puntos * sizeof(int));
+    if (!x_tabla || !denominador || !nodo) {
+        printf("Error: No se pudo reservar memoria\n");
+        free(x_tabla); free(denominador); free(nodo);
+        liberarInterpoladorBaricentrico(&P);
+        return;
+    }
+    for (int k = 0; k < num_puntos; k++) {
+        x_tabla[k] = x_min + k * h;
+        denominador[k] = denominadorBaricentrico(&P, x_tabla[k], &nodo[k]);
+    }
     
     printf("\n--- Generando archivos ---\n");
     
@@ -134,8 +140,12 @@ void generarTablasLagrange(double *x_puntos, double *y_puntos, int n) {
                 i, x_puntos[i]);
         
         for (int k = 0; k < num_puntos; k++) {
-            double x = x_min + k * h;
-            double Li = calcularLi(x_puntos, n, i, x);
+            double x = x_tabla[k];
+            double Li;
+            if (nodo[k] >= 0)
+                Li = (nodo[k] == i) ? 1.0 : 0.0;
+            else
+                Li = P.pesos[i] / (x - x_puntos[i]) / denominador[k];
             fprintf(archivo, "%.6f\t%.6f\n", x, Li);
         }
         
@@ -149,20 +159,19 @@ void generarTablasLagrange(double *x_puntos, double *y_puntos, int n) {
         fprintf(archivo_P, "# x\tP(x)\n");
         fprintf(archivo_P, "# Polinomio interpolador completo: P(x) = Suma de y_i * L_i(x)\n");
         
+        // P(x) en todos los puntos de la tabla con una sola llamada (O(n) por punto);
+        // el resultado reemplaza al denominador, que ya no se usa
+        double *P_tabla = denominador;
+        evaluarBaricentricoVector(&P, x_tabla, P_tabla, num_puntos);
         for (int k = 0; k < num_puntos; k++) {
-            double x = x_min + k * h;
-            double P = 0.0;
-            
-            for (int i = 0; i < n; i++) {
-                P += y_puntos[i] * calcularLi(x_puntos, n, i, x);
-            }
-            
-            fprintf(archivo_P, "%.6f\t%.6f\n", x, P);
+            fprintf(archivo_P, "%.6f\t%.6f\n", x_tabla[k], P_tabla[k]);
         }
         
         fclose(archivo_P);
         printf("  ✓ lagrange_P.txt (Polinomio interpolador completo)\n");
     }
+    free(x_tabla); free(denominador); free(nodo);
+    liberarInterpoladorBaricentrico(&P);
     
     printf("\n--- Generando script de gnuplot ---\n");
     
@@ -67,8 +67,12 @@
  * ============================================================================
  * - El polinomio interpolador es único, sin importar el método usado para encontrarlo (Lagrange, Newton, etc.).
  * - La interpolación de Lagrange es computacionalmente intensiva si se agregan nuevos puntos, ya que todos los polinomios base deben recalcularse.
+ *   Por eso lagrange() usa la forma baricéntrica (lagrange_baricentrico.h): los pesos se calculan una vez en O(n²),
+ *   cada evaluación cuesta O(n) y agregar un nodo cuesta O(n).
  * - Para un gran número de nodos equiespaciados, los polinomios de alto grado pueden oscilar salvajemente entre los puntos (Fenómeno de Runge).
- * - La opción 'b' (eliminación Gaussiana) resuelve un sistema de ecuaciones de Vandermonde, que es otra forma de encontrar los coeficientes del polinomio.
+ * - La opción 'b' arma el mismo polinomio en la forma de Newton (newton_diferencias.h): la tabla de diferencias
+ *   divididas cuesta O(n²), en lugar del O(n³) del sistema de Vandermonde (muy mal condicionado), P(x) se evalúa
+ *   con Horner anidado y un nodo nuevo cuesta O(n).
  * ---
  *
  * TEORÍA: INTERPOLACIÓN SEGMENTARIA (SPLINES)
@@ -96,9 +100,13 @@
  * Para asegurar que la curva sea suave, se imponen condiciones de continuidad
  * no solo en la función, sino también en su primera y segunda derivada en cada
  * nodo interior. Esto genera un sistema de ecuaciones lineales que permite
- * calcular los coeficientes. Los splines cúbicos "naturales" (usados aquí)
- * asumen que la segunda derivada en los extremos (x_0 y x_n) es cero, lo que
- * corresponde a que no hay curvatura en los extremos del trazado.
+ * calcular los coeficientes. Faltan dos condiciones, una en cada extremo, que
+ * se eligen al construir el spline:
+ *   - Natural: la segunda derivada en x_0 y x_n es cero (sin curvatura en los extremos).
+ *   - Sujeta: se conoce la pendiente S'(x_0) y S'(x_n).
+ *   - Not-a-knot: los dos primeros y los dos últimos tramos son la misma cúbica.
+ *   - Periódica: S, S' y S'' coinciden en x_0 y x_n (señales periódicas, y_0 = y_n).
+ * En todos los casos el sistema queda tridiagonal (cíclico en el periódico).
  *
  * El proceso para encontrar los coeficientes implica:
  * 1. Saber que a_i = y_i.
@@ -116,12 +124,17 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "../libreria_de_aditamentos/aditamentos_ui.h"
-#include "gauss_con_pivot.h"
+#include "lagrange_baricentrico.h"
+#include "newton_diferencias.h"
+#include "spline_cubico.h"
+#include "remuestreo_spline.h"
 
 // Define el nombre del archivo que contiene los nodos de interpolación.
 #define NODOS_TXT "nodos.txt"
+#define FILAS_EN_PANTALLA 40 // Tablas más largas se muestran resumidas (primeras y últimas filas)
 
 /**
  * @brief Lee un conjunto de puntos (x, y) desde un archivo de texto.
@@ -179,16 +192,19 @@ void imprimirPolinomio(double *coeficientes, int grado);
 void splinesLineales(double *x_puntos, double *y_puntos, int n);
 
 /**
- * @brief Implementa la interpolación por splines cúbicos naturales.
- * @details Calcula un polinomio de tercer grado para cada intervalo entre nodos,
- *          asegurando continuidad en la función y sus dos primeras derivadas.
- *          Resuelve un sistema tridiagonal para encontrar los coeficientes.
+ * @brief Pide al usuario la condición de frontera de los splines cúbicos.
+ * @details Natural, sujeta (pide S'(x_0) y S'(x_{n-1})), not-a-knot o periódica.
+ * @return La condición elegida (natural si la opción no es válida).
  */
+CondicionFrontera pedirCondicionFrontera(void);
 
 /**
- * @brief Encuentra el polinomio interpolador resolviendo el sistema de Vandermonde.
- * @details Construye la matriz de Vandermonde A y el vector b a partir de los puntos,
- *          y resuelve el sistema A*c=b para encontrar los coeficientes 'c' del polinomio.
+ * @brief Implementa la interpolación por splines cúbicos.
+ * @details Calcula un polinomio de tercer grado para cada intervalo entre nodos,
+ *          asegurando continuidad en la función y sus dos primeras derivadas,
+ *          con la condición de frontera que elige el usuario.
+ *          Resuelve el sistema tridiagonal de las segundas derivadas en O(n)
+ *          (crearSplineCubico) y muestra cada tramo en la base de monomios.
  * @param x_puntos Arreglo con las coordenadas x de los puntos.
  * @param y_puntos Arreglo con las coordenadas y de los puntos.
  * @param n Número de puntos.
@@ -206,6 +222,16 @@ void splinesCubicas(double *x_puntos, double *y_puntos, int n);
  */
 void generarTablaDesdeSplinesCubicos(double *x_puntos, double *y_puntos, int n_original);
 
+/**
+ * @brief Encuentra el polinomio interpolador con diferencias divididas de Newton.
+ * @details Arma la tabla de diferencias divididas en O(n²), muestra el polinomio
+ *          en la base de monomios y lo evalúa con Horner anidado en el punto que
+ *          pide el usuario. Reemplaza al sistema de Vandermonde (O(n³) y mal
+ *          condicionado): es el mismo polinomio.
+ * @param x_puntos Arreglo con las coordenadas x de los puntos.
+ * @param y_puntos Arreglo con las coordenadas y de los puntos.
+ * @param n Número de puntos.
+ */
 void funcional (double *x_puntos, double *y_puntos, int n);
 
 int main(void)
@@ -226,7 +252,7 @@ int main(void)
         printf("===========================================================\n");
         printf("Seleccione una opción:\n");
         printf("  a) Forma de Lagrange del Polinomio Interpolador\n");
-        printf("  b) Polinomio Interpolador (vía Sistema de Ecuaciones de Vandermonde)\n");
+        printf("  b) Polinomio Interpolador (Diferencias Divididas de Newton)\n");
         printf("\nInterpolacion Segmentaria (Curvas Spline):\n");
         printf("  c) Splines Lineales\n");
         printf("  d) Splines Cubicas\n");
@@ -252,7 +278,7 @@ int main(void)
         case 'b':
             system("clear");
             printf("------------------------------------------------------------\n");
-            printf("      POLINOMIO INTERPOLADOR (SISTEMA DE VANDERMONDE)\n");
+            printf("   POLINOMIO INTERPOLADOR (DIFERENCIAS DIVIDIDAS DE NEWTON)\n");
             printf("------------------------------------------------------------\n");
             leerPuntosDesdeArchivo(NODOS_TXT, &x_puntos, &y_puntos, &n);
             pausa();
@@ -373,87 +399,14 @@ void generarTablaDesdeSplinesCubicos(double *x_puntos, double *y_puntos, int n_o
         printf("\n[INFO] Regenerando tabla con %d puntos equiespaciados usando splines cúbicos.\n", n_nuevos);
     }
 
-    // --- Paso 1: Calcular los coeficientes de los splines cúbicos ---
-    int num_splines = n_original - 1;
-    int num_incognitas = 4 * num_splines;
-
-    double **A = (double **)malloc(num_incognitas * sizeof(double *));
-    double *b = (double *)malloc(num_incognitas * sizeof(double));
-    double *solucion = (double *)malloc(num_incognitas * sizeof(double));
-
-    if (!A || !b || !solucion) {
-        printf("[ERROR] Falla de memoria al crear el sistema para splines cúbicos.\n");
-        free(A); free(b); free(solucion);
+    // --- Paso 1: Calcular los coeficientes de los splines cúbicos (sistema tridiagonal, en O(n)) ---
+    SplineCubico S;
+    CondicionFrontera frontera = pedirCondicionFrontera();
+    printf("\nCalculando coeficientes de los splines cúbicos (frontera %s)...\n", nombreFrontera(frontera.tipo));
+    if (crearSplineCubicoFrontera(&S, x_puntos, y_puntos, n_original, &frontera) != 0) {
         return;
     }
 
-    for (int i = 0; i < num_incognitas; i++) {
-        A[i] = (double *)calloc(num_incognitas, sizeof(double));
-        if (!A[i]) {
-            printf("[ERROR] Falla de memoria en fila %d de la matriz A.\n", i);
-            for(int k=0; k<i; k++) free(A[k]);
-            free(A); free(b); free(solucion);
-            return;
-        }
-        b[i] = 0.0;
-    }
-
-    // Construir el sistema de ecuaciones (igual que en splinesCubicas)
-    int fila_actual = 0;
-
-    // Condición 1: Cada spline pasa por sus puntos
-    for (int k = 0; k < num_splines; k++) {
-        A[fila_actual][4*k + 0] = pow(x_puntos[k], 3);
-        A[fila_actual][4*k + 1] = pow(x_puntos[k], 2);
-        A[fila_actual][4*k + 2] = x_puntos[k];
-        A[fila_actual][4*k + 3] = 1;
-        b[fila_actual] = y_puntos[k];
-        fila_actual++;
-
-        A[fila_actual][4*k + 0] = pow(x_puntos[k+1], 3);
-        A[fila_actual][4*k + 1] = pow(x_puntos[k+1], 2);
-        A[fila_actual][4*k + 2] = x_puntos[k+1];
-        A[fila_actual][4*k + 3] = 1;
-        b[fila_actual] = y_puntos[k+1];
-        fila_actual++;
-    }
-
-    // Condición 2: Continuidad de primera derivada
-    for (int k = 0; k < num_splines - 1; k++) {
-        A[fila_actual][4*k + 0] = 3 * pow(x_puntos[k+1], 2);
-        A[fila_actual][4*k + 1] = 2 * x_puntos[k+1];
-        A[fila_actual][4*k + 2] = 1;
-        A[fila_actual][4*(k+1) + 0] = -3 * pow(x_puntos[k+1], 2);
-        A[fila_actual][4*(k+1) + 1] = -2 * x_puntos[k+1];
-        A[fila_actual][4*(k+1) + 2] = -1;
-        b[fila_actual] = 0.0;
-        fila_actual++;
-    }
-
-    // Condición 3: Continuidad de segunda derivada
-    for (int k = 0; k < num_splines - 1; k++) {
-        A[fila_actual][4*k + 0] = 6 * x_puntos[k+1];
-        A[fila_actual][4*k + 1] = 2;
-        A[fila_actual][4*(k+1) + 0] = -6 * x_puntos[k+1];
-        A[fila_actual][4*(k+1) + 1] = -2;
-        b[fila_actual] = 0.0;
-        fila_actual++;
-    }
-
-    // Condición 4: Frontera natural (segunda derivada nula en extremos)
-    A[fila_actual][0] = 6 * x_puntos[0];
-    A[fila_actual][1] = 2;
-    b[fila_actual] = 0.0;
-    fila_actual++;
-
-    A[fila_actual][4*(num_splines-1) + 0] = 6 * x_puntos[n_original-1];
-    A[fila_actual][4*(num_splines-1) + 1] = 2;
-    b[fila_actual] = 0.0;
-
-    // Resolver el sistema
-    printf("\nCalculando coeficientes de los splines cúbicos...\n");
-    gaussPivot(A, b, num_incognitas, solucion);
-
     // --- Paso 2: Generar los nuevos puntos equiespaciados ---
     double x_min = x_puntos[0];
     double x_max = x_puntos[n_original - 1];
@@ -465,57 +418,47 @@ void generarTablaDesdeSplinesCubicos(double *x_puntos, double *y_puntos, int n_o
     if (!x_nuevos || !y_nuevos) {
         printf("[ERROR] Falla de memoria al crear arrays para nueva tabla.\n");
         free(x_nuevos); free(y_nuevos);
-        for (int i = 0; i < num_incognitas; i++) free(A[i]);
-        free(A); free(b); free(solucion);
+        liberarSplineCubico(&S);
         return;
     }
 
     printf("\nGenerando %d puntos equiespaciados en [%.4f, %.4f]...\n", n_nuevos, x_min, x_max);
+
+    // Cada hilo evalúa un bloque contiguo de la grilla recorriendo sus tramos una
+    // sola vez; si no se puede crear el pool se evalúa en este hilo
+    PoolHilos *pool = crearPoolHilos(0);
+    remuestrearSplineEquiespaciado(&S, x_min, paso, n_nuevos, x_nuevos, y_nuevos, pool);
+
     printf("\n%-15s %-15s\n", "x", "y (spline)");
     printf("----------------------------------------\n");
-
     for (int i = 0; i < n_nuevos; i++) {
-        // Calcular el valor x equiespaciado
-        x_nuevos[i] = x_min + i * paso;
-
-        // Encontrar el tramo (k) que contiene este x
-        int k = 0;
-        for (int j = 0; j < num_splines; j++) {
-            if (x_nuevos[i] >= x_puntos[j] && x_nuevos[i] <= x_puntos[j+1]) {
-                k = j;
-                break;
-            }
+        if (n_nuevos > FILAS_EN_PANTALLA && i == FILAS_EN_PANTALLA / 2) {
+            printf("%-15s %-15s   (%d filas más)\n", "...", "...", n_nuevos - FILAS_EN_PANTALLA);
+            i = n_nuevos - FILAS_EN_PANTALLA / 2;
         }
-        // Si está en el último punto exacto, usar el último spline
-        if (fabs(x_nuevos[i] - x_max) < 1e-9) {
-            k = num_splines - 1;
-        }
-
-        // Evaluar el spline S_k(x) en este punto
-        double a_k = solucion[4*k + 0];
-        double b_k = solucion[4*k + 1];
-        double c_k = solucion[4*k + 2];
-        double d_k = solucion[4*k + 3];
-        
-        y_nuevos[i] = a_k * pow(x_nuevos[i], 3) + b_k * pow(x_nuevos[i], 2) + c_k * x_nuevos[i] + d_k;
-
         printf("%-15.4f %-15.4f\n", x_nuevos[i], y_nuevos[i]);
     }
     printf("----------------------------------------\n");
 
     // --- Paso 3: Guardar la nueva tabla en un archivo ---
+    // Texto "x y" con 4 decimales, o columnas binarias (x[0..n-1] y luego y[0..n-1]) si el nombre termina en .bin
     char nombre_archivo[256];
-    printf("\nIngrese el nombre del archivo para guardar la nueva tabla (ej: nueva_tabla.txt): ");
-    scanf("%s", nombre_archivo);
+    printf("\nIngrese el nombre del archivo para guardar la nueva tabla (ej: nueva_tabla.txt, o .bin para binario): ");
+    scanf("%255s", nombre_archivo);
     while (getchar() != '\n');
 
-    FILE *archivo = fopen(nombre_archivo, "w");
+    size_t largo = strlen(nombre_archivo);
+    int binario = largo >= 4 && strcmp(nombre_archivo + largo - 4, ".bin") == 0;
+    const double *columnas[2] = { x_nuevos, y_nuevos };
+    int decimales[2] = { 4, 4 };
+
+    FILE *archivo = fopen(nombre_archivo, binario ? "wb" : "w");
     if (!archivo) {
         printf("[ERROR] No se pudo crear el archivo %s\n", nombre_archivo);
+    } else if ((binario ? escribirColumnasBinario(archivo, n_nuevos, 2, columnas)
+                        : escribirColumnasTexto(archivo, n_nuevos, 2, columnas, decimales, ' ', pool)) != 0) {
+        fclose(archivo);
     } else {
-        for (int i = 0; i < n_nuevos; i++) {
-            fprintf(archivo, "%.4f %.4f\n", x_nuevos[i], y_nuevos[i]);
-        }
         fclose(archivo);
         printf("\n╔════════════════════════════════════════════════════╗\n");
         printf("║              OPERACIÓN EXITOSA                     ║\n");
@@ -528,14 +471,10 @@ void generarTablaDesdeSplinesCubicos(double *x_puntos, double *y_puntos, int n_o
     }
 
     // --- Paso 4: Liberar memoria ---
+    destruirPoolHilos(pool);
     free(x_nuevos);
     free(y_nuevos);
-    for (int i = 0; i < num_incognitas; i++) {
-        free(A[i]);
-    }
-    free(A);
-    free(b);
-    free(solucion);
+    liberarSplineCubico(&S);
 }
 
 
@@ -604,31 +543,30 @@ void lagrange(double *x_puntos, double *y_puntos, int n)
 
     system("clear");
 
-    // Bucle principal de Lagrange: P_n(x_i) = Σ [y_k * L_k(x_i)]
-    for (int k = 0; k < n; k++) // Sumatoria sobre k
+    // Pesos baricéntricos w_k = 1 / Π_{j≠k} (x_k - x_j): se calculan una vez
+    // (O(n²)) y rechazan los puntos x duplicados.
+    InterpoladorBaricentrico P;
+    if (crearInterpoladorBaricentrico(&P, x_puntos, y_puntos, n) != 0)
+        return;
+
+    // Con el denominador D(x_i) = Σ w_j / (x_i - x_j) cada polinomio base es
+    // L_k(x_i) = (w_k / (x_i - x_k)) / D(x_i): todos juntos cuestan O(n).
+    int nodo;
+    double denominador = denominadorBaricentrico(&P, x_i, &nodo);
+    for (int k = 0; k < n; k++)
     {
-        producto = 1.0; // L_k(x_i)
-        for (int j = 0; j < n; j++)
-        {
-            if (j != k)
-            {
-                double denominador = x_puntos[k] - x_puntos[j];
-                // Verificación para evitar división por cero si hay puntos x duplicados.
-                if (denominador == 0.0) {
-                    printf("[ERROR] División por cero detectada. Los puntos x_%d y x_%d son iguales.\n", k, j);
-                    return;
-                } else {
-                    producto *= (x_i - x_puntos[j]) / denominador;
-                }
-            }
-        }
+        if (nodo >= 0)
+            producto = (k == nodo) ? 1.0 : 0.0;
+        else
+            producto = P.pesos[k] / (x_i - x_puntos[k]) / denominador;
 
         // Mostrar el valor del polinomio base L_k(x) evaluado en x_i.
         printf("\nL_%d(%.3f) = %.6f\n", k, x_i, producto);
-        
-        // Acumular el término y_k * L_k(x_i) a la suma total.
-        suma += producto * y_puntos[k];
     }
+
+    // P_n(x_i) = Σ [y_k * L_k(x_i)], con la fórmula baricéntrica en O(n).
+    suma = evaluarBaricentrico(&P, x_i);
+    liberarInterpoladorBaricentrico(&P);
     pausa();
     system("clear");
 
@@ -823,120 +761,63 @@ void splinesLineales(double *x_puntos, double *y_puntos, int n)
     printf("------------------------------------------------------------\n");
 }
 
+CondicionFrontera pedirCondicionFrontera(void)
+{
+    CondicionFrontera frontera = { FRONTERA_NATURAL, 0.0, 0.0 };
+    char opcion;
+    printf("\nCondición de frontera de los splines cúbicos:\n");
+    printf("  a) Natural (S'' = 0 en los extremos)\n");
+    printf("  b) Sujeta (S' dada en los extremos)\n");
+    printf("  c) Not-a-knot (S''' continua en x_1 y x_{n-2})\n");
+    printf("  d) Periódica (requiere y_0 = y_{n-1})\n");
+    opcionMenu(&opcion);
+
+    switch (opcion)
+    {
+    case 'a':
+        break;
+    case 'b':
+        frontera.tipo = FRONTERA_SUJETA;
+        printf("Ingrese S'(x_0): ");
+        scanf("%lf", &frontera.derivada_inicial);
+        printf("Ingrese S'(x_{n-1}): ");
+        scanf("%lf", &frontera.derivada_final);
+        while (getchar() != '\n');
+        break;
+    case 'c':
+        frontera.tipo = FRONTERA_NO_NODO;
+        break;
+    case 'd':
+        frontera.tipo = FRONTERA_PERIODICA;
+        break;
+    default:
+        printf("[ADVERTENCIA] Opción no válida: se usa la frontera natural.\n");
+        break;
+    }
+    return frontera;
+}
+
 void splinesCubicas(double *x_puntos, double *y_puntos, int n)
 {
-    if (n < 2) {
-        printf("[ERROR] Se necesitan al menos 2 puntos para splines cúbicos.\n");
+    // --- Pasos 1 a 3: Plantear y resolver el sistema tridiagonal de las segundas derivadas ---
+    SplineCubico S;
+    CondicionFrontera frontera = pedirCondicionFrontera();
+    printf("Resolviendo sistema tridiagonal de %d x %d ecuaciones para encontrar los coeficientes (frontera %s)...\n",
+           n, n, nombreFrontera(frontera.tipo));
+    if (crearSplineCubicoFrontera(&S, x_puntos, y_puntos, n, &frontera) != 0) {
         return;
     }
     int num_splines = n - 1;
-    int num_incognitas = 4 * num_splines; // 4 coeficientes (a,b,c,d) por cada spline
-
-    // --- Paso 1: Asignar memoria para el sistema de ecuaciones A*sol = b ---
-    double **A = (double **)malloc(num_incognitas * sizeof(double *)); // Matriz de condiciones
-    double *b = (double *)malloc(num_incognitas * sizeof(double));
-    double *solucion = (double *)malloc(num_incognitas * sizeof(double)); // Coeficientes [a0,b0,c0,d0, a1,b1,c1,d1, ...]
-
-    if (!A || !b || !solucion) {
-        printf("[ERROR] Falla de memoria al crear el sistema para splines cúbicos.\n");
-        free(A); free(b); free(solucion);
-        return;
-    }
-
-    for (int i = 0; i < num_incognitas; i++) {
-        A[i] = (double *)calloc(num_incognitas, sizeof(double)); // Inicializar con ceros
-        if (!A[i]) {
-            printf("[ERROR] Falla de memoria en fila %d de la matriz A.\n", i);
-            // Liberar memoria asignada hasta ahora
-            for(int k=0; k<i; k++) free(A[k]);
-            free(A); free(b); free(solucion);
-            return;
-        }
-        b[i] = 0.0;
-    }
-
-    // --- Paso 2: Construir la matriz A y el vector b según las condiciones ---
-    int fila_actual = 0;
-
-    // Condición 1: Cada spline S_k pasa por sus puntos (x_k, y_k) y (x_{k+1}, y_{k+1})
-    // S_k(x) = a_k*x^3 + b_k*x^2 + c_k*x + d_k. Esto genera 2*(n-1) ecuaciones.
-    for (int k = 0; k < num_splines; k++) {
-        // Ecuación S_k(x_k) = y_k
-        A[fila_actual][4*k + 0] = pow(x_puntos[k], 3); // Coeficiente de a_k (x^3)
-        A[fila_actual][4*k + 1] = pow(x_puntos[k], 2); // Coeficiente de b_k (x^2)
-        A[fila_actual][4*k + 2] = x_puntos[k];         // Coeficiente de c_k (x)
-        A[fila_actual][4*k + 3] = 1;                   // Coeficiente de d_k (1)
-        b[fila_actual] = y_puntos[k];
-        fila_actual++;
-
-        // Ecuación S_k(x_{k+1}) = y_{k+1}
-        A[fila_actual][4*k + 0] = pow(x_puntos[k+1], 3);
-        A[fila_actual][4*k + 1] = pow(x_puntos[k+1], 2);
-        A[fila_actual][4*k + 2] = x_puntos[k+1];
-        A[fila_actual][4*k + 3] = 1;
-        b[fila_actual] = y_puntos[k+1];
-        fila_actual++;
-    }
-
-    // Condición 2: Continuidad de la primera derivada en nodos interiores.
-    // S'_k(x_{k+1}) = S'_{k+1}(x_{k+1}) => S'_k(x_{k+1}) - S'_{k+1}(x_{k+1}) = 0. S'(x) = 3ax^2 + 2bx + c
-    // Esto genera n-2 ecuaciones.
-    for (int k = 0; k < num_splines - 1; k++) {
-        // Coeficientes para S'_k(x_{k+1})
-        A[fila_actual][4*k + 0] = 3 * pow(x_puntos[k+1], 2); // 3*a_k
-        A[fila_actual][4*k + 1] = 2 * x_puntos[k+1];         // 2*b_k
-        A[fila_actual][4*k + 2] = 1;                         // c_k
-        // Coeficientes para -S'_{k+1}(x_{k+1})
-        A[fila_actual][4*(k+1) + 0] = -3 * pow(x_puntos[k+1], 2); // -3*a_{k+1}
-        A[fila_actual][4*(k+1) + 1] = -2 * x_puntos[k+1];         // -2*b_{k+1}
-        A[fila_actual][4*(k+1) + 2] = -1;                         // -c_{k+1}
-        b[fila_actual] = 0.0;
-        fila_actual++;
-    }
-
-    // Condición 3: Continuidad de la segunda derivada en nodos interiores.
-    // S''_k(x_{k+1}) = S''_{k+1}(x_{k+1}) => S''_k(x_{k+1}) - S''_{k+1}(x_{k+1}) = 0. S''(x) = 6ax + 2b
-    // Esto genera n-2 ecuaciones.
-    for (int k = 0; k < num_splines - 1; k++) {
-        // Coeficientes para S''_k(x_{k+1})
-        A[fila_actual][4*k + 0] = 6 * x_puntos[k+1]; // 6*a_k
-        A[fila_actual][4*k + 1] = 2;                 // 2*b_k
-        // Coeficientes para -S''_{k+1}(x_{k+1})
-        A[fila_actual][4*(k+1) + 0] = -6 * x_puntos[k+1]; // -6*a_{k+1}
-        A[fila_actual][4*(k+1) + 1] = -2;                 // -2*b_{k+1}
-        b[fila_actual] = 0.0;
-        fila_actual++;
-    }
-
-    // Condición 4: Condiciones de frontera para spline natural.
-    // S''_0(x_0) = 0  y  S''_{n-2}(x_{n-1}) = 0 (segunda derivada nula en los extremos)
-    // Esto genera 2 ecuaciones.
-    // Ecuación S''_0(x_0) = 0  =>  6*a_0*x_0 + 2*b_0 = 0
-    A[fila_actual][0] = 6 * x_puntos[0]; // 6*a_0
-    A[fila_actual][1] = 2;               // 2*b_0
-    b[fila_actual] = 0.0;
-    fila_actual++;
-
-    // Ecuación S''_{n-2}(x_{n-1}) = 0  =>  6*a_{n-2}*x_{n-1} + 2*b_{n-2} = 0
-    A[fila_actual][4*(num_splines-1) + 0] = 6 * x_puntos[n-1]; // 6*a_{n-2}
-    A[fila_actual][4*(num_splines-1) + 1] = 2;                 // 2*b_{n-2}
-    b[fila_actual] = 0.0;
-
-    // --- Paso 3: Resolver el sistema de ecuaciones A*sol = b ---
-    printf("Resolviendo sistema de %d x %d ecuaciones para encontrar los coeficientes...\n", num_incognitas, num_incognitas);
-    gaussPivot(A, b, num_incognitas, solucion);
 
     // --- Paso 4: Imprimir los polinomios resultantes ---
     printf("\nPolinomios cúbicos para cada tramo S_k(x) = a_k*x^3 + b_k*x^2 + c_k*x + d_k:\n");
     printf("------------------------------------------------------------------------------------------\n");
     for (int k = 0; k < num_splines; k++) {
-        double a_k = solucion[4*k + 0];
-        double b_k = solucion[4*k + 1];
-        double c_k = solucion[4*k + 2];
-        double d_k = solucion[4*k + 3];
+        double monomios[4]; // monomios[i] es el coeficiente de x^i
+        coeficientesMonomiosSpline(&S, k, monomios);
         printf("Tramo %d, x en [%.2f, %.2f]:\n", k, x_puntos[k], x_puntos[k+1]);
         printf("S_%d(x) = (%.4f)*x^3 + (%.4f)*x^2 + (%.4f)*x + (%.4f)\n\n",
-               k, a_k, b_k, c_k, d_k);
+               k, monomios[3], monomios[2], monomios[1], monomios[0]);
     }
     printf("------------------------------------------------------------------------------------------\n");
     pausa();
@@ -948,29 +829,14 @@ void splinesCubicas(double *x_puntos, double *y_puntos, int n)
     scanf("%lf", &x_val);
     while (getchar() != '\n');
 
-    // Encontrar el tramo (k) que contiene a x_val.
-    int k = -1;
-    for (int j = 0; j < num_splines; j++) {
-        if (x_val >= x_puntos[j] && x_val <= x_puntos[j+1]) {
-            k = j;
-            break;
-        }
-    }
-
-    if (k == -1) {
+    if ((x_val < x_puntos[0] || x_val > x_puntos[n-1]) && frontera.tipo != FRONTERA_PERIODICA) {
         printf("\n[ADVERTENCIA] El valor %.4f está fuera del rango de interpolación [%.4f, %.4f].\n",
                x_val, x_puntos[0], x_puntos[n-1]);
-        // Decidir si extrapolar usando el primer o último tramo.
-        if (x_val < x_puntos[0]) k = 0;
-        else k = num_splines - 1;
     }
 
-    // Evaluar el polinomio S_k(x) en x_val.
-    double a_k = solucion[4*k + 0];
-    double b_k = solucion[4*k + 1];
-    double c_k = solucion[4*k + 2];
-    double d_k = solucion[4*k + 3];
-    double y_val = a_k * pow(x_val, 3) + b_k * pow(x_val, 2) + c_k * x_val + d_k;
+    // Tramo que contiene a x_val (fuera del rango se extrapola con el primero o el último)
+    int k = tramoSplineCubico(&S, x_val);
+    double y_val = evaluarSplineCubico(&S, x_val);
 
     printf("\nEl punto se encuentra en el intervalo [%.4f, %.4f] (Tramo %d).\n", x_puntos[k], x_puntos[k+1], k);
     printf("\n------------------------------------------------------------\n");
@@ -979,64 +845,35 @@ void splinesCubicas(double *x_puntos, double *y_puntos, int n)
     printf("------------------------------------------------------------\n");
 
     // --- Paso 6: Liberar toda la memoria dinámica ---
-    for (int i = 0; i < num_incognitas; i++) {
-        free(A[i]);
-    }
-    free(A);
-    free(b);
-    free(solucion);
+    liberarSplineCubico(&S);
 }
 
 void funcional (double *x_puntos, double *y_puntos, int n)
 {
-    // 1. Asignar memoria para la matriz de Vandermonde A y el vector b.
-    double **A = (double **)malloc(n * sizeof(double *));
-    double *b = (double *)malloc(n * sizeof(double));
-    double *coeficientes = (double *)malloc(n * sizeof(double)); // Vector para los coeficientes a_i
+    // 1. Tabla de diferencias divididas: coeficientes c_k = f[x_0, ..., x_k] en O(n²).
+    InterpoladorNewton N;
+    if (crearInterpoladorNewton(&N, x_puntos, y_puntos, n) != 0)
+        return;
 
-    if (!A || !b || !coeficientes) {
+    // 2. Coeficientes en la base de monomios (a_i de x^i), sólo para mostrarlos.
+    double *coeficientes = (double *)malloc(n * sizeof(double));
+    if (!coeficientes) {
         printf("[ERROR] Error de memoria\n");
-        free(A);
-        free(b);
-        free(coeficientes);
+        liberarInterpoladorNewton(&N);
         return;
     }
+    coeficientesMonomiosNewton(&N, coeficientes);
 
-    // 2. Armar la Matriz de Vandermonde A y el vector independiente b.
-    for (size_t i = 0; i < (size_t)n; i++)
-    {
-        // Asignar memoria para las columnas de cada fila
-        A[i] = (double *)malloc(n * sizeof(double));
-        if (!A[i])
-        {
-            printf("[ERROR] Error de memoria en la fila %zu\n", i);
-            // Liberar toda la memoria asignada antes de salir para evitar fugas.
-            for(size_t k = 0; k < i; k++) {
-                free(A[k]);
-            }
-            free(A);
-            free(b);
-            free(coeficientes);
-            return;
-        }
-
-        for (size_t j = 0; j < (size_t)n; j++)
-        {
-            A[i][j] = pow(x_puntos[i], j); // A[i][j] = x_i^j
-        }
-        b[i] = y_puntos[i];
-    }
-
-    // 3. Resolver el sistema de ecuaciones A*coef = b para encontrar los coeficientes.
-    gaussPivot(A, b, n, coeficientes);
-
-    // 4. Imprimir el polinomio resultante.
+    // 3. Imprimir las diferencias divididas y el polinomio resultante.
     printf("\n------------------------------------------------------------\n");
-    printf("      Polinomio Interpolador (Vía Sistema de Vandermonde)\n");
+    printf("      Polinomio Interpolador (Diferencias Divididas de Newton)\n");
     printf("------------------------------------------------------------\n");
-    printf("P(x) = ");
+    for (int k = 0; k < n; k++)
+        printf("c_%d = f[x_0..x_%d] = %.6f\n", k, k, N.coeficientes[k]);
+    printf("\nP(x) = ");
     imprimirPolinomio(coeficientes, n-1);
     printf("------------------------------------------------------------\n\n");
+    free(coeficientes);
 
     // Solicitar el punto donde se desea interpolar.
     double x_i = 0.0;
@@ -1044,23 +881,12 @@ void funcional (double *x_puntos, double *y_puntos, int n)
     scanf("%lf", &x_i);
     while (getchar() != '\n'); // Limpiar el búfer de entrada
 
-    // 5. Evaluar el polinomio en el punto x_i.
-    double suma = 0.0;
-    for (size_t i = 0; i < (size_t)n; i++)
-    {
-        suma += coeficientes[i] * pow(x_i, i);
-    }
-    
-    // 6. Calcular el valor real y el error.
+    // 4. Evaluar el polinomio en el punto x_i (Horner anidado, O(n)).
+    double suma = evaluarNewton(&N, x_i);
+    liberarInterpoladorNewton(&N);
+
+    // 5. Calcular el valor real y el error.
     double fx = f(x_i);
     printf("\nEl valor interpolado en X = %lf es: %lf\n", x_i, suma);
     printf("Error absoluto (vs f(x) real): %lf\n", calcularError(fx, suma));
-
-    // 7. Liberar toda la memoria dinámica utilizada en esta función.
-    for (int i = 0; i < n; i++) {
-        free(A[i]);
-    }
-    free(A);
-    free(b);
-    free(coeficientes);
 }
\ No newline at end of file
@@ -0,0 +1,195 @@
+/**
+ * @file lagrange_baricentrico.c
+ * @brief Implementación del interpolador de Lagrange en forma baricéntrica.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "lagrange_baricentrico.h"
+
+/* pesos[k] = w_k * 2^exponente_escala con el mayor |pesos[k]| en [1/2, 1) (potencias de 2: exacto) */
+static void reescalarPesos(InterpoladorBaricentrico *P)
+{
+    int maximo = P->exponentes[0];
+    for (int k = 1; k < P->n; k++)
+        if (P->exponentes[k] > maximo)
+            maximo = P->exponentes[k];
+    for (int k = 0; k < P->n; k++)
+        P->pesos[k] = ldexp(P->mantisas[k], P->exponentes[k] - maximo);
+    P->exponente_escala = -maximo;
+}
+
+/* Duplica la capacidad. Si falla alguna reserva los arreglos ya agrandados siguen siendo válidos */
+static int agrandarInterpolador(InterpoladorBaricentrico *P)
+{
+    int capacidad = P->capacidad > 0 ? 2 * P->capacidad : 8;
+    double **arreglos[4] = { &P->x, &P->y, &P->pesos, &P->mantisas };
+    for (int a = 0; a < 4; a++)
+    {
+        double *nuevo = (double *)realloc(*arreglos[a], (size_t)capacidad * sizeof(double));
+        if (nuevo == NULL)
+            return 1;
+        *arreglos[a] = nuevo;
+    }
+    int *exponentes = (int *)realloc(P->exponentes, (size_t)capacidad * sizeof(int));
+    if (exponentes == NULL)
+        return 1;
+    P->exponentes = exponentes;
+    P->capacidad = capacidad;
+    return 0;
+}
+
+int crearInterpoladorBaricentrico(InterpoladorBaricentrico *P, const double *x, const double *y, int n)
+{
+    P->x = P->y = P->pesos = P->mantisas = NULL;
+    P->exponentes = NULL;
+    P->n = 0;
+    P->capacidad = 0;
+    P->exponente_escala = 0;
+
+    // Misma actualización que agregar los nodos de a uno: O(n²) en total
+    for (int k = 0; k < n; k++)
+    {
+        if (agregarNodoBaricentrico(P, x[k], y[k]) != 0)
+        {
+            liberarInterpoladorBaricentrico(P);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int agregarNodoBaricentrico(InterpoladorBaricentrico *P, double x, double y)
+{
+    for (int k = 0; k < P->n; k++)
+    {
+        if (P->x[k] == x)
+        {
+            printf("[ERROR] El nodo x = %g está repetido (x_%d); los nodos deben ser distintos.\n", x, k);
+            return 1;
+        }
+    }
+    if (P->n == P->capacidad && agrandarInterpolador(P) != 0)
+    {
+        printf("[ERROR] No se pudo asignar memoria para el interpolador baricéntrico.\n");
+        return 1;
+    }
+
+    // Cada peso anterior gana el factor 1 / (x_k - x), y el nuevo es 1 / Π (x - x_k).
+    // Con mantisa y exponente separados ningún producto intermedio se desborda
+    double mantisa = 1.0;
+    int exponente = 0;
+    for (int k = 0; k < P->n; k++)
+    {
+        int e;
+        mantisa = frexp(mantisa * (x - P->x[k]), &e);
+        exponente += e;
+
+        P->mantisas[k] = frexp(P->mantisas[k] / (P->x[k] - x), &e);
+        P->exponentes[k] += e;
+    }
+
+    int e;
+    P->x[P->n] = x;
+    P->y[P->n] = y;
+    P->mantisas[P->n] = frexp(1.0 / mantisa, &e);
+    P->exponentes[P->n] = e - exponente;
+    P->n++;
+    reescalarPesos(P);
+    return 0;
+}
+
+double evaluarBaricentrico(const InterpoladorBaricentrico *P, double x)
+{
+    if (P->n == 0)
+        return NAN;
+
+    double numerador = 0.0, denominador = 0.0;
+    for (int k = 0; k < P->n; k++)
+    {
+        double t = P->pesos[k] / (x - P->x[k]);
+        numerador += t * P->y[k];
+        denominador += t;
+    }
+    double valor = numerador / denominador;
+
+    // Sólo en un nodo (división por cero) el cociente no es finito
+    if (!isfinite(valor))
+    {
+        for (int k = 0; k < P->n; k++)
+            if (P->x[k] == x)
+                return P->y[k];
+    }
+    return valor;
+}
+
+void evaluarBaricentricoVector(const InterpoladorBaricentrico *P, const double *xs, double *px, int m)
+{
+    for (int inicio = 0; inicio < m; inicio += BLOQUE_BARICENTRICO)
+    {
+        int b = (m - inicio < BLOQUE_BARICENTRICO) ? m - inicio : BLOQUE_BARICENTRICO;
+        double numerador[BLOQUE_BARICENTRICO] = { 0.0 };
+        double denominador[BLOQUE_BARICENTRICO] = { 0.0 };
+        const double *x = xs + inicio;
+
+        for (int k = 0; k < P->n; k++)
+        {
+            double xk = P->x[k], wk = P->pesos[k], yk = P->y[k];
+            for (int p = 0; p < b; p++)
+            {
+                double t = wk / (x[p] - xk);
+                numerador[p] += t * yk;
+                denominador[p] += t;
+            }
+        }
+
+        // Se escribe después de leer todo el bloque: px puede ser xs
+        for (int p = 0; p < b; p++)
+        {
+            double valor = numerador[p] / denominador[p];
+            px[inicio + p] = isfinite(valor) ? valor : evaluarBaricentrico(P, x[p]);
+        }
+    }
+}
+
+double denominadorBaricentrico(const InterpoladorBaricentrico *P, double x, int *nodo)
+{
+    double denominador = 0.0;
+    *nodo = -1;
+    for (int k = 0; k < P->n; k++)
+    {
+        double d = x - P->x[k];
+        if (d == 0.0)
+        {
+            *nodo = k;
+            return NAN;
+        }
+        denominador += P->pesos[k] / d;
+    }
+    return denominador;
+}
+
+double baseLagrangeBaricentrica(const InterpoladorBaricentrico *P, int k, double x)
+{
+    int nodo;
+    double denominador = denominadorBaricentrico(P, x, &nodo);
+    if (nodo >= 0)
+        return (nodo == k) ? 1.0 : 0.0;
+    return P->pesos[k] / (x - P->x[k]) / denominador;
+}
+
+void liberarInterpoladorBaricentrico(InterpoladorBaricentrico *P)
+{
+    free(P->x);
+    free(P->y);
+    free(P->pesos);
+    free(P->mantisas);
+    free(P->exponentes);
+    P->x = P->y = P->pesos = P->mantisas = NULL;
+    P->exponentes = NULL;
+    P->n = 0;
+    P->capacidad = 0;
+    P->exponente_escala = 0;
+}
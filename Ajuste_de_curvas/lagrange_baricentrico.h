@@ -0,0 +1,100 @@
+/**
+ * @file lagrange_baricentrico.h
+ * @brief Polinomio interpolador de Lagrange en forma baricéntrica.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * La forma de Lagrange P(x) = Σ y_k L_k(x) cuesta O(n²) por punto si cada L_k se
+ * arma desde cero. La forma baricéntrica ("segunda forma")
+ *
+ *            Σ_k  w_k y_k / (x - x_k)
+ *   P(x) = ----------------------------,     w_k = 1 / Π_{j≠k} (x_k - x_j)
+ *            Σ_k  w_k / (x - x_k)
+ *
+ * usa pesos w_k que sólo dependen de los nodos: se calculan una vez en O(n²) y
+ * luego cada evaluación cuesta O(n). Agregar un nodo cuesta O(n) (se actualizan
+ * los pesos existentes y se calcula el nuevo). Cada w_k se guarda como mantisa y
+ * exponente, así los productos no se desbordan aunque haya miles de nodos; como
+ * la fórmula es invariante si todos los pesos se multiplican por la misma
+ * constante, para evaluar se usan reescalados (el mayor |w_k| entre 1/2 y 1).
+ *
+ * Uso:
+ *   InterpoladorBaricentrico P;
+ *   crearInterpoladorBaricentrico(&P, x_puntos, y_puntos, n);
+ *   double y = evaluarBaricentrico(&P, 0.5);
+ *   agregarNodoBaricentrico(&P, 2.5, 7.0);
+ *   evaluarBaricentricoVector(&P, xs, ys, m);
+ *   liberarInterpoladorBaricentrico(&P);
+ */
+#ifndef LAGRANGE_BARICENTRICO_H
+#define LAGRANGE_BARICENTRICO_H
+
+#define BLOQUE_BARICENTRICO 8 // Puntos que evaluarBaricentricoVector() evalúa juntos
+
+/**
+ * @brief Nodos, valores y pesos baricéntricos de un polinomio interpolador.
+ */
+typedef struct
+{
+    double *x;          // Nodos (distintos entre sí, en cualquier orden)
+    double *y;          // Valores en los nodos
+    double *pesos;      // w_k reescalados: pesos[k] = w_k * 2^exponente_escala
+    double *mantisas;   // w_k = mantisas[k] * 2^exponentes[k], |mantisas[k]| en [1/2, 1)
+    int *exponentes;
+    int n;              // Cantidad de nodos
+    int capacidad;      // Nodos reservados (crece al agregar nodos)
+    int exponente_escala;
+} InterpoladorBaricentrico;
+
+/**
+ * @brief Crea el interpolador de los n puntos (x_k, y_k) y calcula sus pesos en O(n²).
+ * @param P Interpolador (salida).
+ * @param x Nodos (se copian). Pueden ser NULL si n = 0.
+ * @param y Valores en los nodos (se copian).
+ * @param n Cantidad de puntos (>= 0).
+ * @return 0 si todo salió bien, 1 si hay nodos repetidos o error de memoria
+ *         (se informa con [ERROR] y P queda vacío).
+ */
+int crearInterpoladorBaricentrico(InterpoladorBaricentrico *P, const double *x, const double *y, int n);
+
+/**
+ * @brief Agrega el nodo (x, y) en O(n): divide cada w_k por (x_k - x) y calcula el nuevo peso.
+ * @return 0 si todo salió bien, 1 si x ya es un nodo o falta memoria (P no cambia).
+ */
+int agregarNodoBaricentrico(InterpoladorBaricentrico *P, double x, double y);
+
+/**
+ * @brief Evalúa P(x) en O(n). En un nodo devuelve exactamente su y_k.
+ * @return P(x), o NAN si el interpolador no tiene nodos.
+ */
+double evaluarBaricentrico(const InterpoladorBaricentrico *P, double x);
+
+/**
+ * @brief Evalúa P en m puntos: px[i] = P(xs[i]).
+ * @details Recorre los nodos una vez por cada bloque de BLOQUE_BARICENTRICO
+ *          puntos; el bucle interno sobre los puntos del bloque es independiente
+ *          y el compilador lo vectoriza. Cada punto suma los nodos en el mismo
+ *          orden que evaluarBaricentrico(). px puede ser el mismo arreglo que xs.
+ */
+void evaluarBaricentricoVector(const InterpoladorBaricentrico *P, const double *xs, double *px, int m);
+
+/**
+ * @brief Denominador D(x) = Σ_k w_k / (x - x_k), con los pesos reescalados.
+ * @details Con D(x), cada polinomio base es L_k(x) = (w_k / (x - x_k)) / D(x):
+ *          las n bases en un punto cuestan O(n) en lugar de O(n²).
+ * @param nodo Salida: índice del nodo si x coincide con uno (D no está definido,
+ *             L_k(x) = 1 si k = nodo y 0 si no), o -1.
+ */
+double denominadorBaricentrico(const InterpoladorBaricentrico *P, double x, int *nodo);
+
+/**
+ * @brief Polinomio base L_k(x) (vale 1 en x_k y 0 en los demás nodos), en O(n).
+ */
+double baseLagrangeBaricentrica(const InterpoladorBaricentrico *P, int k, double x);
+
+/**
+ * @brief Libera la memoria del interpolador.
+ */
+void liberarInterpoladorBaricentrico(InterpoladorBaricentrico *P);
+
+#endif // LAGRANGE_BARICENTRICO_H
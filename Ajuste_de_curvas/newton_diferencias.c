@@ -0,0 +1,136 @@
+/**
+ * @file newton_diferencias.c
+ * @brief Implementación del polinomio interpolador de Newton con diferencias divididas.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Tabla de diferencias divididas (cada columna sale de la anterior):
+ *
+ *   x_0  y_0
+ *                f[x_0,x_1]
+ *   x_1  y_1                 f[x_0,x_1,x_2]
+ *                f[x_1,x_2]                   ...
+ *   x_2  y_2                 f[x_1,x_2,x_3]
+ *                f[x_2,x_3]
+ *   x_3  y_3
+ *
+ * Los coeficientes son la diagonal superior. Al agregar x_n sólo hace falta la
+ * diagonal inferior (la última fila de cada columna):
+ *
+ *   f[x_j, ..., x_n] = (f[x_{j+1}, ..., x_n] - f[x_j, ..., x_{n-1}]) / (x_n - x_j)
+ *
+ * para j = n-1, ..., 0, empezando por f[x_n] = y_n; el último es c_n.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "newton_diferencias.h"
+
+/* Duplica la capacidad. Si falla alguna reserva los arreglos ya agrandados siguen siendo válidos */
+static int agrandarInterpoladorNewton(InterpoladorNewton *N)
+{
+    int capacidad = N->capacidad > 0 ? 2 * N->capacidad : 8;
+    double **arreglos[3] = { &N->x, &N->coeficientes, &N->diagonal };
+    for (int a = 0; a < 3; a++)
+    {
+        double *nuevo = (double *)realloc(*arreglos[a], (size_t)capacidad * sizeof(double));
+        if (nuevo == NULL)
+            return 1;
+        *arreglos[a] = nuevo;
+    }
+    N->capacidad = capacidad;
+    return 0;
+}
+
+int crearInterpoladorNewton(InterpoladorNewton *N, const double *x, const double *y, int n)
+{
+    N->x = N->coeficientes = N->diagonal = NULL;
+    N->n = 0;
+    N->capacidad = 0;
+
+    // Agregar los nodos de a uno recorre la tabla por diagonales: O(n²) en total
+    for (int k = 0; k < n; k++)
+    {
+        if (agregarNodoNewton(N, x[k], y[k]) != 0)
+        {
+            liberarInterpoladorNewton(N);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int agregarNodoNewton(InterpoladorNewton *N, double x, double y)
+{
+    for (int k = 0; k < N->n; k++)
+    {
+        if (N->x[k] == x)
+        {
+            printf("[ERROR] El nodo x = %g está repetido (x_%d); los nodos deben ser distintos.\n", x, k);
+            return 1;
+        }
+    }
+    if (N->n == N->capacidad && agrandarInterpoladorNewton(N) != 0)
+    {
+        printf("[ERROR] No se pudo asignar memoria para el interpolador de Newton.\n");
+        return 1;
+    }
+
+    // Nueva diagonal en el lugar: diagonal[j] pasa de f[x_j..x_{n-1}] a f[x_j..x_n]
+    int n = N->n;
+    double siguiente = y; // f[x_{j+1}, ..., x_n]
+    for (int j = n - 1; j >= 0; j--)
+    {
+        double actual = (siguiente - N->diagonal[j]) / (x - N->x[j]);
+        N->diagonal[j + 1] = siguiente;
+        siguiente = actual;
+    }
+    N->diagonal[0] = siguiente;
+
+    N->x[n] = x;
+    N->coeficientes[n] = siguiente; // f[x_0, ..., x_n]
+    N->n++;
+    return 0;
+}
+
+double evaluarNewton(const InterpoladorNewton *N, double x)
+{
+    if (N->n == 0)
+        return NAN;
+
+    double valor = N->coeficientes[N->n - 1];
+    for (int k = N->n - 2; k >= 0; k--)
+        valor = valor * (x - N->x[k]) + N->coeficientes[k];
+    return valor;
+}
+
+void coeficientesMonomiosNewton(const InterpoladorNewton *N, double *a)
+{
+    int n = N->n;
+    if (n == 0)
+        return;
+
+    // Horner sobre polinomios: a(x) <- a(x) * (x - x_k) + c_k, de k = n-2 a 0.
+    // Con grado g = n-2-k antes del paso, a[0..g] pasa a a[0..g+1]
+    for (int i = 0; i < n; i++)
+        a[i] = 0.0;
+    a[0] = N->coeficientes[n - 1];
+    for (int k = n - 2; k >= 0; k--)
+    {
+        int grado = n - 2 - k;
+        a[grado + 1] = a[grado];
+        for (int i = grado; i > 0; i--)
+            a[i] = a[i - 1] - N->x[k] * a[i];
+        a[0] = -N->x[k] * a[0] + N->coeficientes[k];
+    }
+}
+
+void liberarInterpoladorNewton(InterpoladorNewton *N)
+{
+    free(N->x);
+    free(N->coeficientes);
+    free(N->diagonal);
+    N->x = N->coeficientes = N->diagonal = NULL;
+    N->n = 0;
+    N->capacidad = 0;
+}
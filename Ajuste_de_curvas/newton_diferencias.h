@@ -0,0 +1,78 @@
+/**
+ * @file newton_diferencias.h
+ * @brief Polinomio interpolador en forma de Newton (diferencias divididas), con nodos incrementales.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Forma de Newton del polinomio que interpola (x_0, y_0), ..., (x_{n-1}, y_{n-1}):
+ *
+ *   P(x) = c_0 + c_1 (x - x_0) + c_2 (x - x_0)(x - x_1) + ... + c_{n-1} Π_{k<n-1} (x - x_k)
+ *
+ * con c_k = f[x_0, ..., x_k] (diferencias divididas). Armar la tabla cuesta
+ * O(n²), en lugar del O(n³) del sistema de Vandermonde (que además está muy mal
+ * condicionado), y P(x) se evalúa en O(n) con el esquema de Horner anidado:
+ *
+ *   P(x) = c_0 + (x - x_0) (c_1 + (x - x_1) (c_2 + ... + (x - x_{n-2}) c_{n-1}))
+ *
+ * Además de los coeficientes se guarda la última diagonal de la tabla,
+ * f[x_j, ..., x_{n-1}] para j = 0..n-1: con ella un nodo nuevo cuesta O(n) y no
+ * cambia los coeficientes anteriores (sirve para datos que llegan de a uno).
+ *
+ * Uso:
+ *   InterpoladorNewton N;
+ *   crearInterpoladorNewton(&N, x_puntos, y_puntos, n);
+ *   double y = evaluarNewton(&N, 0.5);
+ *   agregarNodoNewton(&N, 2.5, 7.0);    // P pasa a tener grado n
+ *   liberarInterpoladorNewton(&N);
+ */
+#ifndef NEWTON_DIFERENCIAS_H
+#define NEWTON_DIFERENCIAS_H
+
+/**
+ * @brief Nodos y diferencias divididas del polinomio de Newton.
+ */
+typedef struct
+{
+    double *x;              // Nodos en el orden en que se agregaron (distintos entre sí)
+    double *coeficientes;   // coeficientes[k] = f[x_0, ..., x_k]
+    double *diagonal;       // diagonal[j] = f[x_j, ..., x_{n-1}] (diagonal[n-1] = y_{n-1})
+    int n;                  // Cantidad de nodos (el grado es n - 1)
+    int capacidad;          // Nodos reservados (crece al agregar nodos)
+} InterpoladorNewton;
+
+/**
+ * @brief Crea el interpolador de los n puntos (x_k, y_k): tabla de diferencias en O(n²).
+ * @param N Interpolador (salida).
+ * @param x Nodos (se copian). Pueden ser NULL si n = 0.
+ * @param y Valores en los nodos.
+ * @param n Cantidad de puntos (>= 0).
+ * @return 0 si todo salió bien, 1 si hay nodos repetidos o error de memoria
+ *         (se informa con [ERROR] y N queda vacío).
+ */
+int crearInterpoladorNewton(InterpoladorNewton *N, const double *x, const double *y, int n);
+
+/**
+ * @brief Agrega el nodo (x, y) en O(n): una nueva diagonal de la tabla y el coeficiente c_n.
+ * @return 0 si todo salió bien, 1 si x ya es un nodo o falta memoria (N no cambia).
+ */
+int agregarNodoNewton(InterpoladorNewton *N, double x, double y);
+
+/**
+ * @brief Evalúa P(x) con Horner anidado, en O(n).
+ * @return P(x), o NAN si el interpolador no tiene nodos.
+ */
+double evaluarNewton(const InterpoladorNewton *N, double x);
+
+/**
+ * @brief Coeficientes de P en la base de monomios: P(x) = Σ a[i] x^i, en O(n²).
+ * @details Para mostrar el polinomio; evaluar con evaluarNewton() es más preciso.
+ * @param a Salida, N->n elementos (a[i] es el coeficiente de x^i).
+ */
+void coeficientesMonomiosNewton(const InterpoladorNewton *N, double *a);
+
+/**
+ * @brief Libera la memoria del interpolador.
+ */
+void liberarInterpoladorNewton(InterpoladorNewton *N);
+
+#endif // NEWTON_DIFERENCIAS_H
@@ -29,13 +29,18 @@
  *   [   ...       ...     ...     ...  ] [...] = [  ...  ]
  *   [Σ(φₘ·φ₁)  Σ(φₘ·φ₂)  ...  Σ(φₘ·φₘ)] [aₘ]   [Σ(φₘ·y)]
  * 
- * Este sistema se resuelve usando eliminación Gaussiana con pivoteo parcial.
+ * La matriz es simétrica (Σ(φᵢ·φⱼ) = Σ(φⱼ·φᵢ)) y semidefinida positiva, por lo que
+ * se arma sólo su triángulo inferior y se resuelve con la factorización de
+ * Cholesky, o con LDLᵀ si las funciones base son linealmente dependientes sobre
+ * los datos (la solución deja de ser única). Ver resolverDetectandoSimetria().
  * =================================================================================
  */
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include "../Sistema_Ecuaciones_Lineales/matriz_densa/matriz_densa.h"
+#include "../Sistema_Ecuaciones_Lineales/factorizacion_cholesky/factorizacion_cholesky.h"
 
 #define MAX_FUNCIONES 10
 #define MAX_NOMBRE 100
@@ -56,17 +61,16 @@ typedef struct {
  */
 void leerDatos(const char *filename, double **x, double **y, int *n);
 
-/**
- * @brief Resuelve un sistema de ecuaciones lineales usando Gauss con pivoteo parcial.
- */
-void resolverSistema(double **A, double *b, int n, double *solucion);
-
 /**
  * @brief Construye el sistema de ecuaciones normales para regresión múltiple.
+ * @details Evalúa cada función base una sola vez por punto y, como A es
+ *          simétrica, calcula sólo el triángulo inferior y lo copia al superior.
+ * @param A Matriz n_func x n_func (salida).
+ * @param b Vector de n_func elementos (salida).
  */
 void construirSistemaNormal(double *x_datos, double *y_datos, int n_datos,
                            InfoFuncion *funciones, int n_func,
-                           double **A, double *b);
+                           MatrizDensa *A, double *b);
 
 /**
  * @brief Muestra el menú de funciones base predefinidas.
@@ -175,20 +179,20 @@ int main(void)
     // PASO 4: Construir y resolver el sistema de ecuaciones normales
     printf("\n--- PASO 4: Sistema de ecuaciones normales ---\n");
     
-    double **A = (double **)malloc(n_func * sizeof(double *));
-    for (int i = 0; i < n_func; i++) {
-        A[i] = (double *)malloc(n_func * sizeof(double));
+    MatrizDensa A;
+    if (crearMatrizDensa(&A, n_func, n_func) != 0) {
+        exit(1);
     }
     double *b_vec = (double *)malloc(n_func * sizeof(double));
     double *coeficientes = (double *)malloc(n_func * sizeof(double));
     
-    construirSistemaNormal(x_datos, y_datos, n_datos, funciones, n_func, A, b_vec);
+    construirSistemaNormal(x_datos, y_datos, n_datos, funciones, n_func, &A, b_vec);
     
     printf("\nMatriz A (%dx%d):\n", n_func, n_func);
     for (int i = 0; i < n_func; i++) {
         printf("  [");
         for (int j = 0; j < n_func; j++) {
-            printf("%12.4f ", A[i][j]);
+            printf("%12.4f ", MD(&A, i, j));
         }
         printf("]\n");
     }
@@ -199,9 +203,20 @@ int main(void)
     }
     printf("]\n");
     
-    // Resolver el sistema
-    printf("\nResolviendo sistema con Gauss-Jordan...\n");
-    resolverSistema(A, b_vec, n_func, coeficientes);
+    // Resolver el sistema: A es simétrica, se usa Cholesky (o LDLᵀ si es semidefinida)
+    MetodoFactorizacion metodo = FACTORIZACION_CHOLESKY;
+    double det = 0.0;
+    EstadoSolver estado = resolverDetectandoSimetria(&A, b_vec, coeficientes, &det, &metodo);
+    if (estado != SOLVER_OK) {
+        printf("[ERROR] No se pudo resolver el sistema de ecuaciones normales (%s).\n",
+               nombreEstadoSolver(estado));
+        exit(1);
+    }
+    printf("\nSistema resuelto con %s.\n", nombreMetodoFactorizacion(metodo));
+    if (metodo == FACTORIZACION_LDLT && det == 0.0) {
+        printf("[ADVERTENCIA] Las funciones base son linealmente dependientes sobre los datos:\n");
+        printf("              los coeficientes no son únicos (se muestra una de las soluciones).\n");
+    }
     
     // PASO 5: Mostrar resultados
     printf("\n=============================================================\n");
@@ -268,10 +283,7 @@ int main(void)
         free(phi[i]);
     }
     free(phi);
-    for (int i = 0; i < n_func; i++) {
-        free(A[i]);
-    }
-    free(A);
+    liberarMatrizDensa(&A);
     free(b_vec);
     free(coeficientes);
     free(x_datos);
@@ -309,84 +321,44 @@ void leerDatos(const char *filename, double **x, double **y, int *n)
 
 void construirSistemaNormal(double *x_datos, double *y_datos, int n_datos,
                            InfoFuncion *funciones, int n_func,
-                           double **A, double *b)
+                           MatrizDensa *A, double *b)
 {
+    double phi[MAX_FUNCIONES];
+
     // Inicializar matrices
     for (int i = 0; i < n_func; i++) {
         b[i] = 0.0;
         for (int j = 0; j < n_func; j++) {
-            A[i][j] = 0.0;
+            MD(A, i, j) = 0.0;
         }
     }
     
     // Construir el sistema: A[i][j] = Σ(φᵢ(xₖ)·φⱼ(xₖ)), b[i] = Σ(φᵢ(xₖ)·yₖ)
     for (int k = 0; k < n_datos; k++) {
-        double x = x_datos[k];
         double y = y_datos[k];
+
+        // Cada φᵢ(xₖ) se evalúa una sola vez
+        for (int i = 0; i < n_func; i++) {
+            phi[i] = funciones[i].funcion(x_datos[k]);
+        }
         
         for (int i = 0; i < n_func; i++) {
-            double phi_i = funciones[i].funcion(x);
-            b[i] += phi_i * y;
+            double *fila = filaMatrizDensa(A, i);
+            b[i] += phi[i] * y;
             
-            for (int j = 0; j < n_func; j++) {
-                double phi_j = funciones[j].funcion(x);
-                A[i][j] += phi_i * phi_j;
+            // Sólo el triángulo inferior (j <= i)
+            for (int j = 0; j <= i; j++) {
+                fila[j] += phi[i] * phi[j];
             }
         }
     }
-}
 
-void resolverSistema(double **A, double *b, int n, double *solucion)
-{
-    // Gauss-Jordan con pivoteo parcial
-    for (int i = 0; i < n; i++) {
-        // Encontrar el pivote
-        int max_fila = i;
-        for (int k = i + 1; k < n; k++) {
-            if (fabs(A[k][i]) > fabs(A[max_fila][i])) {
-                max_fila = k;
-            }
-        }
-        
-        // Intercambiar filas si es necesario
-        if (max_fila != i) {
-            double *temp = A[i];
-            A[i] = A[max_fila];
-            A[max_fila] = temp;
-            
-            double temp_b = b[i];
-            b[i] = b[max_fila];
-            b[max_fila] = temp_b;
-        }
-        
-        // Verificar que el pivote no sea cero
-        if (fabs(A[i][i]) < 1e-12) {
-            printf("[ADVERTENCIA] Pivote muy pequeño en fila %d: %.2e\n", i, A[i][i]);
-        }
-        
-        // Normalizar la fila del pivote
-        double pivote = A[i][i];
-        for (int j = i; j < n; j++) {
-            A[i][j] /= pivote;
-        }
-        b[i] /= pivote;
-        
-        // Eliminar en las demás filas
-        for (int k = 0; k < n; k++) {
-            if (k != i) {
-                double factor = A[k][i];
-                for (int j = i; j < n; j++) {
-                    A[k][j] -= factor * A[i][j];
-                }
-                b[k] -= factor * b[i];
-            }
+    // Completar el triángulo superior por simetría
+    for (int i = 0; i < n_func; i++) {
+        for (int j = 0; j < i; j++) {
+            MD(A, j, i) = MD(A, i, j);
         }
     }
-    
-    // Copiar solución
-    for (int i = 0; i < n; i++) {
-        solucion[i] = b[i];
-    }
 }
 
 int menuFuncionesPredefinidas(InfoFuncion *funciones)
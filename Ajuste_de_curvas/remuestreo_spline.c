@@ -0,0 +1,268 @@
+/**
+ * @file remuestreo_spline.c
+ * @brief Implementación del remuestreo en paralelo y de la escritura de tablas en buffers.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "remuestreo_spline.h"
+
+/* ---------------------------- Remuestreo ---------------------------- */
+
+typedef struct
+{
+    const SplineCubico *S;
+    double a, paso;
+    int m;
+    double *x, *y;
+} ContextoRemuestreo;
+
+static void remuestrearBloque(void *contexto, int id_hilo, int num_hilos)
+{
+    ContextoRemuestreo *c = (ContextoRemuestreo *)contexto;
+    int inicio, fin;
+    rangoHilo(c->m, id_hilo, num_hilos, &inicio, &fin);
+    for (int i = inicio; i < fin; i++)
+        c->x[i] = c->a + i * c->paso;
+    evaluarSplineCubicoOrdenado(c->S, c->x + inicio, c->y + inicio, fin - inicio);
+}
+
+void remuestrearSplineEquiespaciado(const SplineCubico *S, double a, double paso, int m,
+                                    double *x, double *y, PoolHilos *pool)
+{
+    ContextoRemuestreo contexto = { S, a, paso, m, x, y };
+    if (pool != NULL)
+        ejecutarEnPool(pool, remuestrearBloque, &contexto);
+    else
+        remuestrearBloque(&contexto, 0, 1);
+}
+
+/* ---------------------------- Formato ---------------------------- */
+
+static const double potencias10[DECIMALES_MAX + 1] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+    1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17
+};
+
+int formatearDecimal(double valor, int decimales, char *destino)
+{
+    if (decimales < 0)
+        decimales = 0;
+    if (decimales > DECIMALES_MAX)
+        decimales = DECIMALES_MAX;
+
+    // Camino rápido si |valor|·10^d < 2^52: el entero y el medio (r + 0.5) son
+    // exactos en double. Si no (o NaN / infinito), printf
+    double escala = potencias10[decimales];
+    double absoluto = fabs(valor);
+    if (!(absoluto * escala < 4e15))
+        return snprintf(destino, LARGO_MAX_DECIMAL, "%.*f", decimales, valor);
+
+    // r = piso(|valor|·10^d) exacto: fma calcula |valor|·10^d - r con un solo redondeo,
+    // que conserva el signo. El producto redondeado puede haber cruzado un entero
+    unsigned long long r = (unsigned long long)(absoluto * escala);
+    while (r > 0 && fma(absoluto, escala, -(double)r) < 0.0)
+        r--;
+    while (fma(absoluto, escala, -(double)(r + 1)) >= 0.0)
+        r++;
+    // Redondeo al más cercano y, en el empate exacto, al par (como printf)
+    double resto = fma(absoluto, escala, -((double)r + 0.5));
+    if (resto > 0.0 || (resto == 0.0 && (r & 1)))
+        r++;
+
+    char *s = destino;
+    if (signbit(valor))
+        *s++ = '-'; // printf también escribe "-0.0000"
+    unsigned long long divisor = (unsigned long long)escala;
+    unsigned long long entera = r / divisor;
+    unsigned long long fraccion = r % divisor;
+
+    char digitos[24];
+    int k = 0;
+    do
+    {
+        digitos[k++] = (char)('0' + entera % 10);
+        entera /= 10;
+    } while (entera > 0);
+    while (k > 0)
+        *s++ = digitos[--k];
+
+    if (decimales > 0)
+    {
+        *s++ = '.';
+        for (int j = decimales - 1; j >= 0; j--)
+        {
+            s[j] = (char)('0' + fraccion % 10);
+            fraccion /= 10;
+        }
+        s += decimales;
+    }
+    *s = '\0';
+    return (int)(s - destino);
+}
+
+static int formatearEntero(int valor, char *destino)
+{
+    char digitos[12];
+    int k = 0;
+    unsigned int u = (valor < 0) ? 0u - (unsigned int)valor : (unsigned int)valor;
+    do
+    {
+        digitos[k++] = (char)('0' + u % 10);
+        u /= 10;
+    } while (u > 0);
+    char *s = destino;
+    if (valor < 0)
+        *s++ = '-';
+    while (k > 0)
+        *s++ = digitos[--k];
+    return (int)(s - destino);
+}
+
+/* ---------------------------- Escritura ---------------------------- */
+
+typedef struct
+{
+    char *datos;
+    size_t usado;
+    size_t capacidad;
+    int error;
+} BufferTexto;
+
+typedef struct
+{
+    int inicio, fin;    // Filas de la ronda actual
+    int num_columnas;
+    const double *const *columnas;
+    const int *decimales;
+    char separador;
+    BufferTexto *buffers;   // Uno por hilo
+} ContextoFormato;
+
+static void formatearBloque(void *contexto, int id_hilo, int num_hilos)
+{
+    ContextoFormato *c = (ContextoFormato *)contexto;
+    BufferTexto *buffer = &c->buffers[id_hilo];
+    int inicio, fin;
+    rangoHilo(c->fin - c->inicio, id_hilo, num_hilos, &inicio, &fin);
+    inicio += c->inicio;
+    fin += c->inicio;
+
+    // Peor caso de una fila: todas las columnas por snprintf
+    size_t fila_maxima = (size_t)c->num_columnas * LARGO_MAX_DECIMAL + 1;
+    buffer->usado = 0;
+    for (int i = inicio; i < fin; i++)
+    {
+        if (buffer->usado + fila_maxima > buffer->capacidad)
+        {
+            size_t capacidad = 2 * buffer->capacidad + fila_maxima;
+            char *nuevo = (char *)realloc(buffer->datos, capacidad);
+            if (nuevo == NULL)
+            {
+                buffer->error = 1;
+                return;
+            }
+            buffer->datos = nuevo;
+            buffer->capacidad = capacidad;
+        }
+        char *s = buffer->datos + buffer->usado;
+        for (int col = 0; col < c->num_columnas; col++)
+        {
+            if (col > 0)
+                *s++ = c->separador;
+            if (c->columnas[col] == NULL)
+                s += formatearEntero(i, s);
+            else
+                s += formatearDecimal(c->columnas[col][i], c->decimales[col], s);
+        }
+        *s++ = '\n';
+        buffer->usado = (size_t)(s - buffer->datos);
+    }
+}
+
+int escribirColumnasTexto(FILE *archivo, int m, int num_columnas, const double *const *columnas,
+                          const int *decimales, char separador, PoolHilos *pool)
+{
+    int num_hilos = (pool != NULL) ? numHilosPool(pool) : 1;
+    BufferTexto *buffers = (BufferTexto *)calloc(num_hilos, sizeof(BufferTexto));
+    if (buffers == NULL)
+    {
+        printf("[ERROR] No se pudo asignar memoria para escribir la tabla.\n");
+        return 1;
+    }
+
+    // Capacidad inicial para FILAS_POR_RONDA filas por el camino rápido: signo,
+    // 16 dígitos, punto, decimales y separador por columna
+    size_t fila_tipica = 1;
+    for (int col = 0; col < num_columnas; col++)
+        fila_tipica += 19 + (size_t)(decimales[col] > 0 ? decimales[col] : 0);
+    for (int h = 0; h < num_hilos; h++)
+    {
+        buffers[h].capacidad = FILAS_POR_RONDA * fila_tipica + (size_t)num_columnas * LARGO_MAX_DECIMAL + 1;
+        buffers[h].datos = (char *)malloc(buffers[h].capacidad);
+        if (buffers[h].datos == NULL)
+            buffers[h].error = 1;
+    }
+
+    ContextoFormato contexto = { 0, 0, num_columnas, columnas, decimales, separador, buffers };
+    int resultado = 0;
+    int filas_ronda = FILAS_POR_RONDA * num_hilos;
+    for (int inicio = 0; inicio < m && resultado == 0; inicio += filas_ronda)
+    {
+        contexto.inicio = inicio;
+        contexto.fin = (m - inicio > filas_ronda) ? inicio + filas_ronda : m;
+        for (int h = 0; h < num_hilos; h++)
+            if (buffers[h].error)
+                resultado = 1;
+        if (resultado != 0)
+        {
+            printf("[ERROR] No se pudo asignar memoria para escribir la tabla.\n");
+            break;
+        }
+
+        if (pool != NULL)
+            ejecutarEnPool(pool, formatearBloque, &contexto);
+        else
+            formatearBloque(&contexto, 0, 1);
+
+        // Los bloques de los hilos son consecutivos: se escriben en orden
+        for (int h = 0; h < num_hilos && resultado == 0; h++)
+        {
+            if (buffers[h].error)
+            {
+                printf("[ERROR] No se pudo asignar memoria para escribir la tabla.\n");
+                resultado = 1;
+            }
+            else if (fwrite(buffers[h].datos, 1, buffers[h].usado, archivo) != buffers[h].usado)
+            {
+                printf("[ERROR] No se pudo escribir la tabla.\n");
+                resultado = 1;
+            }
+        }
+    }
+
+    for (int h = 0; h < num_hilos; h++)
+        free(buffers[h].datos);
+    free(buffers);
+    return resultado;
+}
+
+int escribirColumnasBinario(FILE *archivo, int m, int num_columnas, const double *const *columnas)
+{
+    for (int col = 0; col < num_columnas; col++)
+    {
+        if (columnas[col] == NULL)
+        {
+            printf("[ERROR] La columna %d no tiene datos.\n", col);
+            return 1;
+        }
+        if (fwrite(columnas[col], sizeof(double), (size_t)m, archivo) != (size_t)m)
+        {
+            printf("[ERROR] No se pudo escribir la tabla.\n");
+            return 1;
+        }
+    }
+    return 0;
+}
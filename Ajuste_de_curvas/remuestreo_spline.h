@@ -0,0 +1,89 @@
+/**
+ * @file remuestreo_spline.h
+ * @brief Remuestreo masivo de un spline en una grilla equiespaciada y escritura rápida de tablas.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Para regenerar tablas densas (millones de filas) el costo está en evaluar y,
+ * sobre todo, en escribir fila por fila con fprintf. Aquí:
+ *
+ *   - remuestrearSplineEquiespaciado() reparte los puntos en bloques contiguos
+ *     entre los hilos de un PoolHilos; cada hilo recorre sus tramos una sola vez
+ *     (evaluarSplineCubicoOrdenado).
+ *   - formatearDecimal() convierte un double a texto con d decimales sin pasar
+ *     por printf: escala a un entero, redondea con fma (mismo resultado que
+ *     "%.*f", incluido el redondeo al par en los empates exactos) y escribe los
+ *     dígitos. Los valores muy grandes, NaN e infinito van por snprintf.
+ *   - escribirColumnasTexto() formatea las filas en paralelo en buffers grandes,
+ *     un buffer por hilo, y los escribe en orden con fwrite.
+ *   - escribirColumnasBinario() guarda las columnas crudas (doubles de la máquina).
+ *
+ * Uso:
+ *   PoolHilos *pool = crearPoolHilos(0);             // un hilo por núcleo
+ *   remuestrearSplineEquiespaciado(&S, a, paso, m, x, y, pool);
+ *   const double *columnas[2] = { x, y };
+ *   int decimales[2] = { 4, 4 };
+ *   escribirColumnasTexto(archivo, m, 2, columnas, decimales, ' ', pool);
+ *   destruirPoolHilos(pool);
+ *
+ * Compilar con spline_cubico.c, ../Sistema_Ecuaciones_Lineales/pool_hilos/pool_hilos.c
+ * y -pthread.
+ */
+#ifndef REMUESTREO_SPLINE_H
+#define REMUESTREO_SPLINE_H
+
+#include <stdio.h>
+#include "spline_cubico.h"
+#include "../Sistema_Ecuaciones_Lineales/pool_hilos/pool_hilos.h"
+
+#define DECIMALES_MAX 17        // Decimales admitidos por formatearDecimal
+#define LARGO_MAX_DECIMAL 352   // Caracteres que puede ocupar un valor: signo, 309 dígitos, punto, decimales y '\0'
+#define FILAS_POR_RONDA 65536   // Filas que formatea cada hilo antes de escribir
+
+/**
+ * @brief y[i] = S(x[i]) con x[i] = a + i*paso, i = 0..m-1, repartido entre los hilos del pool.
+ * @details Cada hilo calcula un bloque contiguo de la grilla y lo evalúa con
+ *          evaluarSplineCubicoOrdenado(): O(n + m/hilos) por hilo. El resultado
+ *          es el mismo que con un solo hilo.
+ * @param S Spline a evaluar.
+ * @param a Primer punto de la grilla.
+ * @param paso Separación entre puntos.
+ * @param m Cantidad de puntos.
+ * @param x Abscisas (salida, m elementos).
+ * @param y Valores del spline (salida, m elementos).
+ * @param pool Pool de hilos; NULL evalúa en el hilo que llama.
+ */
+void remuestrearSplineEquiespaciado(const SplineCubico *S, double a, double paso, int m,
+                                    double *x, double *y, PoolHilos *pool);
+
+/**
+ * @brief Escribe valor con decimales cifras decimales, igual que sprintf("%.*f").
+ * @param decimales Entre 0 y DECIMALES_MAX (se recorta a ese rango).
+ * @param destino Al menos LARGO_MAX_DECIMAL caracteres; queda terminado en '\0'.
+ * @return Cantidad de caracteres escritos (sin contar el '\0').
+ */
+int formatearDecimal(double valor, int decimales, char *destino);
+
+/**
+ * @brief Escribe m filas de texto con num_columnas columnas, formateadas en paralelo.
+ * @details La fila i es columnas[0][i], ..., columnas[c-1][i] separadas por
+ *          separador y terminada en '\n'; la columna c usa decimales[c] cifras.
+ *          Si columnas[c] es NULL se escribe el número de fila i. Se procesan
+ *          FILAS_POR_RONDA filas por hilo en cada ronda, así que la memoria no
+ *          depende de m.
+ * @param archivo Archivo abierto para escritura (puede tener ya un encabezado).
+ * @param pool Pool de hilos; NULL formatea en el hilo que llama.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o de escritura (se informa con [ERROR]).
+ */
+int escribirColumnasTexto(FILE *archivo, int m, int num_columnas, const double *const *columnas,
+                          const int *decimales, char separador, PoolHilos *pool);
+
+/**
+ * @brief Escribe las columnas en binario: columnas[0][0..m-1], luego columnas[1][0..m-1], ...
+ * @details Doubles con la representación de la máquina, sin encabezado (m sale
+ *          del tamaño del archivo). Abrir el archivo en modo "wb".
+ * @return 0 si todo salió bien, 1 si alguna columna es NULL o falló la escritura.
+ */
+int escribirColumnasBinario(FILE *archivo, int m, int num_columnas, const double *const *columnas);
+
+#endif // REMUESTREO_SPLINE_H
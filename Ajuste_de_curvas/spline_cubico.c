@@ -0,0 +1,340 @@
+/**
+ * @file spline_cubico.c
+ * @brief Implementación del spline cúbico con coeficientes por tramo.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Con las segundas derivadas M_k = S''(x_k) y h = x_{k+1} - x_k, el tramo k es
+ *
+ *   a_k = y_k
+ *   b_k = (y_{k+1} - y_k) / h - h (2 M_k + M_{k+1}) / 6
+ *   c_k = M_k / 2
+ *   d_k = (M_{k+1} - M_k) / (6 h)
+ *
+ * y las M_k salen del sistema tridiagonal (continuidad de S' en los nodos)
+ *
+ *   h_{k-1} M_{k-1} + 2 (h_{k-1} + h_k) M_k + h_k M_{k+1} = 6 (Δ_k - Δ_{k-1}),  Δ_k = (y_{k+1} - y_k) / h_k
+ *
+ * para k = 1..n-2, más las dos filas de la condición de frontera:
+ *
+ *   natural:     M_0 = 0,                                M_{n-1} = 0
+ *   sujeta:      2 h_0 M_0 + h_0 M_1 = 6 (Δ_0 - S'_0),    h_{n-2} M_{n-2} + 2 h_{n-2} M_{n-1} = 6 (S'_{n-1} - Δ_{n-2})
+ *   not-a-knot:  d_0 = d_1,                              d_{n-3} = d_{n-2}
+ *   periódica:   la fila k = 0 con h_{-1} = h_{n-2}, Δ_{-1} = Δ_{n-2} y M_{-1} = M_{n-2}; M_{n-1} = M_0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "spline_cubico.h"
+#include "../Sistema_Ecuaciones_Lineales/matriz_banda/matriz_banda.h"
+
+/* ∫ S_k desde x_k hasta x_k + t */
+static double integralTramo(const double *c, double t)
+{
+    return t * (c[0] + t * (c[1] / 2.0 + t * (c[2] / 3.0 + t * c[3] / 4.0)));
+}
+
+/* En el spline periódico lleva x a [x_0, x_{n-1}] y cuenta los períodos restados */
+static double reducirPeriodo(const SplineCubico *S, double x, double *vueltas)
+{
+    double q = 0.0;
+    if (S->frontera == FRONTERA_PERIODICA && (x < S->x[0] || x > S->x[S->n - 1]))
+    {
+        double periodo = S->x[S->n - 1] - S->x[0];
+        q = floor((x - S->x[0]) / periodo);
+        x -= q * periodo;
+    }
+    if (vueltas != NULL)
+        *vueltas = q;
+    return x;
+}
+
+/* Coeficientes de cada tramo, integrales acumuladas y detección de nodos equiespaciados */
+static void completarSplineCubico(SplineCubico *S, const double *y, const double *M)
+{
+    int n = S->n;
+    S->integrales[0] = 0.0;
+    for (int k = 0; k < n - 1; k++)
+    {
+        double h = S->x[k + 1] - S->x[k];
+        double *c = S->coeficientes + 4 * k;
+        c[0] = y[k];
+        c[1] = (y[k + 1] - y[k]) / h - h * (2.0 * M[k] + M[k + 1]) / 6.0;
+        c[2] = M[k] / 2.0;
+        c[3] = (M[k + 1] - M[k]) / (6.0 * h);
+        S->integrales[k + 1] = S->integrales[k] + integralTramo(c, h);
+    }
+
+    double paso = (S->x[n - 1] - S->x[0]) / (n - 1);
+    S->uniforme = 1;
+    for (int k = 1; k < n - 1 && S->uniforme; k++)
+        if (fabs(S->x[k] - (S->x[0] + k * paso)) > TOLERANCIA_UNIFORME * paso)
+            S->uniforme = 0;
+    S->inverso_paso = 1.0 / paso;
+}
+
+int crearSplineCubico(SplineCubico *S, const double *x, const double *y, int n)
+{
+    return crearSplineCubicoFrontera(S, x, y, n, NULL);
+}
+
+int crearSplineCubicoFrontera(SplineCubico *S, const double *x, const double *y, int n,
+                              const CondicionFrontera *frontera)
+{
+    TipoFrontera tipo = (frontera != NULL) ? frontera->tipo : FRONTERA_NATURAL;
+    S->x = S->coeficientes = S->integrales = NULL;
+    S->n = 0;
+    S->frontera = tipo;
+    if (tipo < FRONTERA_NATURAL || tipo > FRONTERA_PERIODICA)
+    {
+        printf("[ERROR] Condición de frontera desconocida (%d).\n", (int)tipo);
+        return 1;
+    }
+    if (n < 2)
+    {
+        printf("[ERROR] Se necesitan al menos 2 puntos para splines cúbicos.\n");
+        return 1;
+    }
+    for (int k = 0; k < n - 1; k++)
+    {
+        if (!(x[k + 1] > x[k]))
+        {
+            printf("[ERROR] Los nodos deben ser estrictamente crecientes (x_%d = %g, x_%d = %g).\n",
+                   k, x[k], k + 1, x[k + 1]);
+            return 1;
+        }
+    }
+    if (tipo == FRONTERA_PERIODICA && fabs(y[n - 1] - y[0]) > TOLERANCIA_PERIODICA * fmax(1.0, fabs(y[0])))
+    {
+        printf("[ERROR] Frontera periódica: y_0 = %g e y_%d = %g deben coincidir.\n", y[0], n - 1, y[n - 1]);
+        return 1;
+    }
+
+    S->x = (double *)malloc(n * sizeof(double));
+    S->coeficientes = (double *)malloc(4 * (size_t)(n - 1) * sizeof(double));
+    S->integrales = (double *)malloc(n * sizeof(double));
+    // Las tres diagonales y M comparten un bloque de 4n
+    double *sistema = (double *)malloc(4 * (size_t)n * sizeof(double));
+    if (!S->x || !S->coeficientes || !S->integrales || !sistema)
+    {
+        printf("[ERROR] Falla de memoria al crear el sistema para splines cúbicos.\n");
+        free(sistema);
+        liberarSplineCubico(S);
+        return 1;
+    }
+    double *inferior = sistema, *diagonal = sistema + n, *superior = sistema + 2 * n, *M = sistema + 3 * n;
+
+    for (int k = 0; k < n; k++)
+        S->x[k] = x[k];
+    S->n = n;
+
+    // Filas interiores, comunes a todas las fronteras
+    for (int k = 1; k < n - 1; k++)
+    {
+        double h_ant = x[k] - x[k - 1];
+        double h_sig = x[k + 1] - x[k];
+        inferior[k] = h_ant;
+        diagonal[k] = 2.0 * (h_ant + h_sig);
+        superior[k] = h_sig;
+        M[k] = 6.0 * ((y[k + 1] - y[k]) / h_sig - (y[k] - y[k - 1]) / h_ant);
+    }
+    // Primera y última fila desacopladas (M_0 = M_{n-1} = 0) salvo que la frontera las cambie
+    inferior[0] = 0.0; diagonal[0] = 1.0; superior[0] = 0.0; M[0] = 0.0;
+    inferior[n - 1] = 0.0; diagonal[n - 1] = 1.0; superior[n - 1] = 0.0; M[n - 1] = 0.0;
+
+    double h_0 = x[1] - x[0], h_f = x[n - 1] - x[n - 2];
+    double pendiente_0 = (y[1] - y[0]) / h_0, pendiente_f = (y[n - 1] - y[n - 2]) / h_f;
+    EstadoSolver estado = SOLVER_OK;
+    switch (tipo)
+    {
+    case FRONTERA_NATURAL:
+        estado = resolverTridiagonal(n, inferior, diagonal, superior, M, M);
+        break;
+
+    case FRONTERA_SUJETA:
+        diagonal[0] = 2.0 * h_0;
+        superior[0] = h_0;
+        M[0] = 6.0 * (pendiente_0 - frontera->derivada_inicial);
+        inferior[n - 1] = h_f;
+        diagonal[n - 1] = 2.0 * h_f;
+        M[n - 1] = 6.0 * (frontera->derivada_final - pendiente_f);
+        estado = resolverTridiagonal(n, inferior, diagonal, superior, M, M);
+        break;
+
+    case FRONTERA_NO_NODO:
+        if (n == 3)
+        {
+            // Una sola cúbica con S''' = 0: la parábola por los tres puntos
+            M[0] = M[2] = M[1] / (3.0 * (x[2] - x[0]));
+            M[1] = M[0];
+        }
+        else if (n >= 4)
+        {
+            // M_0 = ((h_0 + h_1) M_1 - h_0 M_2) / h_1 reemplazado en la fila 1
+            // (y lo mismo con M_{n-1} en la fila n-2): el sistema sigue tridiagonal
+            double h_1 = x[2] - x[1], h_a = x[n - 2] - x[n - 3];
+            inferior[1] = 0.0;
+            diagonal[1] = (h_0 + h_1) * (h_0 + 2.0 * h_1) / h_1;
+            superior[1] = (h_1 * h_1 - h_0 * h_0) / h_1;
+            inferior[n - 2] = (h_a * h_a - h_f * h_f) / h_a;
+            diagonal[n - 2] = (h_a + h_f) * (2.0 * h_a + h_f) / h_a;
+            superior[n - 2] = 0.0;
+            estado = resolverTridiagonal(n, inferior, diagonal, superior, M, M);
+            M[0] = ((h_0 + h_1) * M[1] - h_0 * M[2]) / h_1;
+            M[n - 1] = ((h_a + h_f) * M[n - 2] - h_f * M[n - 3]) / h_a;
+        }
+        break; // n = 2: la recta (M = 0)
+
+    case FRONTERA_PERIODICA:
+        // Incógnitas M_0..M_{n-2}; las esquinas acoplan M_0 con M_{n-2}
+        inferior[0] = h_f;
+        diagonal[0] = 2.0 * (h_f + h_0);
+        superior[0] = h_0;
+        M[0] = 6.0 * (pendiente_0 - pendiente_f);
+        estado = resolverTridiagonalCiclico(n - 1, inferior, diagonal, superior, M, M);
+        M[n - 1] = M[0];
+        break;
+    }
+
+    if (estado != SOLVER_OK)
+    {
+        printf("[ERROR] No se pudo resolver el sistema de los splines cúbicos.\n");
+        free(sistema);
+        liberarSplineCubico(S);
+        return 1;
+    }
+
+    completarSplineCubico(S, y, M);
+    free(sistema);
+    return 0;
+}
+
+const char *nombreFrontera(TipoFrontera tipo)
+{
+    switch (tipo)
+    {
+    case FRONTERA_NATURAL:
+        return "natural";
+    case FRONTERA_SUJETA:
+        return "sujeta";
+    case FRONTERA_NO_NODO:
+        return "not-a-knot";
+    case FRONTERA_PERIODICA:
+        return "periódica";
+    }
+    return "desconocida";
+}
+
+int tramoSplineCubico(const SplineCubico *S, double x)
+{
+    int ultimo = S->n - 2;
+    x = reducirPeriodo(S, x, NULL);
+    if (S->uniforme)
+    {
+        double p = (x - S->x[0]) * S->inverso_paso;
+        if (!(p >= 0.0)) // También NaN
+            return 0;
+        int k = (p >= ultimo) ? ultimo : (int)p;
+        // El redondeo de (x - x_0) / h puede dejar a x un tramo corrido
+        while (k > 0 && x < S->x[k])
+            k--;
+        while (k < ultimo && x >= S->x[k + 1])
+            k++;
+        return k;
+    }
+
+    // Mayor k en [0, n-2] con x_k <= x
+    int inicio = 0, fin = ultimo;
+    while (inicio < fin)
+    {
+        int medio = (inicio + fin + 1) / 2;
+        if (S->x[medio] <= x)
+            inicio = medio;
+        else
+            fin = medio - 1;
+    }
+    return inicio;
+}
+
+double evaluarSplineCubico(const SplineCubico *S, double x)
+{
+    x = reducirPeriodo(S, x, NULL);
+    int k = tramoSplineCubico(S, x);
+    const double *c = S->coeficientes + 4 * k;
+    double t = x - S->x[k];
+    return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+}
+
+double derivadaSplineCubico(const SplineCubico *S, double x, int orden)
+{
+    x = reducirPeriodo(S, x, NULL);
+    int k = tramoSplineCubico(S, x);
+    const double *c = S->coeficientes + 4 * k;
+    double t = x - S->x[k];
+    switch (orden)
+    {
+    case 0:
+        return c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    case 1:
+        return c[1] + t * (2.0 * c[2] + t * 3.0 * c[3]);
+    case 2:
+        return 2.0 * c[2] + 6.0 * c[3] * t;
+    case 3:
+        return 6.0 * c[3];
+    }
+    return (orden > 3) ? 0.0 : NAN;
+}
+
+/* ∫ S desde x_0 hasta x */
+static double primitivaSpline(const SplineCubico *S, double x)
+{
+    double vueltas;
+    x = reducirPeriodo(S, x, &vueltas);
+    int k = tramoSplineCubico(S, x);
+    double primitiva = S->integrales[k] + integralTramo(S->coeficientes + 4 * k, x - S->x[k]);
+    return (vueltas != 0.0) ? primitiva + vueltas * S->integrales[S->n - 1] : primitiva;
+}
+
+double integralSplineCubico(const SplineCubico *S, double a, double b)
+{
+    return primitivaSpline(S, b) - primitivaSpline(S, a);
+}
+
+void coeficientesMonomiosSpline(const SplineCubico *S, int k, double *a)
+{
+    // a_k + b_k (x - l) + c_k (x - l)² + d_k (x - l)³ con l = x_k, expandido
+    const double *c = S->coeficientes + 4 * k;
+    double l = S->x[k];
+    a[3] = c[3];
+    a[2] = c[2] - 3.0 * c[3] * l;
+    a[1] = c[1] - l * (2.0 * c[2] - 3.0 * c[3] * l);
+    a[0] = c[0] - l * (c[1] - l * (c[2] - c[3] * l));
+}
+
+void evaluarSplineCubicoOrdenado(const SplineCubico *S, const double *xs, double *ys, int m)
+{
+    if (m <= 0)
+        return;
+    int ultimo = S->n - 2;
+    int k = tramoSplineCubico(S, xs[0]);
+    for (int i = 0; i < m; i++)
+    {
+        double x = reducirPeriodo(S, xs[i], NULL);
+        if (x < S->x[k] && k > 0)
+            k = tramoSplineCubico(S, x); // xs retrocedió
+        while (k < ultimo && x >= S->x[k + 1])
+            k++;
+        const double *c = S->coeficientes + 4 * k;
+        double t = x - S->x[k];
+        ys[i] = c[0] + t * (c[1] + t * (c[2] + t * c[3]));
+    }
+}
+
+void liberarSplineCubico(SplineCubico *S)
+{
+    free(S->x);
+    free(S->coeficientes);
+    free(S->integrales);
+    S->x = S->coeficientes = S->integrales = NULL;
+    S->n = 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file spline_cubico.h
+ * @brief Spline cúbico reutilizable: coeficientes por tramo, búsqueda rápida del tramo,
+ *        evaluación por lotes, derivadas e integrales.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Cada tramo [x_k, x_{k+1}] guarda su polinomio en forma local
+ *
+ *   S_k(x) = a_k + b_k t + c_k t² + d_k t³,    t = x - x_k
+ *
+ * en un único arreglo contiguo [a_0, b_0, c_0, d_0, a_1, ...]. La forma local
+ * es más precisa que expandir en potencias de x (no hay cancelación cuando los
+ * nodos están lejos del origen) y las derivadas e integrales salen directo.
+ *
+ * El tramo de un x se busca en O(log n) con búsqueda binaria o, si los nodos
+ * son equiespaciados, en O(1) con k = (x - x_0) / h (corregido con los nodos
+ * reales por si el redondeo deja a x en el tramo vecino). Para muchos x
+ * ordenados, evaluarSplineCubicoOrdenado() recorre los tramos una sola vez:
+ * O(n + m) para m puntos. Fuera de [x_0, x_{n-1}] se extrapola con el primer o
+ * el último tramo (el spline periódico, en cambio, se repite).
+ *
+ * Las condiciones de frontera (natural, sujeta, not-a-knot o periódica) cierran
+ * el sistema de las segundas derivadas M_k, que siempre queda tridiagonal (Thomas)
+ * o tridiagonal cíclico (Sherman-Morrison): la construcción es O(n) en todos los casos.
+ *
+ * Uso:
+ *   SplineCubico S;
+ *   crearSplineCubico(&S, x_puntos, y_puntos, n);   // natural: S'' = 0 en los extremos
+ *   CondicionFrontera periodica = { FRONTERA_PERIODICA, 0.0, 0.0 };
+ *   crearSplineCubicoFrontera(&S, x_puntos, y_puntos, n, &periodica);
+ *   double y = evaluarSplineCubico(&S, 1.5);
+ *   double area = integralSplineCubico(&S, 1.0, 2.0);
+ *   evaluarSplineCubicoOrdenado(&S, xs, ys, m);     // xs crecientes
+ *   liberarSplineCubico(&S);
+ */
+#ifndef SPLINE_CUBICO_H
+#define SPLINE_CUBICO_H
+
+#define TOLERANCIA_UNIFORME 1e-9 // Desvío relativo a h para considerar los nodos equiespaciados
+#define TOLERANCIA_PERIODICA 1e-10 // Diferencia relativa admitida entre y_0 e y_{n-1} en la frontera periódica
+
+/**
+ * @brief Condición que cierra el sistema en los extremos x_0 y x_{n-1}.
+ */
+typedef enum
+{
+    FRONTERA_NATURAL = 0,   // S''(x_0) = S''(x_{n-1}) = 0
+    FRONTERA_SUJETA,        // S'(x_0) y S'(x_{n-1}) dadas (clamped)
+    FRONTERA_NO_NODO,       // Not-a-knot: S''' continua en x_1 y x_{n-2}
+    FRONTERA_PERIODICA      // S, S' y S'' iguales en x_0 y x_{n-1}; exige y_0 = y_{n-1}
+} TipoFrontera;
+
+/**
+ * @brief Tipo de frontera y, para FRONTERA_SUJETA, las pendientes en los extremos.
+ */
+typedef struct
+{
+    TipoFrontera tipo;
+    double derivada_inicial;    // S'(x_0), sólo FRONTERA_SUJETA
+    double derivada_final;      // S'(x_{n-1}), sólo FRONTERA_SUJETA
+} CondicionFrontera;
+
+/**
+ * @brief Spline cúbico de n nodos (n - 1 tramos).
+ */
+typedef struct
+{
+    double *x;              // Nodos, estrictamente crecientes (n)
+    double *coeficientes;   // Tramo k: coeficientes[4k..4k+3] = a_k, b_k, c_k, d_k
+    double *integrales;     // integrales[k] = ∫ S desde x_0 hasta x_k (n)
+    int n;                  // Cantidad de nodos (>= 2)
+    int uniforme;           // 1 si los nodos son equiespaciados (tramo en O(1))
+    double inverso_paso;    // (n - 1) / (x_{n-1} - x_0), usado si uniforme
+    TipoFrontera frontera;  // Con FRONTERA_PERIODICA, x fuera de [x_0, x_{n-1}] se lleva al período
+} SplineCubico;
+
+/**
+ * @brief Construye el spline cúbico natural (S'' = 0 en x_0 y x_{n-1}) en O(n).
+ * @details Resuelve el sistema tridiagonal de las segundas derivadas con
+ *          resolverTridiagonal() y guarda los coeficientes de cada tramo.
+ * @param S Spline (salida).
+ * @param x Nodos estrictamente crecientes (se copian).
+ * @param y Valores en los nodos.
+ * @param n Cantidad de nodos (>= 2).
+ * @return 0 si todo salió bien, 1 si hay menos de 2 nodos, nodos no crecientes
+ *         o error de memoria (se informa con [ERROR]).
+ */
+int crearSplineCubico(SplineCubico *S, const double *x, const double *y, int n);
+
+/**
+ * @brief Construye el spline cúbico con la condición de frontera indicada, en O(n).
+ * @details Natural y sujeta cambian la primera y la última fila del sistema
+ *          tridiagonal. Not-a-knot (d_0 = d_1 y d_{n-3} = d_{n-2}) agrega M_2 a la
+ *          primera fila: se despejan M_0 y M_{n-1} y el sistema de M_1..M_{n-2}
+ *          sigue tridiagonal (con n = 3 queda la parábola por los tres puntos).
+ *          Periódica deja n-1 incógnitas (M_{n-1} = M_0) en un sistema
+ *          cíclico, que se resuelve con resolverTridiagonalCiclico().
+ * @param frontera Condición de frontera; NULL equivale a FRONTERA_NATURAL.
+ * @return 0 si todo salió bien, 1 si los datos no sirven (nodos no crecientes,
+ *         y_0 != y_{n-1} en la periódica) o hubo error (se informa con [ERROR]).
+ */
+int crearSplineCubicoFrontera(SplineCubico *S, const double *x, const double *y, int n,
+                              const CondicionFrontera *frontera);
+
+/**
+ * @brief Nombre de la condición de frontera, para mostrar.
+ */
+const char *nombreFrontera(TipoFrontera tipo);
+
+/**
+ * @brief Tramo k (0 <= k <= n-2) con x_k <= x < x_{k+1}; 0 o n-2 fuera del rango.
+ * @details O(1) si los nodos son equiespaciados, O(log n) si no. En el spline
+ *          periódico x se lleva primero a [x_0, x_{n-1}).
+ */
+int tramoSplineCubico(const SplineCubico *S, double x);
+
+/**
+ * @brief Evalúa S(x).
+ */
+double evaluarSplineCubico(const SplineCubico *S, double x);
+
+/**
+ * @brief Derivada de orden 0 (S), 1 (S'), 2 (S'') o 3 (S''', constante por tramo) en x.
+ * @return La derivada, o 0 si orden > 3 (NAN si orden < 0).
+ */
+double derivadaSplineCubico(const SplineCubico *S, double x, int orden);
+
+/**
+ * @brief ∫ S(x) dx desde a hasta b (exacta para el spline), en O(1) más la búsqueda de los tramos.
+ * @details Usa las integrales acumuladas hasta cada nodo; b < a da el valor con signo opuesto.
+ *          En el spline periódico suma la integral de un período por cada vuelta.
+ */
+double integralSplineCubico(const SplineCubico *S, double a, double b);
+
+/**
+ * @brief Coeficientes del tramo k en la base de monomios: S_k(x) = Σ a[i] x^i, i = 0..3.
+ * @details Para mostrar el polinomio; evaluar con la forma local es más preciso.
+ * @param a Salida, 4 elementos (a[i] es el coeficiente de x^i).
+ */
+void coeficientesMonomiosSpline(const SplineCubico *S, int k, double *a);
+
+/**
+ * @brief ys[i] = S(xs[i]) para xs no decreciente, recorriendo los tramos una sola vez (O(n + m)).
+ * @details Si algún xs[i] retrocede se vuelve a buscar su tramo: el resultado es
+ *          correcto aunque xs no esté ordenado, sólo más lento. ys puede ser xs.
+ */
+void evaluarSplineCubicoOrdenado(const SplineCubico *S, const double *xs, double *ys, int m);
+
+/**
+ * @brief Libera la memoria del spline.
+ */
+void liberarSplineCubico(SplineCubico *S);
+
+#endif // SPLINE_CUBICO_H
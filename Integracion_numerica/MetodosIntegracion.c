@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <ctype.h>
+#include "../Ajuste_de_curvas/spline_cubico.h"
 
 /**
  * Lee una opción del menú del usuario y la convierte a minúscula
@@ -53,54 +54,6 @@ void trapecioCompuesto ();
  */
 void simpsonCompuesto ();
 
-// ==================== FUNCIONES AUXILIARES PARA SPLINES CÚBICAS ====================
-
-/**
- * Construye el sistema tridiagonal A·M = b para splines cúbicas naturales
- * Condiciones de frontera: M₀ = 0 y Mₙ₋₁ = 0 (segunda derivada nula en extremos)
- * Sistema tridiagonal:
- *   - Diagonal inferior: hᵢ₋₁
- *   - Diagonal principal: 2(hᵢ₋₁ + hᵢ)
- *   - Diagonal superior: hᵢ
- *   - Lado derecho: 6·[(yᵢ₊₁-yᵢ)/hᵢ - (yᵢ-yᵢ₋₁)/hᵢ₋₁]
- * 
- * @param x Array con las coordenadas x de los nodos (n elementos)
- * @param y Array con las coordenadas y de los nodos (n elementos)
- * @param n Cantidad de nodos
- * @param A Matriz de coeficientes (n×n, almacenada por filas)
- * @param b_vec Vector de términos independientes (n elementos)
- */
-void construirSistemaSplinesCubicas(double *x, double *y, int n, double *A, double *b_vec);
-
-/**
- * Resuelve el sistema lineal A·x = b mediante Eliminación Gaussiana con pivoteo parcial
- * Pasos:
- *   1. Fase de eliminación hacia adelante con pivoteo
- *   2. Sustitución hacia atrás
- * 
- * @param A Matriz de coeficientes (n×n, almacenada por filas)
- * @param b_vec Vector de términos independientes (n elementos)
- * @param solution Vector donde se almacenará la solución (n elementos)
- * @param n Dimensión del sistema
- */
-void eliminacionGaussiana(double *A, double *b_vec, double *solution, int n);
-
-/**
- * Evalúa la spline cúbica en un punto x_eval
- * Usa la fórmula de Hermite para splines cúbicas:
- *   S_j(x) = (M_j/6h_j)·(x_{j+1}-x)³ + (M_{j+1}/6h_j)·(x-x_j)³
- *          + [y_j - M_j·h_j²/6]·(x_{j+1}-x)/h_j
- *          + [y_{j+1} - M_{j+1}·h_j²/6]·(x-x_j)/h_j
- * 
- * @param x_eval Punto donde evaluar la spline
- * @param x Array con las coordenadas x de los nodos
- * @param y Array con las coordenadas y de los nodos
- * @param M Array con las segundas derivadas M_i (solución del sistema)
- * @param n Cantidad de nodos
- * @return Valor de la spline en x_eval
- */
-double evaluarSpline(double x_eval, double *x, double *y, double *M, int n);
-
 /**
  * Implementa la Cuadratura de Gauss-Legendre con 2 a 6 puntos
  * Transforma el intervalo [a,b] a [-1,1] mediante:
@@ -612,9 +565,7 @@ void trapecioCompuesto ()
             double *x_values = NULL;
             double *y_values = NULL;
 
-            double *A = NULL; // Matriz de coeficientes
-            double *b_vec = NULL; // Vector de términos independientes
-            double *solution = NULL; // Vector solución
+            SplineCubico S; // Spline cúbica natural de la tabla
 
             printf("Implementacion usando una tabla de datos...\n");
             getNodesFromFile("derivadas_optima_func.txt", &x_values, &y_values, &n);
@@ -622,11 +573,6 @@ void trapecioCompuesto ()
             /* Mostrar los nodos en formato de tabla */
             mostrarNodosEnTabla(x_values, y_values, n);
 
-            /* Inicializar A y b */
-            A = (double*)malloc(n * n * sizeof(double));
-            b_vec = (double*)malloc(n * sizeof(double));
-            solution = (double*)malloc(n * sizeof(double));
-
             printf("\n--- PASO 1: Construyendo sistema de splines cúbicas ---\n");
             /* Construir el sistema de ecuaciones para los splines
              * 
@@ -645,16 +591,18 @@ void trapecioCompuesto ()
              * donde M = [M₀, M₁, ..., Mₙ₋₁] son las segundas derivadas
              */
 
-            // Construir el sistema tridiagonal para encontrar las segundas derivadas M_i
-            construirSistemaSplinesCubicas(x_values, y_values, n, A, b_vec);
-
-            // Resolver el sistema A * M = b para obtener las segundas derivadas
-            eliminacionGaussiana(A, b_vec, solution, n);
+            // Resolver el sistema tridiagonal de las segundas derivadas M_i (algoritmo de Thomas, O(n))
+            // y guardar los coeficientes de cada tramo
+            if (crearSplineCubico(&S, x_values, y_values, n) != 0) {
+                free(x_values);
+                free(y_values);
+                break;
+            }
 
             printf("Splines cúbicas calculadas exitosamente.\n");
             printf("Segundas derivadas (M_i) en los nodos:\n");
             for (int i = 0; i < n; i++) {
-                printf("  M[%d] = %.6lf\n", i, solution[i]);
+                printf("  M[%d] = %.6lf\n", i, derivadaSplineCubico(&S, x_values[i], 2));
             }
 
             printf("\n--- PASO 2: Generando tabla equiespaciada ---\n");
@@ -688,11 +636,11 @@ void trapecioCompuesto ()
             printf("Límites: a = %.4lf, b = %.4lf\n", a, b);
             printf("Espaciamiento h = %.6lf\n", h);
 
-            // Evaluar la spline en los puntos equiespaciados
+            // Evaluar la spline en los puntos equiespaciados (crecientes: se recorren los tramos una sola vez)
             for (int i = 0; i < n_equi; i++) {
                 x_equi[i] = a + i * h;
-                y_equi[i] = evaluarSpline(x_equi[i], x_values, y_values, solution, n);
             }
+            evaluarSplineCubicoOrdenado(&S, x_equi, y_equi, n_equi);
             printf("Tabla equiespaciada generada con %d puntos.\n", n_equi);
 
             printf("\n--- PASO 3: Aplicando Regla del Trapecio Compuesto ---\n");
@@ -720,6 +668,7 @@ void trapecioCompuesto ()
             printf("========================================\n");
             printf("Integral aproximada: %.10lf\n", suma);
             printf("Número de subintervalos: %d\n", n_equi - 1);
+            printf("Integral exacta de la spline: %.10lf\n", integralSplineCubico(&S, a, b));
             printf("========================================\n");
             
             /* Cálculo de errores (opcional) */
@@ -749,9 +698,7 @@ void trapecioCompuesto ()
             /* Liberar memoria */
             free(x_values);
             free(y_values);
-            free(A);
-            free(b_vec);
-            free(solution);
+            liberarSplineCubico(&S);
             free(x_equi);
             free(y_equi);
 
@@ -770,227 +717,6 @@ void trapecioCompuesto ()
     } while (opcion != 'd');
 }
 
-/**
- * ============================================================================
- * FUNCIÓN AUXILIAR: construirSistemaSplinesCubicas
- * ============================================================================
- * Construye el sistema lineal tridiagonal A·M = b para splines cúbicas naturales
- * 
- * SPLINES CÚBICAS NATURALES:
- *   En cada intervalo [x_j, x_{j+1}], la spline es un polinomio cúbico:
- *   S_j(x) = a_j + b_j·(x-x_j) + c_j·(x-x_j)² + d_j·(x-x_j)³
- * 
- * CONDICIONES DE FRONTERA NATURALES:
- *   - S''(x_0) = 0  →  M_0 = 0
- *   - S''(x_{n-1}) = 0  →  M_{n-1} = 0
- * 
- * SISTEMA TRIDIAGONAL (n ecuaciones para n incógnitas M_i):
- *   Primera ecuación: M_0 = 0
- *   Ecuaciones intermedias (i = 1,...,n-2):
- *     h_{i-1}·M_{i-1} + 2(h_{i-1}+h_i)·M_i + h_i·M_{i+1} = 
- *       6·[(y_{i+1}-y_i)/h_i - (y_i-y_{i-1})/h_{i-1}]
- *   Última ecuación: M_{n-1} = 0
- * 
- * donde h_i = x_{i+1} - x_i
- * 
- * @param x Array con coordenadas x de los nodos (n elementos, ordenados)
- * @param y Array con coordenadas y de los nodos (n elementos)
- * @param n Cantidad de nodos
- * @param A Matriz tridiagonal n×n (salida, almacenada por filas)
- * @param b_vec Vector de términos independientes n (salida)
- */
-void construirSistemaSplinesCubicas(double *x, double *y, int n, double *A, double *b_vec)
-{
-    // Inicializar matriz A con ceros
-    for (int i = 0; i < n * n; i++) {
-        A[i] = 0.0;
-    }
-
-    // Calcular diferencias h_i = x_{i+1} - x_i
-    double *h = (double*)malloc((n-1) * sizeof(double));
-    for (int i = 0; i < n-1; i++) {
-        h[i] = x[i+1] - x[i];
-    }
-
-    /* Primera ecuación: M_0 = 0 (condición natural) */
-    A[0 * n + 0] = 1.0;
-    b_vec[0] = 0.0;
-
-    /* Ecuaciones intermedias (i = 1, 2, ..., n-2) */
-    for (int i = 1; i < n-1; i++) {
-        // Coeficiente de M_{i-1}
-        A[i * n + (i-1)] = h[i-1];
-
-        // Coeficiente de M_i
-        A[i * n + i] = 2.0 * (h[i-1] + h[i]);
-
-        // Coeficiente de M_{i+1}
-        A[i * n + (i+1)] = h[i];
-
-        // Lado derecho
-        b_vec[i] = 6.0 * ((y[i+1] - y[i]) / h[i] - (y[i] - y[i-1]) / h[i-1]);
-    }
-
-    /* Última ecuación: M_{n-1} = 0 (condición natural) */
-    A[(n-1) * n + (n-1)] = 1.0;
-    b_vec[n-1] = 0.0;
-
-    free(h);
-}
-
-/**
- * ============================================================================
- * FUNCIÓN AUXILIAR: eliminacionGaussiana
- * ============================================================================
- * Resuelve el sistema lineal A·x = b mediante Eliminación Gaussiana con pivoteo parcial
- * 
- * ALGORITMO:
- *   1. FASE DE ELIMINACIÓN (triangularización):
- *      - Para cada columna k:
- *        a) Pivoteo parcial: buscar el elemento de mayor valor absoluto
- *        b) Intercambiar filas si es necesario
- *        c) Eliminación: hacer ceros debajo del pivote
- * 
- *   2. FASE DE SUSTITUCIÓN HACIA ATRÁS:
- *      - Resolver desde la última ecuación hacia la primera
- *      - x_i = (b_i - Σ a_{ij}·x_j) / a_{ii}
- * 
- * PIVOTEO PARCIAL:
- *   - Mejora la estabilidad numérica del algoritmo
- *   - Evita divisiones por números muy pequeños
- *   - Reduce errores de redondeo
- * 
- * COMPLEJIDAD: O(n³) operaciones
- * 
- * NOTA: Trabaja con copias de A y b para preservar los valores originales
- * 
- * @param A Matriz de coeficientes n×n (almacenada por filas, no se modifica)
- * @param b_vec Vector de términos independientes n (no se modifica)
- * @param solution Vector donde se almacena la solución x (salida, n elementos)
- * @param n Dimensión del sistema
- */
-void eliminacionGaussiana(double *A, double *b_vec, double *solution, int n)
-{
-    // Crear copia de A y b para no modificar los originales
-    double *A_copy = (double*)malloc(n * n * sizeof(double));
-    double *b_copy = (double*)malloc(n * sizeof(double));
-
-    for (int i = 0; i < n * n; i++) {
-        A_copy[i] = A[i];
-    }
-    for (int i = 0; i < n; i++) {
-        b_copy[i] = b_vec[i];
-    }
-
-    /* Fase de eliminación */
-    for (int k = 0; k < n-1; k++) {
-        // Pivoteo parcial
-        int max_row = k;
-        double max_val = fabs(A_copy[k * n + k]);
-
-        for (int i = k+1; i < n; i++) {
-            if (fabs(A_copy[i * n + k]) > max_val) {
-                max_val = fabs(A_copy[i * n + k]);
-                max_row = i;
-            }
-        }
-
-        // Intercambiar filas si es necesario
-        if (max_row != k) {
-            for (int j = 0; j < n; j++) {
-                double temp = A_copy[k * n + j];
-                A_copy[k * n + j] = A_copy[max_row * n + j];
-                A_copy[max_row * n + j] = temp;
-            }
-            double temp = b_copy[k];
-            b_copy[k] = b_copy[max_row];
-            b_copy[max_row] = temp;
-        }
-
-        // Eliminación
-        for (int i = k+1; i < n; i++) {
-            double factor = A_copy[i * n + k] / A_copy[k * n + k];
-            for (int j = k; j < n; j++) {
-                A_copy[i * n + j] -= factor * A_copy[k * n + j];
-            }
-            b_copy[i] -= factor * b_copy[k];
-        }
-    }
-
-    /* Sustitución hacia atrás */
-    for (int i = n-1; i >= 0; i--) {
-        solution[i] = b_copy[i];
-        for (int j = i+1; j < n; j++) {
-            solution[i] -= A_copy[i * n + j] * solution[j];
-        }
-        solution[i] /= A_copy[i * n + i];
-    }
-
-    free(A_copy);
-    free(b_copy);
-}
-
-/**
- * ============================================================================
- * FUNCIÓN AUXILIAR: evaluarSpline
- * ============================================================================
- * Evalúa la spline cúbica S(x) en un punto x_eval dado
- * 
- * FÓRMULA DE HERMITE PARA SPLINES CÚBICAS:
- *   En el intervalo [x_j, x_{j+1}], la spline cúbica es:
- * 
- *   S_j(x) = M_j/(6h_j) · (x_{j+1} - x)³ + M_{j+1}/(6h_j) · (x - x_j)³
- *          + [y_j - M_j·h_j²/6] · (x_{j+1} - x)/h_j
- *          + [y_{j+1} - M_{j+1}·h_j²/6] · (x - x_j)/h_j
- * 
- * donde:
- *   - h_j = x_{j+1} - x_j  (ancho del intervalo)
- *   - M_j, M_{j+1} son las segundas derivadas en los extremos
- *   - y_j, y_{j+1} son los valores de la función en los extremos
- * 
- * PROPIEDADES DE LA SPLINE:
- *   - S_j(x_j) = y_j  (interpolación)
- *   - S_j(x_{j+1}) = y_{j+1}  (interpolación)
- *   - Primera derivada continua en x_j
- *   - Segunda derivada continua en x_j
- * 
- * MANEJO DE PUNTOS FUERA DEL RANGO:
- *   - Si x < x_0: usa el primer intervalo (extrapolación)
- *   - Si x > x_{n-1}: usa el último intervalo (extrapolación)
- * 
- * @param x_eval Punto donde evaluar la spline
- * @param x Array con coordenadas x de los nodos (n elementos, ordenados)
- * @param y Array con coordenadas y de los nodos (n elementos)
- * @param M Array con segundas derivadas M_i (n elementos, de eliminacionGaussiana)
- * @param n Cantidad de nodos
- * @return Valor de S(x_eval)
- */
-double evaluarSpline(double x_eval, double *x, double *y, double *M, int n)
-{
-    // Encontrar el intervalo [x_j, x_{j+1}] que contiene x_eval
-    int j = 0;
-    for (int i = 0; i < n-1; i++) {
-        if (x_eval >= x[i] && x_eval <= x[i+1]) {
-            j = i;
-            break;
-        }
-    }
-
-    // Si x_eval está fuera del rango, usar el primer o último intervalo
-    if (x_eval < x[0]) j = 0;
-    if (x_eval > x[n-1]) j = n-2;
-
-    double h_j = x[j+1] - x[j];
-
-    // Calcular la spline cúbica S_j(x)
-    double t1 = (M[j] / 6.0) * pow(x[j+1] - x_eval, 3) / h_j;
-    double t2 = (M[j+1] / 6.0) * pow(x_eval - x[j], 3) / h_j;
-    double t3 = (y[j] - M[j] * h_j * h_j / 6.0) * (x[j+1] - x_eval) / h_j;
-    double t4 = (y[j+1] - M[j+1] * h_j * h_j / 6.0) * (x_eval - x[j]) / h_j;
-
-    return t1 + t2 + t3 + t4;
-}
-
 /**
  * ============================================================================
  * FUNCIÓN: simpsonCompuesto
@@ -1200,9 +926,7 @@ void simpsonCompuesto ()
             double *x_values = NULL;
             double *y_values = NULL;
 
-            double *A = NULL; // Matriz de coeficientes
-            double *b_vec = NULL; // Vector de términos independientes
-            double *solution = NULL; // Vector solución
+            SplineCubico S; // Spline cúbica natural de la tabla
 
             printf("Implementacion usando una tabla de datos...\n");
             getNodesFromFile("nodos.txt", &x_values, &y_values, &n);
@@ -1210,26 +934,23 @@ void simpsonCompuesto ()
             /* Mostrar los nodos en formato de tabla */
             mostrarNodosEnTabla(x_values, y_values, n);
 
-            /* Inicializar A y b */
-            A = (double*)malloc(n * n * sizeof(double));
-            b_vec = (double*)malloc(n * sizeof(double));
-            solution = (double*)malloc(n * sizeof(double));
-
             /* ========================================
                PASO 1: Construir Splines Cúbicas Naturales
                ======================================== */
             printf("\n--- PASO 1: Construyendo sistema de splines cúbicas ---\n");
 
-            // Construir el sistema tridiagonal para encontrar las segundas derivadas M_i
-            construirSistemaSplinesCubicas(x_values, y_values, n, A, b_vec);
-
-            // Resolver el sistema A * M = b para obtener las segundas derivadas
-            eliminacionGaussiana(A, b_vec, solution, n);
+            // Resolver el sistema tridiagonal de las segundas derivadas M_i (algoritmo de Thomas, O(n))
+            // y guardar los coeficientes de cada tramo
+            if (crearSplineCubico(&S, x_values, y_values, n) != 0) {
+                free(x_values);
+                free(y_values);
+                break;
+            }
 
             printf("Splines cúbicas calculadas exitosamente.\n");
             printf("Segundas derivadas (M_i) en los nodos:\n");
             for (int i = 0; i < n; i++) {
-                printf("  M[%d] = %.6lf\n", i, solution[i]);
+                printf("  M[%d] = %.6lf\n", i, derivadaSplineCubico(&S, x_values[i], 2));
             }
 
             /* ========================================
@@ -1261,11 +982,11 @@ void simpsonCompuesto ()
             printf("Número de subintervalos: %d\n", n_subintervalos);
             printf("Espaciamiento h = %.6lf\n", h);
 
-            // Evaluar la spline en los puntos equiespaciados
+            // Evaluar la spline en los puntos equiespaciados (crecientes: se recorren los tramos una sola vez)
             for (int i = 0; i < n_equi; i++) {
                 x_equi[i] = a + i * h;
-                y_equi[i] = evaluarSpline(x_equi[i], x_values, y_values, solution, n);
             }
+            evaluarSplineCubicoOrdenado(&S, x_equi, y_equi, n_equi);
 
             printf("Tabla equiespaciada generada con %d puntos.\n", n_equi);
 
@@ -1295,6 +1016,7 @@ void simpsonCompuesto ()
             printf("Integral aproximada: %.10lf\n", suma);
             printf("Número de subintervalos: %d\n", n_subintervalos);
             printf("Espaciamiento h: %.6lf\n", h);
+            printf("Integral exacta de la spline: %.10lf\n", integralSplineCubico(&S, a, b));
             printf("========================================\n");
             
             /* Cálculo de errores (opcional) */
@@ -1324,9 +1046,7 @@ void simpsonCompuesto ()
             /* Liberar memoria */
             free(x_values);
             free(y_values);
-            free(A);
-            free(b_vec);
-            free(solution);
+            liberarSplineCubico(&S);
             free(x_equi);
             free(y_equi);
 
@@ -1552,9 +1272,7 @@ void gaussLegendre ()
             double *y_values = NULL;
             int n = 0;
             
-            double *A = NULL;
-            double *b_vec = NULL;
-            double *solution = NULL;
+            SplineCubico S;
 
             printf("\n>>> GAUSS-LEGENDRE CON TABLA DE DATOS <<<\n");
             printf("Implementación usando tabla de datos...\n");
@@ -1564,17 +1282,15 @@ void gaussLegendre ()
 
             /* PASO 1: Construir splines cúbicas */
             printf("\n--- PASO 1: Construyendo splines cúbicas ---\n");
-            A = (double*)malloc(n * n * sizeof(double));
-            b_vec = (double*)malloc(n * sizeof(double));
-            solution = (double*)malloc(n * sizeof(double));
-
-            construirSistemaSplinesCubicas(x_values, y_values, n, A, b_vec);
-            eliminacionGaussiana(A, b_vec, solution, n);
+            if (crearSplineCubico(&S, x_values, y_values, n) != 0) {
+                free(x_values); free(y_values);
+                break;
+            }
             
             printf("Splines cúbicas calculadas.\n");
             printf("Segundas derivadas (M_i) en los nodos:\n");
             for (int i = 0; i < n; i++) {
-                printf("  M[%d] = %.6lf\n", i, solution[i]);
+                printf("  M[%d] = %.6lf\n", i, derivadaSplineCubico(&S, x_values[i], 2));
             }
 
             /* PASO 2 y 3: Seleccionar número de puntos de Gauss */
@@ -1585,7 +1301,7 @@ void gaussLegendre ()
             if (puntos < 2 || puntos > 6) {
                 printf("Número de puntos no válido.\n");
                 free(x_values); free(y_values);
-                free(A); free(b_vec); free(solution);
+                liberarSplineCubico(&S);
                 break;
             }
 
@@ -1616,7 +1332,7 @@ void gaussLegendre ()
                 double x_gauss = (b-a)/2.0 * nodos[i] + (a+b)/2.0;
                 
                 /* Evaluar spline en el nodo de Gauss */
-                double y_gauss = evaluarSpline(x_gauss, x_values, y_values, solution, n);
+                double y_gauss = evaluarSplineCubico(&S, x_gauss);
                 
                 printf("║  %2d   ║   %13.6lf ║   %13.6lf ║   %13.6lf ║\n", 
                        i+1, x_gauss, y_gauss, pesos[i]);
@@ -1636,6 +1352,7 @@ void gaussLegendre ()
             printf("Integral aproximada: %.10lf\n", I);
             printf("Puntos de Gauss: %d\n", puntos);
             printf("Intervalo: [%.6lf, %.6lf]\n", a, b);
+            printf("Integral exacta de la spline: %.10lf\n", integralSplineCubico(&S, a, b));
             printf("========================================\n");
             
             /* Cálculo de errores (opcional) */
@@ -1664,7 +1381,7 @@ void gaussLegendre ()
 
             /* Liberar memoria */
             free(x_values); free(y_values);
-            free(A); free(b_vec); free(solution);
+            liberarSplineCubico(&S);
 
             printf("\nPresione ENTER para continuar...");
             getchar();
@@ -73,6 +73,11 @@
 #include <math.h>    // Para funciones matemáticas
 #include "ctype.h"   // Para tolower()
 #include "matriz_desde_archivo/matriz_desde_archivo.h"
+#include "matriz_densa/matriz_densa.h"
+#include "diagnostico_convergencia/diagnostico_convergencia.h"
+#include "espacio_trabajo/espacio_trabajo.h"
+#include "nucleos_simd/nucleos_simd.h"
+#include "modo_lotes/modo_lotes.h"
 #include "../libreria_de_aditamentos/aditamentos_ui.h"
 
 #define RUTA_MATRIZ "matriz.txt"
@@ -103,46 +108,59 @@ void eliminacionGauss(double **A, double *b, int n);
  * @brief Resuelve el sistema de ecuaciones usando el método de Jacobi.
  * 
  * Este método es iterativo y se basa en la descomposición de la matriz A
- * en sus componentes diagonal, inferior y superior. Se verifica que la matriz
- * sea diagonalmente dominante para asegurar la convergencia del método.
+ * en sus componentes diagonal, inferior y superior. Antes de iterar se verifica
+ * la dominancia diagonal y se estima el radio espectral de la matriz de iteración;
+ * si es claramente mayor que 1 el método no converge y se vuelve al menú sin iterar.
  * 
  * El método itera hasta que el error entre iteraciones sea menor que la tolerancia
- * especificada por el usuario o hasta alcanzar el número máximo de iteraciones.
+ * especificada por el usuario, o hasta que el error se estanque o se prevea que
+ * no alcanzará la tolerancia en MAX_ITER iteraciones.
  * 
  * @param A Matriz de coeficientes.
  * @param b Vector de términos independientes.
  * @param n Tamaño del sistema.
+ * @param espacio Espacio de trabajo del programa: recibe la copia contigua de A y b
+ *                sobre la que se analiza e itera, y los vectores de iteración.
  * 
  * Imprime la evolución del proceso iterativo, la convergencia y la solución aproximada
  * de forma clara y amigable, similar al método de eliminación de Gauss.
  */
-void jacobi (double **A, double *b, int n);
+void jacobi (double **A, double *b, int n, EspacioTrabajo *espacio);
 
 /**
  * @brief Resuelve el sistema de ecuaciones usando el método de Gauss-Seidel.
  *
  * Este método es iterativo y mejora el método de Jacobi al usar los valores
  * más recientes de las variables en cada iteración. Se basa en la descomposición
- * de la matriz A en sus componentes diagonal, inferior y superior. Se verifica
- * que la matriz sea diagonalmente dominante para asegurar la convergencia del método.
+ * de la matriz A en sus componentes diagonal, inferior y superior. Antes de iterar
+ * se verifica la dominancia diagonal y se estima el radio espectral de la matriz
+ * de iteración; si es claramente mayor que 1 el método no converge y se vuelve al
+ * menú sin iterar.
  *
  * El método itera hasta que el error entre iteraciones sea menor que la tolerancia
- * especificada por el usuario o hasta alcanzar el número máximo de iteraciones.
+ * especificada por el usuario, o hasta que el error se estanque o se prevea que
+ * no alcanzará la tolerancia en MAX_ITER iteraciones.
  * En cada iteración, se calcula el nuevo valor de cada variable usando los valores
  * ya actualizados de las variables anteriores en la misma iteración.
  *
  * @param A Matriz de coeficientes (no modificada).
  * @param b Vector de términos independientes (no modificado).
  * @param n Tamaño del sistema.
+ * @param espacio Espacio de trabajo del programa: recibe la copia contigua de A y b
+ *                sobre la que se analiza e itera, y los vectores de iteración.
  *
  * Imprime la evolución del proceso iterativo, la convergencia y la solución aproximada
  * de forma clara y amigable, similar a los otros métodos implementados.
  */
-void gaussSeidel (double **A, double *b, int n);
+void gaussSeidel (double **A, double *b, int n, EspacioTrabajo *espacio);
 
 /* Funcion Principal del Programa */
 int main(int argc, char const *argv[])
 {
+    // Con argumentos se ejecuta el modo por lotes (modo_lotes/), sin interacción
+    if (argc > 1)
+        return modoLotes(argc, argv);
+
     char opcion = 0; // Opción del menú
     int stopDoWhile = 0; // Controla la salida del bucle principal
 
@@ -150,6 +168,10 @@ int main(int argc, char const *argv[])
     double *b = NULL;
     int n = 0;
 
+    // Se reutiliza entre métodos; crece la primera vez que se carga un sistema más grande
+    EspacioTrabajo espacio;
+    crearEspacioTrabajo(&espacio, 0);
+
     do
     {
         system("clear"); // Limpiar la pantalla (Linux/Mac)
@@ -186,7 +208,7 @@ int main(int argc, char const *argv[])
             confirmarMatriz(&A, &b, &n);
             pausa();
             system("clear");
-            jacobi(A, b, n);
+            jacobi(A, b, n, &espacio);
             pausa();
             liberarMemoria(A, b, n);
             break;
@@ -198,7 +220,7 @@ int main(int argc, char const *argv[])
             confirmarMatriz(&A, &b, &n);
             pausa();
             system("clear");
-            gaussSeidel(A, b, n);
+            gaussSeidel(A, b, n, &espacio);
             pausa();
             liberarMemoria(A, b, n);
             break;
@@ -213,6 +235,7 @@ int main(int argc, char const *argv[])
         }
     } while (stopDoWhile == 0);
 
+    liberarEspacioTrabajo(&espacio);
     return 0;
 }
 
@@ -227,7 +250,7 @@ void confirmarMatriz(double ***A, double **b, int *n)
     pausa();
     system("clear");
 
-    if (leerSistemaDesdeArchivo(RUTA_MATRIZ, A, b, n) != 0)
+    if (leerSistemaDesdeArchivo(RUTA_MATRIZ, A, b, n, 1) != 0)
     {
         printf("[ERROR] Error al leer el sistema desde el archivo.\n");
         pausa();
@@ -282,8 +305,7 @@ void eliminacionGauss(double **A, double *b, int n)
             factor = (-A[j][i] / A[i][i]);
 
             // Actualizar la fila j de A
-            for (size_t k = i; k < n; k++)
-                A[j][k] += factor * A[i][k];
+            axpySimd(&A[j][i], &A[i][i], factor, n - (int)i);
 
             // Actualizar el vector b
             b[j] += factor * b[i];
@@ -327,8 +349,7 @@ void eliminacionGauss(double **A, double *b, int n)
         suma = b[i];
 
         // Calcular la suma de A[i][j] * x[j] para j = i+1 hasta n
-        for (int j = (i + 1); j < n; j++)
-            suma -= A[i][j] * x[j];
+        suma -= productoEscalarSimd(&A[i][i + 1], &x[i + 1], n - i - 1);
 
         // Calcular el valor de x[i]
         x[i] = suma / A[i][i];
@@ -346,32 +367,64 @@ void eliminacionGauss(double **A, double *b, int n)
     free(x);
 }
 
-void jacobi (double **A, double *b, int n)
+/**
+ * @brief Análisis previo de convergencia de los métodos iterativos interactivos.
+ * @details Informa la dominancia diagonal, el radio espectral estimado de la
+ *          matriz de iteración y las iteraciones previstas. La falta de dominancia
+ *          diagonal sólo es una advertencia (es condición suficiente, no necesaria).
+ *          Si el radio espectral estimado supera 1 por más de
+ *          MARGEN_RADIO_ESPECTRAL el método no puede converger; cerca de 1 la
+ *          estimación no decide y sólo se advierte (el control de estancamiento
+ *          detiene la iteración si no avanza).
+ * @return 1 si conviene iterar, 0 si el método no converge.
+ */
+static int verificarConvergencia(const EspacioTrabajo *espacio, MetodoIterativo metodo,
+                                 const ParametrosIterativos *param, const char *nombre)
 {
-    double suma = 0.0;
+    DiagnosticoConvergencia d;
+    EstadoSolver estado = diagnosticarConvergencia(&espacio->A, espacio->b, NULL, metodo, param, &d);
+    if (estado == SOLVER_ERROR_MEMORIA)
+    {
+        printf("[ERROR] No se pudo asignar memoria para el análisis de convergencia.\n");
+        exit(EXIT_FAILURE);
+    }
 
-    // Verificar si es Diagonalmente Dominante
-    for (int i = 0; i < n; i++)
+    if (!d.diagonal_dominante)
+        printf("[ADVERTENCIA] La matriz no es diagonalmente dominante en la fila %d.\n", d.fila_no_dominante);
+    printf("Radio espectral estimado de la matriz de iteración: %.6f\n", d.radio_espectral);
+    if (d.converge == PRONOSTICO_NO_CONVERGE)
     {
-        suma = 0.0;
+        printf("[ADVERTENCIA] El radio espectral es mayor que 1: el método de %s no converge.\n", nombre);
+        return 0;
+    }
+    if (d.converge == PRONOSTICO_INCIERTO)
+        printf("[ADVERTENCIA] El radio espectral está muy cerca de 1: no se puede asegurar que %s "
+               "converja. Se itera y se detiene si el error no disminuye.\n", nombre);
+    if (d.iteraciones_estimadas >= 0)
+        printf("Iteraciones previstas para la tolerancia pedida: %d\n", d.iteraciones_estimadas);
+    if (d.iteraciones_estimadas > param->max_iter)
+        printf("[ADVERTENCIA] Se prevén más de %d iteraciones; el método puede detenerse antes de converger.\n",
+               param->max_iter);
+    return 1;
+}
 
-        // Calcular la suma de los valores absolutos de los elementos no diagonales en la fila i
-        for (int j = 0; j < n; j++)
-        {
-            // Sumar los valores absolutos de los elementos no diagonales
-            if (i != j)
-                suma += fabs(A[i][j]);
-        }
+void jacobi (double **A, double *b, int n, EspacioTrabajo *espacio)
+{
+    double suma = 0.0;
 
-        // Verificar la condición de diagonalmente dominante
-        if (fabs(A[i][i]) < suma)
-        {
-            printf("[ADVERTENCIA] La matriz no es diagonalmente dominante en la fila %d.\n", i);
-            printf("El método de Jacobi puede no converger.\n");
-            exit(EXIT_FAILURE);
-        }
-        // Verificar que el elemento diagonal no sea cero
-        if (A[i][i] == 0)
+    // El sistema se copia una vez al espacio de trabajo (que sólo reserva memoria si n
+    // supera su capacidad): el análisis previo y las iteraciones leen esa copia contigua
+    if (cargarEspacioTrabajo(espacio, A, b, n) != 0)
+    {
+        printf("[ERROR] No se pudo asignar memoria para el sistema.\n");
+        exit(EXIT_FAILURE);
+    }
+    const MatrizDensa *M = &espacio->A;
+
+    // Verificar que ningún elemento diagonal sea cero
+    for (int i = 0; i < n; i++)
+    {
+        if (MD(M, i, i) == 0)
         {
             printf("[ERROR] La matriz tiene un elemento diagonal cero en la fila %d.\n", i);
             printf("El método de Jacobi no puede aplicarse.\n");
@@ -379,14 +432,9 @@ void jacobi (double **A, double *b, int n)
         }
     }
 
-    // Implementación del método de Jacobi
-    double *x_nuevo = (double *)malloc(n * sizeof(double)); // Vector solución nuevo
-    double *x_viejo = (double *)malloc(n * sizeof(double)); // Vector solución anterior
-    if (x_nuevo == NULL || x_viejo == NULL)
-    {
-        printf("[ERROR] No se pudo asignar memoria para los vectores solución.\n");
-        exit(EXIT_FAILURE);
-    }
+    // Implementación del método de Jacobi: los vectores solución son los del espacio de trabajo
+    double *x_nuevo = espacio->aux; // Vector solución nuevo
+    double *x_viejo = espacio->x;   // Vector solución anterior
 
     // Inicializar x_viejo con ceros
     for (int i = 0; i < n; i++)
@@ -395,12 +443,19 @@ void jacobi (double **A, double *b, int n)
     int iteracion = 0; // Contador de iteraciones
     double tol = 0.0;  // Tolerancia para la convergencia
     double error = 0.0; // Error de la iteración
-    double error_viejo = 1000.0; // Error para control
+    ControlConvergencia control; // Historia del error para detectar divergencia o estancamiento
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int detener = 0;
 
     printf("Ingrese la tolerancia deseada (ej. 0.0001 = 1e-4): ");
     scanf("%lf", &tol);
     while (getchar() != '\n'); // Limpia el buffer
 
+    ParametrosIterativos param = { tol, MAX_ITER, 1.0 };
+    if (!verificarConvergencia(espacio, METODO_JACOBI, &param, "Jacobi"))
+        return; // Se vuelve al menú
+    iniciarControlConvergencia(&control);
+
     printf("\n--------------------------------------------------\n");
     printf("Iteración | Error          | Valores aproximados\n");
     printf("--------------------------------------------------\n");
@@ -413,9 +468,9 @@ void jacobi (double **A, double *b, int n)
             for (int j = 0; j < n; j++)
             {
                 if (i != j)
-                    suma += A[i][j] * x_viejo[j];
+                    suma += MD(M, i, j) * x_viejo[j];
             }
-            x_nuevo[i] = (b[i] - suma) / A[i][i];
+            x_nuevo[i] = (espacio->b[i] - suma) / MD(M, i, i);
         }
 
         error = 0.0; // Reiniciar el error para la siguiente iteración
@@ -429,14 +484,12 @@ void jacobi (double **A, double *b, int n)
             printf(" %10.6lf", x_nuevo[i]);
         printf("\n");
 
-        if (error > error_viejo)
+        detener = controlarConvergencia(&control, error, iteracion + 1, &param, &estado);
+        if (detener && estado == SOLVER_DIVERGE)
         {
             printf("[ADVERTENCIA] El método de Jacobi no está convergiendo.\n");
-            free(x_nuevo);
-            free(x_viejo);
             exit(EXIT_FAILURE);
         }
-        error_viejo = error;
 
         // Actualizar x_viejo para la siguiente iteración
         for (size_t i = 0; i < n; i++)
@@ -444,50 +497,40 @@ void jacobi (double **A, double *b, int n)
 
         iteracion++;
 
-    } while (error > tol && iteracion < MAX_ITER);
+    } while (!detener);
 
     printf("--------------------------------------------------\n");
-    printf("\nEl método de Jacobi convergió en %d iteraciones con un error de %.6e\n", iteracion, error);
+    if (estado == SOLVER_OK)
+        printf("\nEl método de Jacobi convergió en %d iteraciones con un error de %.6e\n", iteracion, error);
+    else
+        printf("\n[ADVERTENCIA] El método de Jacobi se detuvo tras %d iteraciones sin alcanzar la tolerancia "
+               "(error %.6e): la convergencia es demasiado lenta para %d iteraciones.\n", iteracion, error, MAX_ITER);
     printf("Solución aproximada:\n");
     printf("--------------------------------------------------\n");
     for (size_t i = 0; i < n; i++)
         printf("  x[%zu] = %10.6lf\n", i, x_nuevo[i]);
     printf("--------------------------------------------------\n");
-
-    // Liberar memoria
-    free(x_nuevo);
-    free(x_viejo);
 }
 
-void gaussSeidel(double **A, double *b, int n)
+void gaussSeidel(double **A, double *b, int n, EspacioTrabajo *espacio)
 {
     double suma = 0.0; // Variable para acumular sumas parciales en cada ecuación
 
-    // Paso 1: Verificar si la matriz es diagonalmente dominante
-    // Una matriz es diagonalmente dominante si en cada fila, el valor absoluto
-    // del elemento diagonal es mayor que la suma de los valores absolutos de los
-    // elementos no diagonales en esa fila. Esto asegura convergencia en métodos iterativos.
-    for (int i = 0; i < n; i++)
+    // Paso 1: Copiar el sistema al espacio de trabajo (sólo reserva memoria si n supera
+    // su capacidad); el análisis previo y las iteraciones leen esa copia contigua.
+    if (cargarEspacioTrabajo(espacio, A, b, n) != 0)
     {
-        suma = 0.0;
-
-        // Calcular la suma de los valores absolutos de los elementos no diagonales en la fila i
-        for (int j = 0; j < n; j++)
-        {
-            // Sumar los valores absolutos de los elementos no diagonales
-            if (i != j)
-                suma += fabs(A[i][j]);
-        }
+        printf("[ERROR] No se pudo asignar memoria para el sistema.\n");
+        exit(EXIT_FAILURE);
+    }
+    const MatrizDensa *M = &espacio->A;
 
-        // Verificar la condición de diagonalmente dominante
-        if (fabs(A[i][i]) < suma)
-        {
-            printf("[ADVERTENCIA] La matriz no es diagonalmente dominante en la fila %d.\n", i);
-            printf("El método de Gauss-Seidel puede no converger.\n");
-            exit(EXIT_FAILURE);
-        }
-        // Verificar que el elemento diagonal no sea cero (evitar división por cero)
-        if (A[i][i] == 0)
+    // Verificar que ningún elemento diagonal sea cero (evitar división por cero).
+    // La convergencia (dominancia diagonal y radio espectral) se analiza una vez
+    // conocidos la tolerancia y omega.
+    for (int i = 0; i < n; i++)
+    {
+        if (MD(M, i, i) == 0)
         {
             printf("[ERROR] La matriz tiene un elemento diagonal cero en la fila %d.\n", i);
             printf("El método de Gauss-Seidel no puede aplicarse.\n");
@@ -496,15 +539,10 @@ void gaussSeidel(double **A, double *b, int n)
     }
 
     // Paso 2: Implementación del método de Gauss-Seidel
-    // Reservar memoria para los vectores de solución: x_nuevo para la iteración actual,
-    // x_viejo para la iteración anterior.
-    double *x_nuevo = (double *)malloc(n * sizeof(double)); // Vector solución nuevo
-    double *x_viejo = (double *)malloc(n * sizeof(double)); // Vector solución anterior
-    if (x_nuevo == NULL || x_viejo == NULL)
-    {
-        printf("[ERROR] No se pudo asignar memoria para los vectores solución.\n");
-        exit(EXIT_FAILURE);
-    }
+    // Vectores de solución: x_nuevo para la iteración actual, x_viejo para la anterior.
+    // Son los del espacio de trabajo.
+    double *x_nuevo = espacio->aux; // Vector solución nuevo
+    double *x_viejo = espacio->x;   // Vector solución anterior
 
     // Inicializar x_viejo con ceros (aproximación inicial)
     for (int i = 0; i < n; i++)
@@ -513,7 +551,9 @@ void gaussSeidel(double **A, double *b, int n)
     int iteracion = 0; // Contador de iteraciones realizadas
     double tol = 0.0;  // Tolerancia para la convergencia (ingresada por el usuario)
     double error = 0.0; // Error de la iteración actual (norma euclidiana de la diferencia)
-    double error_viejo = 1000.0; // Error de la iteración anterior (inicializado alto para control)
+    ControlConvergencia control; // Historia del error para detectar divergencia o estancamiento
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int detener = 0;
 
     // Solicitar la tolerancia al usuario
     printf("Ingrese la tolerancia deseada (ej. 0.0001 = 1e-4): ");
@@ -530,6 +570,12 @@ void gaussSeidel(double **A, double *b, int n)
         omega = 1.0;
     }
 
+    // Análisis previo: si el radio espectral de la matriz de iteración es claramente > 1, no se itera
+    ParametrosIterativos param = { tol, MAX_ITER, omega };
+    if (!verificarConvergencia(espacio, METODO_GAUSS_SEIDEL, &param, "Gauss-Seidel"))
+        return; // Se vuelve al menú
+    iniciarControlConvergencia(&control);
+
     // Imprimir encabezado de la tabla de iteraciones
     printf("\n--------------------------------------------------\n");
     printf("Iteración | Error          | Valores aproximados\n");
@@ -549,21 +595,21 @@ void gaussSeidel(double **A, double *b, int n)
             {
                 // Suma de A[0][j] * x_viejo[j] para j desde 1 hasta n-1
                 for (size_t j = 1; j < n; j++)
-                    suma += A[i][j] * x_viejo[j];
+                    suma += MD(M, i, j) * x_viejo[j];
                 // Calcular x_nuevo[0] = (b[0] - suma) / A[0][0]
-                x_nuevo[i] = (b[i] - suma) / A[i][i];
+                x_nuevo[i] = (espacio->b[i] - suma) / MD(M, i, i);
             }
             else
             {
                 // Para i > 0: usar x_nuevo para j < i (valores ya actualizados) y x_viejo para j > i
-                // Suma de A[i][j] * x_nuevo[j] para j desde 0 hasta i-1
+                // Suma de MD(M, i, j) * x_nuevo[j] para j desde 0 hasta i-1
                 for (size_t j = 0; j < i; j++)
-                    suma += A[i][j] * x_nuevo[j];
-                // Suma de A[i][j] * x_viejo[j] para j desde i+1 hasta n-1
+                    suma += MD(M, i, j) * x_nuevo[j];
+                // Suma de MD(M, i, j) * x_viejo[j] para j desde i+1 hasta n-1
                 for (size_t j = (i + 1); j < n; j++)
-                    suma += A[i][j] * x_viejo[j];
+                    suma += MD(M, i, j) * x_viejo[j];
                 // Calcular x_nuevo[i] = (b[i] - suma) / A[i][i]
-                x_nuevo[i] = (b[i] - suma) / A[i][i];
+                x_nuevo[i] = (espacio->b[i] - suma) / MD(M, i, i);
             }
 
             // Implementar relajación (SOR)
@@ -583,15 +629,13 @@ void gaussSeidel(double **A, double *b, int n)
             printf(" %10.6lf", x_nuevo[i]);
         printf("\n");
 
-        // Verificar si el método está divergiendo (error aumentando)
-        if (error > error_viejo)
+        // Verificar si el método está divergiendo (error aumentando) o estancado
+        detener = controlarConvergencia(&control, error, iteracion + 1, &param, &estado);
+        if (detener && estado == SOLVER_DIVERGE)
         {
             printf("[ADVERTENCIA] El método de Gauss-Seidel no está convergiendo.\n");
-            free(x_nuevo);
-            free(x_viejo);
             exit(EXIT_FAILURE);
         }
-        error_viejo = error; // Actualizar error_viejo para la próxima comparación
 
         // Actualizar x_viejo con los valores de x_nuevo para la siguiente iteración
         for (size_t i = 0; i < n; i++)
@@ -599,18 +643,18 @@ void gaussSeidel(double **A, double *b, int n)
 
         iteracion++; // Incrementar contador de iteraciones
 
-    } while (error > tol && iteracion < MAX_ITER); // Condición de parada
+    } while (!detener); // Condición de parada (ver controlarConvergencia)
 
     // Paso 5: Imprimir resultados finales
     printf("--------------------------------------------------\n");
-    printf("\nEl método de Gauss-Seidel convergió en %d iteraciones con un error de %.6e\n", iteracion, error);
+    if (estado == SOLVER_OK)
+        printf("\nEl método de Gauss-Seidel convergió en %d iteraciones con un error de %.6e\n", iteracion, error);
+    else
+        printf("\n[ADVERTENCIA] El método de Gauss-Seidel se detuvo tras %d iteraciones sin alcanzar la tolerancia "
+               "(error %.6e): la convergencia es demasiado lenta para %d iteraciones.\n", iteracion, error, MAX_ITER);
     printf("Solución aproximada:\n");
     printf("--------------------------------------------------\n");
     for (size_t i = 0; i < n; i++)
         printf("  x[%zu] = %10.6lf\n", i, x_nuevo[i]);
     printf("--------------------------------------------------\n");
-
-    // Liberar memoria dinámica asignada
-    free(x_nuevo);
-    free(x_viejo);
 }
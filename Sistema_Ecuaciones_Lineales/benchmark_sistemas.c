@@ -0,0 +1,826 @@
+/**
+ * @file benchmark_sistemas.c
+ * @brief Banco de pruebas de rendimiento de los solvers de sistemas lineales (salida CSV).
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Genera matrices aleatorias (reproducibles con --semilla) de cinco tipos:
+ *
+ *   - dd:          densa, no simétrica, estrictamente diagonal dominante.
+ *   - spd:         densa, simétrica y diagonal dominante con diagonal positiva
+ *                  (por lo tanto definida positiva).
+ *   - banda:       ANCHO_BANDA diagonales a cada lado de la principal, diagonal dominante.
+ *   - tridiagonal: tres diagonales, diagonal dominante.
+ *   - dispersa:    CSR simétrica con unos NNZ_POR_FILA no nulos por fila, definida positiva.
+ *
+ * y mide cada solver compatible con cada tipo y tamaño. Por cada caso escribe una
+ * línea CSV:
+ *
+ *   matriz,n,solver,estado,tiempo_s,gflops,iteraciones,residuo,memoria_pico_kb
+ *
+ * - tiempo_s: tiempo de reloj (CLOCK_MONOTONIC) sólo del solver, sin generar la
+ *   matriz; con los solvers multihilo clock() sumaría el tiempo de todos los hilos.
+ * - gflops: operaciones de punto flotante del algoritmo (modelo teórico, ver
+ *   flopsCaso()) divididas por el tiempo.
+ * - residuo: ||b - A x||₂ / ||b||₂ calculado con la matriz original.
+ * - memoria_pico_kb: máximo de memoria residente (getrusage) del caso. Con
+ *   jacobi-procesos es la del proceso 0 (su bloque de filas más la matriz generada).
+ *
+ * Cada caso se ejecuta en un proceso hijo (fork), de modo que el pico de memoria
+ * es el de ese caso y no el de los anteriores, y un caso que agota la memoria no
+ * interrumpe el resto (se informa con estado ABORTADO).
+ *
+ * Uso:
+ *   ./benchmark.o [--tamanos 10,100,1000] [--matrices dd,spd,banda,tridiagonal,dispersa]
+ *                 [--solvers gauss,lu,...|todos] [--max-densa n] [--max-directos n]
+ *                 [--tol t] [--max-iter k] [--hilos h] [--semilla s] [--salida archivo.csv]
+ *
+ * Compilación (desde Sistema_Ecuaciones_Lineales):
+ *   gcc -O3 -march=native benchmark_sistemas.c matriz_densa/matriz_densa.c \
+ *       factorizacion_lu/factorizacion_lu.c pool_hilos/pool_hilos.c \
+ *       iterativos_paralelos/iterativos_paralelos.c jacobi_procesos/jacobi_procesos.c \
+ *       matriz_dispersa/matriz_dispersa.c krylov/krylov.c matriz_banda/matriz_banda.c precision_mixta/precision_mixta.c \
+ *       espacio_trabajo/espacio_trabajo.c factorizacion_cholesky/factorizacion_cholesky.c \
+ *       nucleos_simd/nucleos_simd.c ../Ajuste_de_curvas/gauss_con_pivot.c -o benchmark.o -lm -pthread
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include "matriz_densa/matriz_densa.h"
+#include "factorizacion_lu/factorizacion_lu.h"
+#include "iterativos_paralelos/iterativos_paralelos.h"
+#include "jacobi_procesos/jacobi_procesos.h"
+#include "matriz_dispersa/matriz_dispersa.h"
+#include "krylov/krylov.h"
+#include "matriz_banda/matriz_banda.h"
+#include "precision_mixta/precision_mixta.h"
+#include "factorizacion_cholesky/factorizacion_cholesky.h"
+#include "nucleos_simd/nucleos_simd.h"
+#include "../Ajuste_de_curvas/gauss_con_pivot.h"
+
+#define ANCHO_BANDA 8           // Diagonales a cada lado de la principal en las matrices banda
+#define NNZ_POR_FILA 8          // No nulos fuera de la diagonal generados por fila (dispersa)
+#define REINICIO_GMRES 30       // Dimensión del subespacio de GMRES antes de reiniciar
+#define MAX_TAMANOS 32          // Cantidad máxima de tamaños en --tamanos
+
+/**
+ * @brief Tipos de matriz generados (máscara de bits).
+ */
+typedef enum
+{
+    MATRIZ_DD = 1,
+    MATRIZ_SPD = 2,
+    MATRIZ_BANDA = 4,
+    MATRIZ_TRIDIAGONAL = 8,
+    MATRIZ_DISPERSA = 16
+} TipoMatriz;
+
+static const struct
+{
+    TipoMatriz tipo;
+    const char *nombre;
+} TIPOS_MATRIZ[] = {
+    { MATRIZ_DD, "dd" },
+    { MATRIZ_SPD, "spd" },
+    { MATRIZ_BANDA, "banda" },
+    { MATRIZ_TRIDIAGONAL, "tridiagonal" },
+    { MATRIZ_DISPERSA, "dispersa" },
+};
+#define CANTIDAD_TIPOS ((int)(sizeof(TIPOS_MATRIZ) / sizeof(TIPOS_MATRIZ[0])))
+
+#define MATRICES_DENSAS (MATRIZ_DD | MATRIZ_SPD)
+
+/**
+ * @brief Solvers medidos y tipos de matriz a los que se aplican.
+ */
+static const struct
+{
+    const char *nombre;
+    int matrices;       // Máscara de TipoMatriz compatibles
+    int directo;        // 1: costo O(n³), limitado por --max-directos
+} SOLVERS[] = {
+    { "gauss", MATRICES_DENSAS, 1 },            // eliminacionGaussDensa()
+    { "gauss-pivot", MATRICES_DENSAS, 1 },      // gaussPivotDensa()
+    { "lu", MATRICES_DENSAS, 1 },               // factorizarLU() + resolverLU()
+    { "mixta", MATRICES_DENSAS, 1 },            // resolverPrecisionMixta()
+    { "cholesky", MATRIZ_SPD, 1 },              // factorizarCholesky() + resolverCholesky()
+    { "jacobi", MATRICES_DENSAS, 0 },           // jacobiDensa()
+    { "gauss-seidel", MATRICES_DENSAS, 0 },     // gaussSeidelDensa()
+    { "jacobi-paralelo", MATRICES_DENSAS, 0 },  // jacobiParalelo()
+    { "gs-multicolor", MATRICES_DENSAS, 0 },    // gaussSeidelMulticolor() (SOR)
+    { "jacobi-procesos", MATRICES_DENSAS, 0 },  // jacobiProcesos(), --hilos procesos
+    { "cg", MATRIZ_SPD, 0 },                    // gradienteConjugadoDensa(), precond. Jacobi
+    { "gmres", MATRICES_DENSAS, 0 },            // gmres() sobre operadorDensa(), precond. Jacobi
+    { "bicgstab", MATRICES_DENSAS, 0 },         // bicgstab() sobre operadorDensa(), precond. Jacobi
+    { "banda", MATRIZ_BANDA, 0 },               // eliminacionGaussBanda()
+    { "thomas", MATRIZ_TRIDIAGONAL, 0 },        // resolverTridiagonal()
+    { "jacobi-csr", MATRIZ_DISPERSA, 0 },       // jacobiCSR()
+    { "gs-csr", MATRIZ_DISPERSA, 0 },           // gaussSeidelCSR()
+    { "cg-csr", MATRIZ_DISPERSA, 0 },           // gradienteConjugadoCSR(), precond. IC(0)
+    { "gmres-csr", MATRIZ_DISPERSA, 0 },        // gmres() sobre operadorCSR(), precond. ILU(0)
+    { "bicgstab-csr", MATRIZ_DISPERSA, 0 },     // bicgstab() sobre operadorCSR(), precond. ILU(0)
+};
+#define CANTIDAD_SOLVERS ((int)(sizeof(SOLVERS) / sizeof(SOLVERS[0])))
+
+/**
+ * @brief Opciones de la línea de comandos.
+ */
+typedef struct
+{
+    int tamanos[MAX_TAMANOS];       // Tamaños n a medir
+    int cantidad_tamanos;
+    int matrices;                   // Máscara de TipoMatriz a generar
+    const char *solvers;            // Lista separada por comas, o NULL para todos
+    int max_densa;                  // Mayor n para matrices densas (memoria O(n²))
+    int max_directos;               // Mayor n para los solvers O(n³)
+    ParametrosIterativos param;     // Tolerancia y máximo de iteraciones de los iterativos
+    int hilos;                      // Hilos (o procesos) de los solvers paralelos (<= 0: uno por núcleo)
+    unsigned int semilla;           // Semilla de las matrices aleatorias
+    const char *salida;             // Archivo CSV (NULL: salida estándar)
+} OpcionesBenchmark;
+
+/**
+ * @brief Sistema generado para un caso: sólo se usa el campo que corresponde al tipo.
+ */
+typedef struct
+{
+    TipoMatriz tipo;
+    int n;
+    MatrizDensa densa;              // dd, spd
+    MatrizBanda banda;              // banda
+    double *tri;                    // tridiagonal: 3n valores (inferior, diagonal, superior)
+    MatrizCSR csr;                  // dispersa
+    double *b;                      // Términos independientes (b = A * x_exacta)
+} SistemaGenerado;
+
+/* Generador congruencial propio: la secuencia no depende de la libc */
+static unsigned long long estado_aleatorio;
+
+static double aleatorioUniforme(void)
+{
+    estado_aleatorio = estado_aleatorio * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (double)(estado_aleatorio >> 11) / 9007199254740992.0; // [0, 1)
+}
+
+static double aleatorioSimetrico(void)
+{
+    return 2.0 * aleatorioUniforme() - 1.0; // [-1, 1)
+}
+
+static double segundosMonotonicos(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + 1e-9 * (double)t.tv_nsec;
+}
+
+/* Producto A*x para cualquier tipo de sistema generado */
+static void productoSistema(const SistemaGenerado *S, const double *x, double *y)
+{
+    int n = S->n;
+    switch (S->tipo)
+    {
+    case MATRIZ_DD:
+    case MATRIZ_SPD:
+        productoMatrizVector(&S->densa, x, y);
+        break;
+    case MATRIZ_BANDA:
+        productoBandaVector(&S->banda, x, y);
+        break;
+    case MATRIZ_TRIDIAGONAL:
+        for (int i = 0; i < n; i++)
+        {
+            double suma = S->tri[n + i] * x[i];
+            if (i > 0)
+                suma += S->tri[i] * x[i - 1];
+            if (i < n - 1)
+                suma += S->tri[2 * n + i] * x[i + 1];
+            y[i] = suma;
+        }
+        break;
+    case MATRIZ_DISPERSA:
+        productoCSRVector(&S->csr, x, y);
+        break;
+    }
+}
+
+static void liberarSistema(SistemaGenerado *S)
+{
+    if (S->tipo & MATRICES_DENSAS)
+        liberarMatrizDensa(&S->densa);
+    else if (S->tipo == MATRIZ_BANDA)
+        liberarMatrizBanda(&S->banda);
+    else if (S->tipo == MATRIZ_DISPERSA)
+        liberarMatrizCSR(&S->csr);
+    free(S->tri);
+    free(S->b);
+}
+
+/* Genera una matriz dispersa CSR simétrica y definida positiva */
+static int generarDispersa(SistemaGenerado *S)
+{
+    int n = S->n;
+    int por_fila = (NNZ_POR_FILA < n - 1) ? NNZ_POR_FILA : n - 1;
+    // Cada no nulo generado se agrega en (i, j) y en (j, i), más la diagonal
+    int cantidad = n * por_fila + n;
+    int *fila = (int *)malloc((size_t)cantidad * sizeof(int));
+    int *columna = (int *)malloc((size_t)cantidad * sizeof(int));
+    double *valor = (double *)malloc((size_t)cantidad * sizeof(double));
+    double *suma_fila = (double *)calloc((size_t)n, sizeof(double));
+    if (fila == NULL || columna == NULL || valor == NULL || suma_fila == NULL)
+    {
+        free(fila);
+        free(columna);
+        free(valor);
+        free(suma_fila);
+        return 1;
+    }
+
+    int k = 0;
+    for (int i = 0; i < n; i++)
+    {
+        // Las columnas se eligen cerca de la diagonal y al azar en toda la fila (mitad y mitad)
+        for (int m = 0; m < por_fila / 2; m++)
+        {
+            int j;
+            if (m % 2 == 0)
+                j = i + 1 + (int)(aleatorioUniforme() * ANCHO_BANDA);
+            else
+                j = (int)(aleatorioUniforme() * n);
+            if (j >= n || j == i)
+                continue;
+            double v = aleatorioSimetrico();
+            fila[k] = i, columna[k] = j, valor[k++] = v;
+            fila[k] = j, columna[k] = i, valor[k++] = v;
+            suma_fila[i] += fabs(v);
+            suma_fila[j] += fabs(v);
+        }
+    }
+    for (int i = 0; i < n; i++)
+    {
+        fila[k] = i, columna[k] = i, valor[k++] = suma_fila[i] + 1.0;
+    }
+
+    int error = csrDesdeTripletas(&S->csr, n, n, k, fila, columna, valor);
+    free(fila);
+    free(columna);
+    free(valor);
+    free(suma_fila);
+    return error;
+}
+
+/**
+ * @brief Genera el sistema de tipo y tamaño pedidos, con solución exacta conocida.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+static int generarSistema(SistemaGenerado *S, TipoMatriz tipo, int n, unsigned int semilla)
+{
+    memset(S, 0, sizeof(SistemaGenerado));
+    S->tipo = tipo;
+    S->n = n;
+    estado_aleatorio = ((unsigned long long)semilla << 32) ^ ((unsigned long long)n * 2654435761ULL) ^ (unsigned)tipo;
+
+    int error = 0;
+    switch (tipo)
+    {
+    case MATRIZ_DD:
+    case MATRIZ_SPD:
+        if (crearMatrizDensa(&S->densa, n, n) != 0)
+            return 1;
+        for (int i = 0; i < n; i++)
+        {
+            double *fila = filaMatrizDensa(&S->densa, i);
+            // spd: se genera el triángulo superior y se copia al inferior
+            for (int j = (tipo == MATRIZ_SPD ? i + 1 : 0); j < n; j++)
+                if (j != i)
+                    fila[j] = aleatorioSimetrico();
+            if (tipo == MATRIZ_SPD)
+                for (int j = 0; j < i; j++)
+                    fila[j] = MD(&S->densa, j, i);
+        }
+        for (int i = 0; i < n; i++)
+        {
+            double *fila = filaMatrizDensa(&S->densa, i);
+            double suma = 0.0;
+            for (int j = 0; j < n; j++)
+                suma += fabs(fila[j]);
+            fila[i] = suma + 1.0;
+        }
+        break;
+
+    case MATRIZ_BANDA:
+        if (crearMatrizBanda(&S->banda, n, ANCHO_BANDA, ANCHO_BANDA) != 0)
+            return 1;
+        for (int i = 0; i < n; i++)
+        {
+            int desde = (i - ANCHO_BANDA > 0) ? i - ANCHO_BANDA : 0;
+            int hasta = (i + ANCHO_BANDA < n - 1) ? i + ANCHO_BANDA : n - 1;
+            double suma = 0.0;
+            for (int j = desde; j <= hasta; j++)
+            {
+                if (j == i)
+                    continue;
+                MB(&S->banda, i, j) = aleatorioSimetrico();
+                suma += fabs(MB(&S->banda, i, j));
+            }
+            MB(&S->banda, i, i) = suma + 1.0;
+        }
+        break;
+
+    case MATRIZ_TRIDIAGONAL:
+        S->tri = (double *)calloc((size_t)3 * n, sizeof(double));
+        if (S->tri == NULL)
+            return 1;
+        for (int i = 0; i < n; i++)
+        {
+            double inferior = (i > 0) ? aleatorioSimetrico() : 0.0;
+            double superior = (i < n - 1) ? aleatorioSimetrico() : 0.0;
+            S->tri[i] = inferior;
+            S->tri[2 * n + i] = superior;
+            S->tri[n + i] = fabs(inferior) + fabs(superior) + 1.0;
+        }
+        break;
+
+    case MATRIZ_DISPERSA:
+        error = generarDispersa(S);
+        break;
+    }
+    if (error != 0)
+        return 1;
+
+    // b = A * x_exacta con x_exacta_i = 1 + (i mod 10) / 10
+    double *exacta = (double *)malloc((size_t)n * sizeof(double));
+    S->b = (double *)malloc((size_t)n * sizeof(double));
+    if (exacta == NULL || S->b == NULL)
+    {
+        free(exacta);
+        return 1;
+    }
+    for (int i = 0; i < n; i++)
+        exacta[i] = 1.0 + (double)(i % 10) / 10.0;
+    productoSistema(S, exacta, S->b);
+    free(exacta);
+    return 0;
+}
+
+/* Cantidad de no nulos de la matriz (para el modelo de operaciones) */
+static double noNulosSistema(const SistemaGenerado *S)
+{
+    switch (S->tipo)
+    {
+    case MATRIZ_DD:
+    case MATRIZ_SPD:
+        return (double)S->n * (double)S->n;
+    case MATRIZ_BANDA:
+        return (double)S->n * (2 * ANCHO_BANDA + 1);
+    case MATRIZ_TRIDIAGONAL:
+        return 3.0 * S->n;
+    case MATRIZ_DISPERSA:
+        return (double)S->csr.nnz;
+    }
+    return 0.0;
+}
+
+/**
+ * @brief Operaciones de punto flotante del solver según el modelo teórico de cada algoritmo.
+ * @details Directos: 2n³/3 para la eliminación más 2n² por sustitución (mixta
+ *          agrega 4n² por paso de refinamiento; Cholesky hace n³/3). Iterativos: 2·nnz por producto
+ *          A*x o barrido, más las operaciones vectoriales de cada método.
+ */
+static double flopsCaso(const char *solver, const SistemaGenerado *S, int iteraciones)
+{
+    double n = S->n;
+    double nnz = noNulosSistema(S);
+    double k = iteraciones;
+
+    if (strcmp(solver, "gauss") == 0 || strcmp(solver, "gauss-pivot") == 0 || strcmp(solver, "lu") == 0)
+        return 2.0 * n * n * n / 3.0 + 2.0 * n * n;
+    if (strcmp(solver, "mixta") == 0)
+        return 2.0 * n * n * n / 3.0 + 2.0 * n * n + k * 4.0 * n * n;
+    if (strcmp(solver, "cholesky") == 0)
+        return n * n * n / 3.0 + 2.0 * n * n;
+    if (strcmp(solver, "banda") == 0)
+        return 2.0 * n * ANCHO_BANDA * (2.0 * ANCHO_BANDA + 1.0) + 2.0 * n * (2.0 * ANCHO_BANDA + 1.0);
+    if (strcmp(solver, "thomas") == 0)
+        return 8.0 * n;
+    if (strncmp(solver, "cg", 2) == 0)
+        return k * (2.0 * nnz + 12.0 * n);
+    if (strncmp(solver, "gmres", 5) == 0)
+        return k * (2.0 * nnz + 2.0 * n * (REINICIO_GMRES + 1) + 4.0 * n);
+    if (strncmp(solver, "bicgstab", 8) == 0)
+        return k * (4.0 * nnz + 24.0 * n);
+    // jacobi, gauss-seidel y sus variantes: un barrido por iteración
+    return k * (2.0 * nnz + 3.0 * n);
+}
+
+/* Residuo relativo ||b - A x||₂ / ||b||₂ con la matriz original */
+static double residuoRelativo(const SistemaGenerado *S, const double *x)
+{
+    int n = S->n;
+    double *r = (double *)malloc((size_t)n * sizeof(double));
+    if (r == NULL)
+        return NAN;
+    productoSistema(S, x, r);
+    double suma_r = 0.0, suma_b = 0.0;
+    for (int i = 0; i < n; i++)
+    {
+        double d = S->b[i] - r[i];
+        suma_r += d * d;
+        suma_b += S->b[i] * S->b[i];
+    }
+    free(r);
+    return (suma_b > 0.0) ? sqrt(suma_r / suma_b) : sqrt(suma_r);
+}
+
+/**
+ * @brief Ejecuta un solver sobre el sistema y mide sólo el tiempo de resolución.
+ * @details Los solvers que modifican A o b trabajan sobre copias hechas antes de
+ *          empezar a medir.
+ */
+static EstadoSolver ejecutarSolver(const char *solver, const SistemaGenerado *S,
+                                   const OpcionesBenchmark *op, double *x,
+                                   ResultadoIterativo *res, double *segundos)
+{
+    int n = S->n;
+    EstadoSolver estado = SOLVER_ERROR_MEMORIA;
+    res->iteraciones = 0;
+    res->error = 0.0;
+    for (int i = 0; i < n; i++)
+        x[i] = 0.0;
+
+    // Copias para los solvers que destruyen sus datos
+    MatrizDensa copia = { 0, 0, 0, NULL };
+    MatrizBanda copia_banda;
+    memset(&copia_banda, 0, sizeof(MatrizBanda));
+    double *b = (double *)malloc((size_t)n * sizeof(double));
+    if (b == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    memcpy(b, S->b, (size_t)n * sizeof(double));
+
+    int destructivo = strcmp(solver, "gauss") == 0 || strcmp(solver, "gauss-pivot") == 0;
+    if (destructivo && copiarMatrizDensa(&copia, &S->densa) != 0)
+    {
+        free(b);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    if (strcmp(solver, "banda") == 0)
+    {
+        if (crearMatrizBanda(&copia_banda, n, ANCHO_BANDA, ANCHO_BANDA) != 0)
+        {
+            free(b);
+            return SOLVER_ERROR_MEMORIA;
+        }
+        memcpy(copia_banda.datos, S->banda.datos, (size_t)n * S->banda.ancho * sizeof(double));
+    }
+
+    OperadorLineal operador;
+    Precondicionador P;
+    double inicio = segundosMonotonicos();
+
+    if (strcmp(solver, "gauss") == 0)
+        estado = eliminacionGaussDensa(&copia, b, x, NULL);
+    else if (strcmp(solver, "gauss-pivot") == 0)
+        estado = (gaussPivotDensa(&copia, b, x) == 0) ? SOLVER_OK : SOLVER_SINGULAR;
+    else if (strcmp(solver, "lu") == 0)
+    {
+        FactorizacionLU F;
+        estado = factorizarLU(&S->densa, &F, TAM_BLOQUE_LU);
+        if (estado == SOLVER_OK)
+            resolverLU(&F, b, x);
+        liberarFactorizacionLU(&F);
+    }
+    else if (strcmp(solver, "cholesky") == 0)
+    {
+        FactorizacionCholesky F;
+        estado = factorizarCholesky(&S->densa, &F);
+        if (estado == SOLVER_OK)
+            resolverCholesky(&F, b, x);
+        liberarFactorizacionCholesky(&F);
+    }
+    else if (strcmp(solver, "mixta") == 0)
+    {
+        ParametrosIterativos param_mixta = { 1e-14, 30, 1.0 };
+        estado = resolverPrecisionMixta(&S->densa, b, x, &param_mixta, res);
+    }
+    else if (strcmp(solver, "jacobi") == 0)
+        estado = jacobiDensa(&S->densa, b, x, &op->param, res);
+    else if (strcmp(solver, "gauss-seidel") == 0)
+        estado = gaussSeidelDensa(&S->densa, b, x, &op->param, res);
+    else if (strcmp(solver, "jacobi-paralelo") == 0)
+        estado = jacobiParalelo(&S->densa, b, x, &op->param, op->hilos, res);
+    else if (strcmp(solver, "gs-multicolor") == 0)
+        estado = gaussSeidelMulticolor(&S->densa, b, x, &op->param, 0, op->hilos, res);
+    else if (strcmp(solver, "jacobi-procesos") == 0)
+        estado = jacobiProcesos(&S->densa, b, x, &op->param, op->hilos, res);
+    else if (strcmp(solver, "cg") == 0)
+        estado = gradienteConjugadoDensa(&S->densa, b, x, PRECOND_JACOBI, &op->param, res, NULL);
+    else if (strcmp(solver, "gmres") == 0 || strcmp(solver, "bicgstab") == 0)
+    {
+        estado = crearPrecondicionadorDensa(&P, PRECOND_JACOBI, &S->densa);
+        if (estado == SOLVER_OK)
+        {
+            operador = operadorDensa(&S->densa);
+            if (solver[0] == 'g')
+                estado = gmres(&operador, b, x, &P, REINICIO_GMRES, &op->param, res, NULL);
+            else
+                estado = bicgstab(&operador, b, x, &P, &op->param, res, NULL);
+            liberarPrecondicionador(&P);
+        }
+    }
+    else if (strcmp(solver, "banda") == 0)
+        estado = eliminacionGaussBanda(&copia_banda, b, x);
+    else if (strcmp(solver, "thomas") == 0)
+        estado = resolverTridiagonal(n, S->tri, S->tri + n, S->tri + 2 * n, b, x);
+    else if (strcmp(solver, "jacobi-csr") == 0)
+        estado = jacobiCSR(&S->csr, b, x, &op->param, res);
+    else if (strcmp(solver, "gs-csr") == 0)
+        estado = gaussSeidelCSR(&S->csr, b, x, &op->param, res);
+    else if (strcmp(solver, "cg-csr") == 0)
+        estado = gradienteConjugadoCSR(&S->csr, b, x, PRECOND_CHOLESKY_INCOMPLETO, &op->param, res, NULL);
+    else if (strcmp(solver, "gmres-csr") == 0 || strcmp(solver, "bicgstab-csr") == 0)
+    {
+        estado = crearPrecondicionadorCSR(&P, PRECOND_LU_INCOMPLETO, &S->csr);
+        if (estado == SOLVER_OK)
+        {
+            operador = operadorCSR(&S->csr);
+            if (solver[0] == 'g')
+                estado = gmres(&operador, b, x, &P, REINICIO_GMRES, &op->param, res, NULL);
+            else
+                estado = bicgstab(&operador, b, x, &P, &op->param, res, NULL);
+            liberarPrecondicionador(&P);
+        }
+    }
+
+    *segundos = segundosMonotonicos() - inicio;
+
+    liberarMatrizDensa(&copia);
+    if (copia_banda.datos != NULL)
+        liberarMatrizBanda(&copia_banda);
+    free(b);
+    return estado;
+}
+
+/**
+ * @brief Genera el sistema, ejecuta el solver y escribe la línea CSV (en el proceso hijo).
+ * @return 0 si el solver terminó con SOLVER_OK, 1 en caso contrario.
+ */
+static int ejecutarCaso(const OpcionesBenchmark *op, int indice_tipo, int n, const char *solver, FILE *salida)
+{
+    SistemaGenerado S;
+    if (generarSistema(&S, TIPOS_MATRIZ[indice_tipo].tipo, n, op->semilla) != 0)
+    {
+        fprintf(stderr, "[ERROR] No se pudo generar la matriz %s de %d x %d\n", TIPOS_MATRIZ[indice_tipo].nombre, n, n);
+        liberarSistema(&S);
+        fprintf(salida, "%s,%d,%s,ERROR_MEMORIA,,,,,\n", TIPOS_MATRIZ[indice_tipo].nombre, n, solver);
+        return 1;
+    }
+
+    double *x = (double *)malloc((size_t)n * sizeof(double));
+    ResultadoIterativo res = { 0, 0.0 };
+    double segundos = 0.0;
+    EstadoSolver estado = SOLVER_ERROR_MEMORIA;
+    if (x != NULL)
+        estado = ejecutarSolver(solver, &S, op, x, &res, &segundos);
+
+    double residuo = (x != NULL && estado != SOLVER_ERROR_MEMORIA) ? residuoRelativo(&S, x) : NAN;
+    double gflops = (segundos > 0.0) ? flopsCaso(solver, &S, res.iteraciones) / segundos / 1e9 : 0.0;
+
+    struct rusage uso;
+    getrusage(RUSAGE_SELF, &uso);
+
+    fprintf(salida, "%s,%d,%s,%s,%.6e,%.4f,%d,%.3e,%ld\n", TIPOS_MATRIZ[indice_tipo].nombre, n, solver,
+            nombreEstadoSolver(estado), segundos, gflops, res.iteraciones, residuo, uso.ru_maxrss);
+
+    free(x);
+    liberarSistema(&S);
+    return estado == SOLVER_OK ? 0 : 1;
+}
+
+/* 1 si nombre aparece en la lista separada por comas */
+static int estaEnLista(const char *lista, const char *nombre)
+{
+    size_t largo = strlen(nombre);
+    const char *p = lista;
+    while (*p != '\0')
+    {
+        const char *coma = strchr(p, ',');
+        size_t largo_item = (coma != NULL) ? (size_t)(coma - p) : strlen(p);
+        if (largo_item == largo && strncmp(p, nombre, largo) == 0)
+            return 1;
+        if (coma == NULL)
+            break;
+        p = coma + 1;
+    }
+    return 0;
+}
+
+static void mostrarUso(const char *programa)
+{
+    fprintf(stderr, "Uso: %s [opciones]\n", programa);
+    fprintf(stderr, "  --tamanos <lista>     tamaños n separados por comas (por defecto 10,100,1000,2000,5000,10000,20000)\n");
+    fprintf(stderr, "  --matrices <lista>    dd, spd, banda, tridiagonal, dispersa (por defecto todas)\n");
+    fprintf(stderr, "  --solvers <lista>     nombres separados por comas o 'todos' (por defecto todos):\n                       ");
+    for (int s = 0; s < CANTIDAD_SOLVERS; s++)
+        fprintf(stderr, " %s", SOLVERS[s].nombre);
+    fprintf(stderr, "\n");
+    fprintf(stderr, "  --max-densa <n>       mayor n de las matrices densas (por defecto 5000)\n");
+    fprintf(stderr, "  --max-directos <n>    mayor n de los solvers O(n³) (por defecto 2000)\n");
+    fprintf(stderr, "  --tol <t>             tolerancia de los iterativos (por defecto 1e-10)\n");
+    fprintf(stderr, "  --max-iter <k>        máximo de iteraciones (por defecto 10000)\n");
+    fprintf(stderr, "  --hilos <h>           hilos (procesos en jacobi-procesos) de los solvers paralelos (por defecto uno por núcleo)\n");
+    fprintf(stderr, "  --semilla <s>         semilla de las matrices aleatorias (por defecto 1)\n");
+    fprintf(stderr, "  --salida <archivo>    archivo CSV (por defecto la salida estándar)\n");
+}
+
+/**
+ * @brief Interpreta los argumentos.
+ * @return 0 si son válidos, 1 en caso contrario.
+ */
+static int leerOpciones(int argc, char const *argv[], OpcionesBenchmark *op)
+{
+    static const int tamanos_defecto[] = { 10, 100, 1000, 2000, 5000, 10000, 20000 };
+    op->cantidad_tamanos = (int)(sizeof(tamanos_defecto) / sizeof(tamanos_defecto[0]));
+    memcpy(op->tamanos, tamanos_defecto, sizeof(tamanos_defecto));
+    op->matrices = MATRIZ_DD | MATRIZ_SPD | MATRIZ_BANDA | MATRIZ_TRIDIAGONAL | MATRIZ_DISPERSA;
+    op->solvers = NULL;
+    op->max_densa = 5000;
+    op->max_directos = 2000;
+    op->param.tolerancia = 1e-10;
+    op->param.max_iter = 10000;
+    op->param.omega = 1.0;
+    op->hilos = 0;
+    op->semilla = 1;
+    op->salida = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *valor = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--ayuda") == 0 || strcmp(argv[i], "-h") == 0)
+            return 1;
+        if (valor == NULL)
+        {
+            fprintf(stderr, "[ERROR] Falta el valor de la opción %s\n", argv[i]);
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--tamanos") == 0)
+        {
+            op->cantidad_tamanos = 0;
+            const char *p = valor;
+            while (*p != '\0' && op->cantidad_tamanos < MAX_TAMANOS)
+            {
+                char *fin;
+                long n = strtol(p, &fin, 10);
+                if (fin == p || n < 1 || n > 1000000000L)
+                {
+                    fprintf(stderr, "[ERROR] Lista de tamaños inválida: %s\n", valor);
+                    return 1;
+                }
+                op->tamanos[op->cantidad_tamanos++] = (int)n;
+                p = (*fin == ',') ? fin + 1 : fin;
+            }
+        }
+        else if (strcmp(argv[i], "--matrices") == 0)
+        {
+            op->matrices = 0;
+            for (int t = 0; t < CANTIDAD_TIPOS; t++)
+                if (estaEnLista(valor, TIPOS_MATRIZ[t].nombre))
+                    op->matrices |= TIPOS_MATRIZ[t].tipo;
+            if (op->matrices == 0)
+            {
+                fprintf(stderr, "[ERROR] Ningún tipo de matriz válido en: %s\n", valor);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--solvers") == 0)
+            op->solvers = (strcmp(valor, "todos") == 0) ? NULL : valor;
+        else if (strcmp(argv[i], "--max-densa") == 0)
+            op->max_densa = atoi(valor);
+        else if (strcmp(argv[i], "--max-directos") == 0)
+            op->max_directos = atoi(valor);
+        else if (strcmp(argv[i], "--tol") == 0)
+            op->param.tolerancia = strtod(valor, NULL);
+        else if (strcmp(argv[i], "--max-iter") == 0)
+            op->param.max_iter = atoi(valor);
+        else if (strcmp(argv[i], "--hilos") == 0)
+            op->hilos = atoi(valor);
+        else if (strcmp(argv[i], "--semilla") == 0)
+            op->semilla = (unsigned int)strtoul(valor, NULL, 10);
+        else if (strcmp(argv[i], "--salida") == 0)
+            op->salida = valor;
+        else
+        {
+            fprintf(stderr, "[ERROR] Opción desconocida: %s\n", argv[i]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (op->param.tolerancia <= 0 || op->param.max_iter <= 0)
+    {
+        fprintf(stderr, "[ERROR] Tolerancia o máximo de iteraciones fuera de rango\n");
+        return 1;
+    }
+    if (op->solvers != NULL)
+    {
+        int alguno = 0;
+        for (int s = 0; s < CANTIDAD_SOLVERS; s++)
+            alguno |= estaEnLista(op->solvers, SOLVERS[s].nombre);
+        if (!alguno)
+        {
+            fprintf(stderr, "[ERROR] Ningún solver válido en: %s\n", op->solvers);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char const *argv[])
+{
+    OpcionesBenchmark op;
+    if (leerOpciones(argc, argv, &op) != 0)
+    {
+        mostrarUso(argv[0]);
+        return 1;
+    }
+
+    FILE *salida = stdout;
+    if (op.salida != NULL)
+    {
+        salida = fopen(op.salida, "w");
+        if (salida == NULL)
+        {
+            fprintf(stderr, "[ERROR] No se pudo crear el archivo de salida %s\n", op.salida);
+            return 1;
+        }
+    }
+
+    fprintf(salida, "matriz,n,solver,estado,tiempo_s,gflops,iteraciones,residuo,memoria_pico_kb\n");
+
+    int casos = 0, fallidos = 0, omitidos = 0;
+    for (int t = 0; t < CANTIDAD_TIPOS; t++)
+    {
+        if (!(op.matrices & TIPOS_MATRIZ[t].tipo))
+            continue;
+        for (int k = 0; k < op.cantidad_tamanos; k++)
+        {
+            int n = op.tamanos[k];
+            for (int s = 0; s < CANTIDAD_SOLVERS; s++)
+            {
+                if (!(SOLVERS[s].matrices & TIPOS_MATRIZ[t].tipo))
+                    continue;
+                if (op.solvers != NULL && !estaEnLista(op.solvers, SOLVERS[s].nombre))
+                    continue;
+                if (((TIPOS_MATRIZ[t].tipo & MATRICES_DENSAS) && n > op.max_densa) ||
+                    (SOLVERS[s].directo && n > op.max_directos))
+                {
+                    omitidos++;
+                    continue;
+                }
+
+                // El hijo escribe en el mismo archivo: vaciar el buffer antes de duplicarlo
+                fflush(salida);
+                pid_t pid = fork();
+                if (pid < 0)
+                {
+                    fprintf(stderr, "[ERROR] No se pudo crear el proceso para %s n=%d %s\n",
+                            TIPOS_MATRIZ[t].nombre, n, SOLVERS[s].nombre);
+                    fallidos++;
+                    continue;
+                }
+                if (pid == 0)
+                {
+                    int codigo = ejecutarCaso(&op, t, n, SOLVERS[s].nombre, salida);
+                    fflush(salida);
+                    _exit(codigo);
+                }
+
+                int estado_hijo;
+                waitpid(pid, &estado_hijo, 0);
+                casos++;
+                if (WIFSIGNALED(estado_hijo))
+                {
+                    // Terminado por una señal (p. ej. sin memoria): el hijo no escribió su línea
+                    fprintf(salida, "%s,%d,%s,ABORTADO,,,,,\n", TIPOS_MATRIZ[t].nombre, n, SOLVERS[s].nombre);
+                    fprintf(stderr, "[ADVERTENCIA] %s n=%d %s terminó por la señal %d\n",
+                            TIPOS_MATRIZ[t].nombre, n, SOLVERS[s].nombre, WTERMSIG(estado_hijo));
+                    fallidos++;
+                }
+                else if (WEXITSTATUS(estado_hijo) != 0)
+                    fallidos++;
+            }
+        }
+    }
+
+    if (salida != stdout)
+        fclose(salida);
+    fprintf(stderr, "%d casos medidos, %d sin converger o con error, %d omitidos por tamaño "
+            "(--max-densa %d, --max-directos %d)\n", casos, fallidos, omitidos, op.max_densa, op.max_directos);
+    fprintf(stderr, "Núcleos de gauss y gauss-pivot: %s\n", nombreNivelSimd(nivelSimdActivo()));
+    return fallidos == 0 ? 0 : 1;
+}
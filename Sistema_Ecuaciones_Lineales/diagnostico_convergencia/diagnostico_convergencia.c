@@ -0,0 +1,213 @@
+/**
+ * @file diagnostico_convergencia.c
+ * @brief Implementación del análisis previo de convergencia.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include "diagnostico_convergencia.h"
+
+int esDiagonalDominante(const MatrizDensa *A, int *fila, double *margen)
+{
+    int n = A->filas;
+    int primera = -1;
+    double minimo = INFINITY;
+
+    for (int i = 0; i < n; i++)
+    {
+        const double *f = filaMatrizDensa(A, i);
+        double suma = 0.0;
+        for (int j = 0; j < n; j++)
+            suma += fabs(f[j]);
+        double diagonal = fabs(f[i]);
+        suma -= diagonal;
+
+        double relativo = (diagonal > 0.0) ? (diagonal - suma) / diagonal : -INFINITY;
+        if (relativo < minimo)
+            minimo = relativo;
+        if (relativo <= 0.0 && primera < 0)
+            primera = i;
+    }
+
+    if (fila != NULL)
+        *fila = primera;
+    if (margen != NULL)
+        *margen = minimo;
+    return primera < 0;
+}
+
+/*
+ * Un paso del método: y = T x + c. Con b == NULL se toma b = 0 y queda y = T x,
+ * que es lo que necesita el método de la potencia. x e y no deben solaparse.
+ */
+static void pasoMetodo(const MatrizDensa *A, const double *b, MetodoIterativo metodo,
+                       double omega, const double *x, double *y)
+{
+    int n = A->filas;
+
+    if (metodo == METODO_JACOBI)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            const double *fila = filaMatrizDensa(A, i);
+            double suma = 0.0;
+            for (int j = 0; j < n; j++)
+                suma += fila[j] * x[j];
+            suma -= fila[i] * x[i];
+            y[i] = ((b != NULL ? b[i] : 0.0) - suma) / fila[i];
+        }
+        return;
+    }
+
+    // Gauss-Seidel/SOR: barrido en el lugar sobre una copia de x
+    for (int i = 0; i < n; i++)
+        y[i] = x[i];
+    for (int i = 0; i < n; i++)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        double suma = 0.0;
+        for (int j = 0; j < n; j++)
+            suma += fila[j] * y[j];
+        suma -= fila[i] * y[i];
+        double x_gs = ((b != NULL ? b[i] : 0.0) - suma) / fila[i];
+        y[i] = omega * x_gs + (1.0 - omega) * y[i];
+    }
+}
+
+static double norma2(const double *v, int n)
+{
+    double suma = 0.0;
+    for (int i = 0; i < n; i++)
+        suma += v[i] * v[i];
+    return sqrt(suma);
+}
+
+static int diagonalNula(const MatrizDensa *A)
+{
+    for (int i = 0; i < A->filas; i++)
+        if (MD(A, i, i) == 0.0)
+            return 1;
+    return 0;
+}
+
+EstadoSolver radioEspectralIteracion(const MatrizDensa *A, MetodoIterativo metodo, double omega,
+                                     int iteraciones, double *radio)
+{
+    int n = A->filas;
+    *radio = 0.0;
+
+    if (diagonalNula(A))
+        return SOLVER_SINGULAR;
+    if (omega <= 0.0 || omega >= 2.0)
+        omega = 1.0;
+    if (iteraciones <= 0)
+        iteraciones = ITERACIONES_POTENCIA;
+
+    double *v = (double *)malloc((size_t)n * sizeof(double));
+    double *w = (double *)malloc((size_t)n * sizeof(double));
+    if (v == NULL || w == NULL)
+    {
+        free(v);
+        free(w);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    // Vector inicial: constante más una perturbación pseudoaleatoria fija. En las
+    // discretizaciones el autovector dominante es suave y la parte constante lo
+    // aproxima bien; la perturbación evita que v sea ortogonal a él
+    unsigned int semilla = 12345u;
+    for (int i = 0; i < n; i++)
+    {
+        semilla = semilla * 1103515245u + 12345u;
+        v[i] = 1.0 + 0.1 * ((double)(semilla >> 8) / (double)(1u << 24) - 0.5);
+    }
+    double norma = norma2(v, n);
+    for (int i = 0; i < n; i++)
+        v[i] /= norma;
+
+    // Suma de log(||T v_k||) sobre el último cuarto de los pasos
+    int desde = iteraciones * 3 / 4;
+    double suma_logaritmos = 0.0;
+    for (int k = 0; k < iteraciones; k++)
+    {
+        pasoMetodo(A, NULL, metodo, omega, v, w);
+        norma = norma2(w, n);
+        if (norma == 0.0 || !isfinite(norma))
+        {
+            // T^k v = 0: T es nilpotente sobre v (p. ej. Jacobi con A triangular)
+            *radio = (norma == 0.0) ? 0.0 : INFINITY;
+            free(v);
+            free(w);
+            return SOLVER_OK;
+        }
+        if (k >= desde)
+            suma_logaritmos += log(norma);
+        for (int i = 0; i < n; i++)
+            v[i] = w[i] / norma;
+    }
+    *radio = exp(suma_logaritmos / (iteraciones - desde));
+
+    free(v);
+    free(w);
+    return SOLVER_OK;
+}
+
+EstadoSolver diagnosticarConvergencia(const MatrizDensa *A, const double *b, const double *x0,
+                                      MetodoIterativo metodo, const ParametrosIterativos *param,
+                                      DiagnosticoConvergencia *d)
+{
+    int n = A->filas;
+    double omega = (param->omega > 0.0 && param->omega < 2.0) ? param->omega : 1.0;
+
+    d->diagonal_dominante = esDiagonalDominante(A, &d->fila_no_dominante, &d->margen_dominancia);
+    d->radio_espectral = INFINITY;
+    d->converge = PRONOSTICO_NO_CONVERGE;
+    d->iteraciones_estimadas = -1;
+
+    EstadoSolver estado = radioEspectralIteracion(A, metodo, omega, ITERACIONES_POTENCIA,
+                                                  &d->radio_espectral);
+    if (estado != SOLVER_OK)
+        return estado;
+    // Cerca de 1 la estimación (100 pasos de la potencia) no es confiable
+    if (d->radio_espectral > 1.0 + MARGEN_RADIO_ESPECTRAL)
+        d->converge = PRONOSTICO_NO_CONVERGE;
+    else if (d->radio_espectral < 1.0 - MARGEN_RADIO_ESPECTRAL)
+        d->converge = PRONOSTICO_CONVERGE;
+    else
+        d->converge = PRONOSTICO_INCIERTO;
+    if (!(d->radio_espectral < 1.0))
+        return SOLVER_OK;
+
+    // Primer paso real del método: e_1 = ||x_1 - x_0||
+    double *x = (double *)calloc((size_t)n, sizeof(double));
+    double *x1 = (double *)malloc((size_t)n * sizeof(double));
+    if (x == NULL || x1 == NULL)
+    {
+        free(x);
+        free(x1);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    if (x0 != NULL)
+        for (int i = 0; i < n; i++)
+            x[i] = x0[i];
+    pasoMetodo(A, b, metodo, omega, x, x1);
+    for (int i = 0; i < n; i++)
+        x1[i] -= x[i];
+    double error_1 = norma2(x1, n);
+    free(x);
+    free(x1);
+
+    if (error_1 <= param->tolerancia)
+        d->iteraciones_estimadas = 1;
+    else if (d->radio_espectral == 0.0)
+        d->iteraciones_estimadas = 2;
+    else
+    {
+        double pasos = 1.0 + ceil(log(param->tolerancia / error_1) / log(d->radio_espectral));
+        d->iteraciones_estimadas = (pasos < (double)INT_MAX) ? (int)pasos : INT_MAX;
+    }
+    return SOLVER_OK;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file diagnostico_convergencia.h
+ * @brief Análisis previo de convergencia de Jacobi y Gauss-Seidel/SOR.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Los métodos estacionarios escriben la iteración como x_{k+1} = T x_k + c, y
+ * convergen para cualquier x_0 si y sólo si el radio espectral ρ(T) < 1; el
+ * error se reduce aproximadamente en un factor ρ(T) por iteración. Sin este
+ * análisis, un sistema para el que el método no converge sólo se detecta después
+ * de iterar (a veces miles de veces). Aquí, antes de iterar:
+ *
+ *   - se verifica la dominancia diagonal estricta por filas (condición
+ *     suficiente, barata: O(n²));
+ *   - se estima ρ(T) con el método de la potencia aplicado a T, sin formarla:
+ *     T v es una iteración del método con b = 0 (O(n²) por paso);
+ *   - con ρ(T) y el primer paso se predice cuántas iteraciones hacen falta.
+ *
+ * Unas decenas de pasos del método de la potencia cuestan lo mismo que unas
+ * decenas de iteraciones del método, mucho menos que agotar MAX_ITER.
+ */
+#ifndef DIAGNOSTICO_CONVERGENCIA_H
+#define DIAGNOSTICO_CONVERGENCIA_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Pasos del método de la potencia por defecto.
+ */
+#define ITERACIONES_POTENCIA 100
+
+/**
+ * @brief Margen alrededor de 1 dentro del cual la estimación de ρ(T) no decide.
+ * @details Con ρ(T) cerca de 1 el método de la potencia converge despacio y la
+ *          estimación puede caer de cualquier lado de 1 (con autovalores ±1, por
+ *          ejemplo, Jacobi sobre una matriz singular). Si |ρ - 1| <= margen el
+ *          pronóstico es PRONOSTICO_INCIERTO: se itera igual y decide el control
+ *          de divergencia y estancamiento de controlarConvergencia().
+ */
+#define MARGEN_RADIO_ESPECTRAL 0.05
+
+/**
+ * @brief Método iterativo a diagnosticar.
+ */
+typedef enum
+{
+    METODO_JACOBI = 0,
+    METODO_GAUSS_SEIDEL     // Gauss-Seidel, o SOR si omega != 1
+} MetodoIterativo;
+
+/**
+ * @brief Pronóstico a partir del radio espectral estimado.
+ */
+typedef enum
+{
+    PRONOSTICO_NO_CONVERGE = 0, // ρ > 1 + MARGEN_RADIO_ESPECTRAL: no tiene sentido iterar
+    PRONOSTICO_CONVERGE,        // ρ < 1 - MARGEN_RADIO_ESPECTRAL
+    PRONOSTICO_INCIERTO         // ρ cerca de 1: la estimación no alcanza para decidir
+} PronosticoConvergencia;
+
+/**
+ * @brief Resultado del análisis previo.
+ */
+typedef struct
+{
+    int diagonal_dominante;     // 1 si A es estrictamente diagonal dominante por filas
+    int fila_no_dominante;      // Primera fila que no lo es (-1 si todas lo son)
+    double margen_dominancia;   // min_i (|a_ii| - Σ_{j≠i} |a_ij|) / |a_ii| (> 0 si es dominante)
+    double radio_espectral;     // Estimación de ρ(T)
+    PronosticoConvergencia converge; // Según radio_espectral y MARGEN_RADIO_ESPECTRAL
+    int iteraciones_estimadas;  // Iteraciones previstas para llegar a la tolerancia (-1 si ρ >= 1)
+} DiagnosticoConvergencia;
+
+/**
+ * @brief Verifica si A es estrictamente diagonal dominante por filas.
+ * @param A Matriz n x n.
+ * @param fila Si no es NULL, recibe la primera fila no dominante (-1 si no hay).
+ * @param margen Si no es NULL, recibe min_i (|a_ii| - Σ_{j≠i} |a_ij|) / |a_ii|.
+ * @return 1 si es diagonal dominante, 0 si no.
+ */
+int esDiagonalDominante(const MatrizDensa *A, int *fila, double *margen);
+
+/**
+ * @brief Estima el radio espectral de la matriz de iteración T del método.
+ * @details Método de la potencia sobre T a partir de un vector fijo (el
+ *          resultado es reproducible). Si el autovalor dominante es un par
+ *          complejo conjugado, ||T^k v|| no converge a un cociente fijo sino que
+ *          oscila; por eso ρ se estima como la media geométrica de los cocientes
+ *          ||T v_k|| / ||v_k|| del último cuarto de los pasos, que converge
+ *          igual. Con Gauss-Seidel la matriz T suele estar lejos de ser normal y
+ *          la estimación converge más despacio (tiende a sobrestimar ρ).
+ * @param A Matriz n x n (no se modifica).
+ * @param metodo METODO_JACOBI o METODO_GAUSS_SEIDEL.
+ * @param omega Factor de relajación de SOR (fuera de (0, 2) se usa 1).
+ * @param iteraciones Pasos del método de la potencia (<= 0 usa ITERACIONES_POTENCIA).
+ * @param radio Estimación de ρ(T) (salida).
+ * @return SOLVER_OK, SOLVER_SINGULAR (diagonal nula) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver radioEspectralIteracion(const MatrizDensa *A, MetodoIterativo metodo, double omega,
+                                     int iteraciones, double *radio);
+
+/**
+ * @brief Análisis completo antes de iterar: dominancia, radio espectral e iteraciones previstas.
+ * @details Las iteraciones previstas salen de suponer que el error entre
+ *          iteraciones se reduce en un factor ρ por paso a partir del primero,
+ *          e_k ≈ e_1 ρ^(k-1), con e_1 = ||x_1 - x_0||_2 calculado con un paso real
+ *          del método desde x0 (mismo criterio que jacobiDensa() y gaussSeidelDensa()).
+ *          El pronóstico sólo es PRONOSTICO_NO_CONVERGE si ρ supera 1 por más
+ *          de MARGEN_RADIO_ESPECTRAL; cerca de 1 es PRONOSTICO_INCIERTO.
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes.
+ * @param x0 Aproximación inicial (NULL equivale al vector nulo).
+ * @param metodo METODO_JACOBI o METODO_GAUSS_SEIDEL.
+ * @param param Tolerancia y omega del método a usar (max_iter no se usa).
+ * @param d Resultado del análisis (salida).
+ * @return SOLVER_OK, SOLVER_SINGULAR (diagonal nula) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver diagnosticarConvergencia(const MatrizDensa *A, const double *b, const double *x0,
+                                      MetodoIterativo metodo, const ParametrosIterativos *param,
+                                      DiagnosticoConvergencia *d);
+
+#endif // DIAGNOSTICO_CONVERGENCIA_H
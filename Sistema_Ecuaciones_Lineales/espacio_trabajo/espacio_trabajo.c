@@ -0,0 +1,110 @@
+/**
+ * @file espacio_trabajo.c
+ * @brief Implementación del espacio de trabajo reutilizable.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "espacio_trabajo.h"
+
+int crearEspacioTrabajo(EspacioTrabajo *E, int capacidad)
+{
+    E->capacidad = 0;
+    E->n = 0;
+    E->A.filas = 0;
+    E->A.columnas = 0;
+    E->A.stride = 0;
+    E->A.datos = NULL;
+    E->b = NULL;
+    E->x = NULL;
+    E->aux = NULL;
+
+    if (capacidad < 0)
+        return 1;
+    if (capacidad == 0)
+        return 0;
+
+    if (crearMatrizDensa(&E->A, capacidad, capacidad) != 0)
+        return 1;
+
+    // Los tres vectores en un solo bloque; cada uno empieza en una línea de caché
+    // (el stride de la matriz ya es capacidad redondeada a la línea)
+    size_t largo = (size_t)E->A.stride;
+    size_t bytes = 3 * largo * sizeof(double);
+    double *vectores = (double *)reservarAlineado(bytes);
+    if (vectores == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para el espacio de trabajo (n = %d).\n", capacidad);
+        liberarMatrizDensa(&E->A);
+        return 1;
+    }
+    memset(vectores, 0, bytes);
+
+    E->b = vectores;
+    E->x = vectores + largo;
+    E->aux = vectores + 2 * largo;
+    E->capacidad = capacidad;
+    E->n = capacidad;
+    return 0;
+}
+
+void liberarEspacioTrabajo(EspacioTrabajo *E)
+{
+    if (E == NULL)
+        return;
+    liberarMatrizDensa(&E->A);
+    liberarAlineado(E->b); // b es el inicio del bloque de los tres vectores
+    E->b = NULL;
+    E->x = NULL;
+    E->aux = NULL;
+    E->capacidad = 0;
+    E->n = 0;
+}
+
+int ajustarEspacioTrabajo(EspacioTrabajo *E, int n)
+{
+    if (n <= 0)
+        return 1;
+
+    if (n > E->capacidad)
+    {
+        liberarEspacioTrabajo(E);
+        if (crearEspacioTrabajo(E, n) != 0)
+            return 1;
+    }
+
+    // Sólo cambia la vista: el stride sigue siendo el del bloque completo
+    E->n = n;
+    E->A.filas = n;
+    E->A.columnas = n;
+    return 0;
+}
+
+int cargarEspacioTrabajo(EspacioTrabajo *E, double **A, const double *b, int n)
+{
+    if (ajustarEspacioTrabajo(E, n) != 0)
+        return 1;
+    for (int i = 0; i < n; i++)
+        memcpy(filaMatrizDensa(&E->A, i), A[i], (size_t)n * sizeof(double));
+    memcpy(E->b, b, (size_t)n * sizeof(double));
+    return 0;
+}
+
+EstadoSolver eliminacionGaussEspacio(EspacioTrabajo *E, double *det)
+{
+    return eliminacionGaussDensa(&E->A, E->b, E->x, det);
+}
+
+EstadoSolver jacobiEspacio(EspacioTrabajo *E, const ParametrosIterativos *param,
+                           ResultadoIterativo *res)
+{
+    return jacobiDensaSinReserva(&E->A, E->b, E->x, E->aux, param, res);
+}
+
+EstadoSolver gaussSeidelEspacio(EspacioTrabajo *E, const ParametrosIterativos *param,
+                                ResultadoIterativo *res)
+{
+    return gaussSeidelDensa(&E->A, E->b, E->x, param, res);
+}
@@ -0,0 +1,108 @@
+/**
+ * @file espacio_trabajo.h
+ * @brief Espacio de trabajo reutilizable para resolver muchos sistemas sin reservar memoria.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Cuando se resuelven muchos sistemas seguidos (barridos de parámetros, ajustes de
+ * distinto grado, ...) reservar y liberar la matriz y los vectores en cada llamada
+ * cuesta una parte medible del tiempo total, y con double** son n+1 llamadas a
+ * malloc por sistema. Un EspacioTrabajo se crea una vez con la capacidad del mayor
+ * sistema a resolver y después cada sistema de tamaño n <= capacidad se arma y se
+ * resuelve sobre la misma memoria:
+ *
+ *   EspacioTrabajo E;
+ *   crearEspacioTrabajo(&E, n_max);
+ *   for (...)
+ *   {
+ *       ajustarEspacioTrabajo(&E, n);      // no reserva memoria si n <= n_max
+ *       ... llenar E.A (con MD(&E.A, i, j)) y E.b ...
+ *       eliminacionGaussEspacio(&E, NULL); // solución en E.x
+ *   }
+ *   liberarEspacioTrabajo(&E);
+ *
+ * La matriz es un bloque capacidad x capacidad y E.A es una vista n x n de su
+ * esquina superior izquierda: conserva el stride del bloque, por lo que todas las
+ * funciones que reciben una MatrizDensa la usan sin copiarla.
+ */
+#ifndef ESPACIO_TRABAJO_H
+#define ESPACIO_TRABAJO_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Matriz y vectores de un sistema A x = b, reutilizables entre llamadas.
+ */
+typedef struct
+{
+    int capacidad;  // Mayor n admitido sin volver a reservar memoria
+    int n;          // Tamaño del sistema en uso (0 <= n <= capacidad)
+    MatrizDensa A;  // Vista n x n sobre el bloque de capacidad x capacidad
+    double *b;      // Términos independientes (capacidad elementos)
+    double *x;      // Aproximación inicial / solución (capacidad elementos)
+    double *aux;    // Vector de trabajo de los solvers (capacidad elementos)
+} EspacioTrabajo;
+
+/**
+ * @brief Reserva un espacio de trabajo para sistemas de hasta capacidad incógnitas.
+ * @details La matriz y los tres vectores se reservan alineados y quedan en cero.
+ *          Con capacidad = 0 el espacio queda vacío y se dimensiona en el primer
+ *          ajustarEspacioTrabajo().
+ * @param E Espacio a inicializar (salida).
+ * @param capacidad Mayor tamaño de sistema previsto (>= 0).
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o capacidad inválida.
+ */
+int crearEspacioTrabajo(EspacioTrabajo *E, int capacidad);
+
+/**
+ * @brief Libera la memoria del espacio de trabajo y lo deja vacío.
+ */
+void liberarEspacioTrabajo(EspacioTrabajo *E);
+
+/**
+ * @brief Prepara el espacio para un sistema de n incógnitas.
+ * @details Si n <= capacidad sólo cambia el tamaño de la vista E->A (no reserva
+ *          memoria ni borra el contenido). Si n es mayor, reserva un bloque nuevo de
+ *          capacidad n (el contenido anterior se pierde); es la única función del
+ *          módulo, además de crearEspacioTrabajo(), que reserva memoria.
+ * @param E Espacio de trabajo.
+ * @param n Tamaño del sistema (> 0).
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o tamaño inválido.
+ */
+int ajustarEspacioTrabajo(EspacioTrabajo *E, int n);
+
+/**
+ * @brief Copia un sistema en formato double** al espacio de trabajo.
+ * @details Ajusta el espacio a n y copia A en E->A y b en E->b (E->x no se toca).
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+int cargarEspacioTrabajo(EspacioTrabajo *E, double **A, const double *b, int n);
+
+/**
+ * @brief Eliminación de Gauss con pivoteo parcial sobre el sistema del espacio.
+ * @details Igual que eliminacionGaussDensa(): E->A y E->b se modifican y la
+ *          solución queda en E->x.
+ * @param E Espacio de trabajo con el sistema cargado.
+ * @param det Si no es NULL, recibe el determinante de A.
+ * @return SOLVER_OK o SOLVER_SINGULAR.
+ */
+EstadoSolver eliminacionGaussEspacio(EspacioTrabajo *E, double *det);
+
+/**
+ * @brief Método de Jacobi sobre el sistema del espacio, sin reservar memoria.
+ * @details E->x es la aproximación inicial y al terminar contiene la solución;
+ *          E->aux se usa como vector de la iteración nueva. E->A y E->b no se modifican.
+ * @return Los mismos códigos que jacobiDensa(), salvo SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver jacobiEspacio(EspacioTrabajo *E, const ParametrosIterativos *param,
+                           ResultadoIterativo *res);
+
+/**
+ * @brief Método de Gauss-Seidel/SOR sobre el sistema del espacio.
+ * @details Igual que gaussSeidelDensa() con E->x como aproximación inicial / solución.
+ * @return Los mismos códigos que gaussSeidelDensa().
+ */
+EstadoSolver gaussSeidelEspacio(EspacioTrabajo *E, const ParametrosIterativos *param,
+                                ResultadoIterativo *res);
+
+#endif // ESPACIO_TRABAJO_H
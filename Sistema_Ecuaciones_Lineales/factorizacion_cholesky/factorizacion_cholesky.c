@@ -0,0 +1,236 @@
+/**
+ * @file factorizacion_cholesky.c
+ * @brief Implementación de las factorizaciones de Cholesky y LDLᵀ empaquetadas.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "factorizacion_cholesky.h"
+#include "../nucleos_simd/nucleos_simd.h"
+
+int esSimetrica(const MatrizDensa *A)
+{
+    if (A->filas != A->columnas)
+        return 0;
+
+    for (int i = 1; i < A->filas; i++)
+    {
+        for (int j = 0; j < i; j++)
+        {
+            double a_ij = MD(A, i, j);
+            double a_ji = MD(A, j, i);
+            if (fabs(a_ij - a_ji) > TOLERANCIA_SIMETRIA * (fabs(a_ij) + fabs(a_ji)))
+                return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Reserva el triángulo empaquetado seguido de la diagonal D y de un vector de
+ * trabajo de n elementos (que usa LDLᵀ), todo en un único bloque.
+ */
+static EstadoSolver reservarFactorizacion(FactorizacionCholesky *F, int n, MetodoFactorizacion metodo)
+{
+    size_t triangulo = POS_TRIANGULO(n, 0);
+
+    F->n = n;
+    F->metodo = metodo;
+    F->rango = n;
+    F->D = NULL;
+    F->L = (double *)malloc((triangulo + 2 * (size_t)n) * sizeof(double));
+    if (F->L == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    if (metodo == FACTORIZACION_LDLT)
+        F->D = F->L + triangulo;
+    return SOLVER_OK;
+}
+
+EstadoSolver factorizarCholesky(const MatrizDensa *A, FactorizacionCholesky *F)
+{
+    int n = A->filas;
+
+    if (reservarFactorizacion(F, n, FACTORIZACION_CHOLESKY) != SOLVER_OK)
+        return SOLVER_ERROR_MEMORIA;
+
+    for (int i = 0; i < n; i++)
+    {
+        double *fila_i = F->L + POS_TRIANGULO(i, 0);
+        const double *fila_A = filaMatrizDensa(A, i);
+
+        for (int j = 0; j <= i; j++)
+        {
+            // Producto escalar de las filas i y j de L (ambas contiguas) hasta la columna j
+            const double *fila_j = F->L + POS_TRIANGULO(j, 0);
+            double suma = fila_A[j] - productoEscalarSimd(fila_i, fila_j, j);
+
+            if (j < i)
+                fila_i[j] = suma / fila_j[j];
+            else if (suma > TOLERANCIA_PIVOTE_LDLT * fabs(fila_A[i]) && isfinite(suma))
+                fila_i[i] = sqrt(suma);
+            else
+                return SOLVER_SINGULAR; // A no es (numéricamente) definida positiva
+        }
+    }
+    return SOLVER_OK;
+}
+
+EstadoSolver factorizarLDLT(const MatrizDensa *A, FactorizacionCholesky *F)
+{
+    int n = A->filas;
+
+    if (reservarFactorizacion(F, n, FACTORIZACION_LDLT) != SOLVER_OK)
+        return SOLVER_ERROR_MEMORIA;
+
+    // w[k] = L(i, k) * d_k para la fila i en curso: evita multiplicar por d_k en
+    // cada producto escalar
+    double *w = F->D + n;
+
+    for (int i = 0; i < n; i++)
+    {
+        double *fila_i = F->L + POS_TRIANGULO(i, 0);
+        const double *fila_A = filaMatrizDensa(A, i);
+
+        for (int j = 0; j < i; j++)
+        {
+            const double *fila_j = F->L + POS_TRIANGULO(j, 0);
+            double suma = fila_A[j] - productoEscalarSimd(w, fila_j, j);
+
+            // Con d_j nulo la columna j no contribuye a L*D*Lᵀ: L(i, j) queda en cero.
+            // Eso sólo vale si lo que queda de a_ij también es nulo (en una matriz
+            // semidefinida |a_ij|² <= a_ii·a_jj); si no, A es indefinida (por ejemplo
+            // [[0, 1], [1, 0]]) y sin pivoteo no hay factorización L*D*Lᵀ
+            if (F->D[j] == 0.0)
+            {
+                if (suma * suma > TOLERANCIA_PIVOTE_LDLT * fabs(fila_A[i]) * fabs(filaMatrizDensa(A, j)[j]))
+                    return SOLVER_SINGULAR;
+                w[j] = 0.0;
+                fila_i[j] = 0.0;
+            }
+            else
+            {
+                w[j] = suma;
+                fila_i[j] = suma / F->D[j];
+            }
+        }
+
+        double d = fila_A[i] - productoEscalarSimd(w, fila_i, i);
+        fila_i[i] = 1.0;
+
+        if (fabs(d) <= TOLERANCIA_PIVOTE_LDLT * fabs(fila_A[i]))
+        {
+            d = 0.0;
+            F->rango--;
+        }
+        else if (d < 0.0 || !isfinite(d))
+            return SOLVER_SINGULAR; // A no es semidefinida positiva
+        F->D[i] = d;
+    }
+    return SOLVER_OK;
+}
+
+void resolverCholesky(const FactorizacionCholesky *F, const double *b, double *x)
+{
+    int n = F->n;
+    int ldlt = (F->metodo == FACTORIZACION_LDLT);
+
+    if (x != b)
+        memcpy(x, b, (size_t)n * sizeof(double));
+
+    // L*y = b (hacia adelante, por filas de L)
+    for (int i = 0; i < n; i++)
+    {
+        const double *fila = F->L + POS_TRIANGULO(i, 0);
+        double suma = x[i] - productoEscalarSimd(fila, x, i);
+        x[i] = ldlt ? suma : suma / fila[i];
+    }
+
+    // D*z = y (sólo LDLᵀ; un pivote nulo deja la componente en cero)
+    if (ldlt)
+        for (int i = 0; i < n; i++)
+            x[i] = (F->D[i] != 0.0) ? x[i] / F->D[i] : 0.0;
+
+    // Lᵀ*x = z (hacia atrás): la columna i de Lᵀ es la fila i de L, contigua
+    for (int i = n - 1; i >= 0; i--)
+    {
+        const double *fila = F->L + POS_TRIANGULO(i, 0);
+        if (!ldlt)
+            x[i] /= fila[i];
+        double xi = x[i];
+        for (int k = 0; k < i; k++)
+            x[k] -= fila[k] * xi;
+    }
+}
+
+double determinanteCholesky(const FactorizacionCholesky *F)
+{
+    double det = 1.0;
+    for (int i = 0; i < F->n; i++)
+    {
+        if (F->metodo == FACTORIZACION_LDLT)
+            det *= F->D[i];
+        else
+        {
+            double l = F->L[POS_TRIANGULO(i, i)];
+            det *= l * l;
+        }
+    }
+    return det;
+}
+
+void liberarFactorizacionCholesky(FactorizacionCholesky *F)
+{
+    if (F == NULL)
+        return;
+    free(F->L); // D y el vector de trabajo están en el mismo bloque
+    F->L = NULL;
+    F->D = NULL;
+}
+
+EstadoSolver resolverDetectandoSimetria(MatrizDensa *A, double *b, double *x, double *det,
+                                        MetodoFactorizacion *metodo)
+{
+    if (esSimetrica(A))
+    {
+        FactorizacionCholesky F;
+        EstadoSolver estado = factorizarCholesky(A, &F);
+        if (estado == SOLVER_SINGULAR)
+        {
+            liberarFactorizacionCholesky(&F);
+            estado = factorizarLDLT(A, &F);
+        }
+        if (estado == SOLVER_OK)
+        {
+            resolverCholesky(&F, b, x);
+            if (det != NULL)
+                *det = determinanteCholesky(&F);
+            if (metodo != NULL)
+                *metodo = F.metodo;
+        }
+        liberarFactorizacionCholesky(&F);
+        if (estado != SOLVER_SINGULAR)
+            return estado;
+        // Simétrica pero indefinida: LDLᵀ sin pivoteo no es estable, se usa Gauss
+    }
+
+    if (metodo != NULL)
+        *metodo = FACTORIZACION_GAUSS;
+    return eliminacionGaussDensa(A, b, x, det);
+}
+
+const char *nombreMetodoFactorizacion(MetodoFactorizacion metodo)
+{
+    switch (metodo)
+    {
+    case FACTORIZACION_CHOLESKY:
+        return "Cholesky";
+    case FACTORIZACION_LDLT:
+        return "LDLᵀ";
+    case FACTORIZACION_GAUSS:
+        return "Gauss con pivoteo";
+    }
+    return "DESCONOCIDO";
+}
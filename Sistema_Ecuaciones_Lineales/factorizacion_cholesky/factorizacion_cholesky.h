@@ -0,0 +1,142 @@
+/**
+ * @file factorizacion_cholesky.h
+ * @brief Factorizaciones de Cholesky (A = L*Lᵀ) y LDLᵀ para matrices simétricas,
+ *        guardando sólo el triángulo inferior.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Si A es simétrica, U = Lᵀ (salvo escala) y alcanza con calcular y guardar L:
+ * la factorización hace n³/3 flops en lugar de los 2n³/3 de LU y no necesita
+ * pivoteo si A es definida positiva (las ecuaciones normales de mínimos
+ * cuadrados lo son). L se guarda empaquetada por filas, n(n+1)/2 elementos:
+ *
+ *   L(i, j) = L[i*(i+1)/2 + j],  j <= i
+ *
+ * de modo que la fila i de L es un tramo contiguo y el producto escalar entre dos
+ * filas (el núcleo del algoritmo) recorre memoria secuencial.
+ *
+ * Cuando A sólo es semidefinida positiva (p. ej. funciones base linealmente
+ * dependientes en una regresión) Cholesky falla al encontrar un pivote nulo;
+ * LDLᵀ (L con diagonal unitaria, D diagonal) no necesita raíces cuadradas y
+ * admite pivotes d_k = 0: la incógnita correspondiente queda libre y se elige
+ * una de las soluciones del sistema.
+ */
+#ifndef FACTORIZACION_CHOLESKY_H
+#define FACTORIZACION_CHOLESKY_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Diferencia relativa máxima |a_ij - a_ji| / (|a_ij| + |a_ji|) para considerar A simétrica.
+ */
+#define TOLERANCIA_SIMETRIA 1e-12
+
+/**
+ * @brief Un pivote de LDLᵀ con |d_k| <= TOLERANCIA_PIVOTE_LDLT * a_kk se toma como nulo.
+ */
+#define TOLERANCIA_PIVOTE_LDLT 1e-12
+
+/**
+ * @brief Método con el que se resolvió un sistema (ver resolverDetectandoSimetria()).
+ */
+typedef enum
+{
+    FACTORIZACION_CHOLESKY = 0,  // A simétrica definida positiva: A = L*Lᵀ
+    FACTORIZACION_LDLT,          // A simétrica semidefinida positiva: A = L*D*Lᵀ
+    FACTORIZACION_GAUSS          // A no simétrica (o indefinida): Gauss con pivoteo parcial
+} MetodoFactorizacion;
+
+/**
+ * @brief Factores de A = L*Lᵀ o A = L*D*Lᵀ con L empaquetada.
+ */
+typedef struct
+{
+    int n;                       // Tamaño de la matriz
+    MetodoFactorizacion metodo;  // FACTORIZACION_CHOLESKY o FACTORIZACION_LDLT
+    int rango;                   // n menos la cantidad de pivotes nulos (sólo LDLᵀ)
+    double *L;                   // Triángulo inferior empaquetado por filas (n(n+1)/2 elementos)
+    double *D;                   // Diagonal de D (sólo LDLᵀ, NULL con Cholesky)
+} FactorizacionCholesky;
+
+/** @brief Posición de L(i, j), j <= i, en el triángulo empaquetado. */
+#define POS_TRIANGULO(i, j) ((size_t)(i) * ((size_t)(i) + 1) / 2 + (size_t)(j))
+
+/**
+ * @brief Verifica si A es cuadrada y simétrica (con tolerancia relativa TOLERANCIA_SIMETRIA).
+ * @return 1 si es simétrica, 0 si no.
+ */
+int esSimetrica(const MatrizDensa *A);
+
+/**
+ * @brief Factoriza A = L*Lᵀ (Cholesky).
+ * @details Sólo lee el triángulo inferior de A (se supone simétrica). Variante
+ *          por filas: L(i, j) = (a_ij - Σ_{k<j} L(i, k) L(j, k)) / L(j, j), con
+ *          las filas i y j contiguas en el triángulo empaquetado. Un pivote
+ *          L(j, j)² <= TOLERANCIA_PIVOTE_LDLT * a_jj se considera nulo: A es
+ *          semidefinida (o casi) y conviene factorizarLDLT().
+ * @param A Matriz simétrica n x n (no se modifica).
+ * @param F Factorización (salida). Debe liberarse con liberarFactorizacionCholesky(),
+ *          también cuando se devuelve SOLVER_SINGULAR.
+ * @return SOLVER_OK, SOLVER_SINGULAR (A no es definida positiva) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver factorizarCholesky(const MatrizDensa *A, FactorizacionCholesky *F);
+
+/**
+ * @brief Factoriza A = L*D*Lᵀ, con L de diagonal unitaria (sin raíces cuadradas).
+ * @details Sólo lee el triángulo inferior de A. Los pivotes con
+ *          |d_k| <= TOLERANCIA_PIVOTE_LDLT * a_kk se toman como nulos y se
+ *          descuentan de F->rango. Debajo de un pivote nulo lo que queda de la
+ *          columna también debe ser nulo (r² <= TOLERANCIA_PIVOTE_LDLT * a_ii * a_kk);
+ *          si no, A es indefinida y se devuelve SOLVER_SINGULAR.
+ * @param A Matriz simétrica n x n (no se modifica).
+ * @param F Factorización (salida). Debe liberarse con liberarFactorizacionCholesky(),
+ *          también cuando se devuelve SOLVER_SINGULAR.
+ * @return SOLVER_OK, SOLVER_SINGULAR (un pivote negativo, o nulo con la columna
+ *         no nula: A no es semidefinida positiva) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver factorizarLDLT(const MatrizDensa *A, FactorizacionCholesky *F);
+
+/**
+ * @brief Resuelve A*x = b reutilizando una factorización (O(n²)).
+ * @details Con LDLᵀ, si un pivote es nulo la componente correspondiente de
+ *          D⁻¹ L⁻¹ b se toma como cero: si el sistema es compatible, x es una
+ *          de sus soluciones.
+ * @param F Factorización obtenida con factorizarCholesky() o factorizarLDLT().
+ * @param b Vector de términos independientes (no se modifica).
+ * @param x Solución (salida). Puede ser el mismo puntero que b.
+ */
+void resolverCholesky(const FactorizacionCholesky *F, const double *b, double *x);
+
+/**
+ * @brief Determinante de A a partir de su factorización.
+ */
+double determinanteCholesky(const FactorizacionCholesky *F);
+
+/**
+ * @brief Libera la memoria de la factorización.
+ */
+void liberarFactorizacionCholesky(FactorizacionCholesky *F);
+
+/**
+ * @brief Resuelve A*x = b eligiendo el método según la estructura de A.
+ * @details Si A es simétrica intenta Cholesky; si no es definida positiva,
+ *          LDLᵀ; si tampoco es semidefinida positiva, o si A no es simétrica,
+ *          eliminación de Gauss con pivoteo parcial (eliminacionGaussDensa()).
+ *          Los factores simétricos ocupan un bloque de n(n+1)/2 + 2n doubles que se
+ *          reserva y libera dentro de la función.
+ * @param A Matriz n x n. Sólo se modifica si se usa Gauss.
+ * @param b Vector de términos independientes. Sólo se modifica si se usa Gauss.
+ * @param x Solución (salida).
+ * @param det Si no es NULL, recibe el determinante de A.
+ * @param metodo Si no es NULL, recibe el método usado.
+ * @return SOLVER_OK, SOLVER_SINGULAR o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver resolverDetectandoSimetria(MatrizDensa *A, double *b, double *x, double *det,
+                                        MetodoFactorizacion *metodo);
+
+/**
+ * @brief Nombre del método ("Cholesky", "LDLᵀ", "Gauss con pivoteo") para informes.
+ */
+const char *nombreMetodoFactorizacion(MetodoFactorizacion metodo);
+
+#endif // FACTORIZACION_CHOLESKY_H
@@ -0,0 +1,436 @@
+/**
+ * @file factorizacion_lu.c
+ * @brief Implementación de la factorización LU por bloques con pivoteo parcial.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * ============================================================================
+ * FACTORIZACIÓN POR BLOQUES
+ * ============================================================================
+ * Se particiona la matriz (ya permutada) en un panel de nb columnas:
+ *
+ *   | A11 A12 |   | L11  0 | | U11 U12 |
+ *   | A21 A22 | = | L21  I | |  0  S   |
+ *
+ *   [L11; L21] y U11 : factorización del panel (eliminación clásica).
+ *   U12 = L11^-1 * A12 : sustitución hacia adelante sobre las filas del panel.
+ *   S   = A22 - L21 * U12 : complemento de Schur, que se factoriza igual.
+ *
+ * La actualización de S es un producto de matrices: se recorre por mosaicos de
+ * TAM_MOSAICO_FILAS x TAM_MOSAICO_COLUMNAS para que el trozo de U12 usado se
+ * mantenga en caché mientras se actualizan todas las filas del mosaico.
+ * ============================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "factorizacion_lu.h"
+
+#define TAM_MOSAICO_FILAS 64
+#define TAM_MOSAICO_COLUMNAS 256
+
+/* Intercambia dos filas completas (tramos contiguos de memoria) */
+static void intercambiarFilas(MatrizDensa *M, int f1, int f2)
+{
+    double *a = filaMatrizDensa(M, f1);
+    double *b = filaMatrizDensa(M, f2);
+    for (int j = 0; j < M->columnas; j++)
+    {
+        double aux = a[j];
+        a[j] = b[j];
+        b[j] = aux;
+    }
+}
+
+/* Factoriza el panel de columnas [k0, k0+kb) sobre las filas [k0, n) */
+static EstadoSolver factorizarPanel(FactorizacionLU *F, int k0, int kb)
+{
+    MatrizDensa *M = &F->LU;
+    int n = M->filas;
+    int fin = k0 + kb;
+
+    for (int j = k0; j < fin; j++)
+    {
+        // Pivoteo parcial en la columna j
+        int p = j;
+        double maximo = fabs(MD(M, j, j));
+        for (int i = j + 1; i < n; i++)
+        {
+            double valor = fabs(MD(M, i, j));
+            if (valor > maximo)
+            {
+                maximo = valor;
+                p = i;
+            }
+        }
+        F->pivotes[j] = p;
+        if (maximo == 0.0)
+            return SOLVER_SINGULAR;
+        if (p != j)
+        {
+            intercambiarFilas(M, j, p);
+            F->signo = -F->signo;
+        }
+
+        // Multiplicadores y actualización limitada a las columnas del panel
+        const double *fila_j = filaMatrizDensa(M, j);
+        double inv_pivote = 1.0 / fila_j[j];
+        for (int i = j + 1; i < n; i++)
+        {
+            double *fila_i = filaMatrizDensa(M, i);
+            double l = fila_i[j] * inv_pivote;
+            fila_i[j] = l;
+            for (int c = j + 1; c < fin; c++)
+                fila_i[c] -= l * fila_j[c];
+        }
+    }
+    return SOLVER_OK;
+}
+
+/* U12 = L11^-1 * A12 (L11 triangular inferior unitaria) */
+static void calcularU12(MatrizDensa *M, int k0, int kb)
+{
+    int n = M->columnas;
+    int fin = k0 + kb;
+
+    for (int j = k0; j < fin; j++)
+    {
+        const double *fila_j = filaMatrizDensa(M, j);
+        for (int i = j + 1; i < fin; i++)
+        {
+            double *fila_i = filaMatrizDensa(M, i);
+            double l = fila_i[j];
+            for (int c = fin; c < n; c++)
+                fila_i[c] -= l * fila_j[c];
+        }
+    }
+}
+
+/* A22 -= L21 * U12, recorrido por mosaicos */
+static void actualizarSchur(MatrizDensa *M, int k0, int kb)
+{
+    int n = M->filas;
+    int fin = k0 + kb;
+
+    for (int jj = fin; jj < n; jj += TAM_MOSAICO_COLUMNAS)
+    {
+        int j_fin = (jj + TAM_MOSAICO_COLUMNAS < n) ? jj + TAM_MOSAICO_COLUMNAS : n;
+
+        for (int ii = fin; ii < n; ii += TAM_MOSAICO_FILAS)
+        {
+            int i_fin = (ii + TAM_MOSAICO_FILAS < n) ? ii + TAM_MOSAICO_FILAS : n;
+
+            for (int i = ii; i < i_fin; i++)
+            {
+                double *fila_i = filaMatrizDensa(M, i);
+                int k = k0;
+
+                // De a cuatro filas de U12: fila_i se lee y escribe una vez por cada
+                // cuatro actualizaciones en lugar de una vez por actualización.
+                for (; k + 3 < fin; k += 4)
+                {
+                    double l0 = fila_i[k], l1 = fila_i[k + 1];
+                    double l2 = fila_i[k + 2], l3 = fila_i[k + 3];
+                    const double *u0 = filaMatrizDensa(M, k);
+                    const double *u1 = filaMatrizDensa(M, k + 1);
+                    const double *u2 = filaMatrizDensa(M, k + 2);
+                    const double *u3 = filaMatrizDensa(M, k + 3);
+                    for (int c = jj; c < j_fin; c++)
+                        fila_i[c] -= l0 * u0[c] + l1 * u1[c] + l2 * u2[c] + l3 * u3[c];
+                }
+
+                for (; k < fin; k++)
+                {
+                    double l = fila_i[k];
+                    if (l == 0.0)
+                        continue;
+                    const double *fila_k = filaMatrizDensa(M, k);
+                    for (int c = jj; c < j_fin; c++)
+                        fila_i[c] -= l * fila_k[c];
+                }
+            }
+        }
+    }
+}
+
+EstadoSolver factorizarLU(const MatrizDensa *A, FactorizacionLU *F, int tam_bloque)
+{
+    int n = A->filas;
+
+    F->pivotes = NULL;
+    F->signo = 1;
+    if (copiarMatrizDensa(&F->LU, A) != 0)
+        return SOLVER_ERROR_MEMORIA;
+
+    F->pivotes = (int *)malloc((size_t)n * sizeof(int));
+    if (F->pivotes == NULL)
+    {
+        liberarMatrizDensa(&F->LU);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    if (tam_bloque <= 0)
+        tam_bloque = TAM_BLOQUE_LU;
+
+    for (int k0 = 0; k0 < n; k0 += tam_bloque)
+    {
+        int kb = (k0 + tam_bloque < n) ? tam_bloque : n - k0;
+
+        EstadoSolver estado = factorizarPanel(F, k0, kb);
+        if (estado != SOLVER_OK)
+            return estado;
+
+        if (k0 + kb < n)
+        {
+            calcularU12(&F->LU, k0, kb);
+            actualizarSchur(&F->LU, k0, kb);
+        }
+    }
+
+    return SOLVER_OK;
+}
+
+void resolverLU(const FactorizacionLU *F, const double *b, double *x)
+{
+    const MatrizDensa *M = &F->LU;
+    int n = M->filas;
+
+    if (x != b)
+        for (int i = 0; i < n; i++)
+            x[i] = b[i];
+
+    // y = P*b
+    for (int k = 0; k < n; k++)
+    {
+        int p = F->pivotes[k];
+        if (p != k)
+        {
+            double aux = x[k];
+            x[k] = x[p];
+            x[p] = aux;
+        }
+    }
+
+    // L*y = P*b (diagonal unitaria)
+    for (int i = 1; i < n; i++)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        double suma = x[i];
+        for (int j = 0; j < i; j++)
+            suma -= fila[j] * x[j];
+        x[i] = suma;
+    }
+
+    // U*x = y
+    for (int i = n - 1; i >= 0; i--)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        double suma = x[i];
+        for (int j = i + 1; j < n; j++)
+            suma -= fila[j] * x[j];
+        x[i] = suma / fila[i];
+    }
+}
+
+void resolverLUMultiple(const FactorizacionLU *F, MatrizDensa *B)
+{
+    const MatrizDensa *M = &F->LU;
+    int n = M->filas;
+    int m = B->columnas;
+
+    for (int k = 0; k < n; k++)
+        if (F->pivotes[k] != k)
+            intercambiarFilas(B, k, F->pivotes[k]);
+
+    // Sustitución hacia adelante: fila_i(B) -= L[i][j] * fila_j(B)
+    for (int i = 1; i < n; i++)
+    {
+        const double *fila_l = filaMatrizDensa(M, i);
+        double *bi = filaMatrizDensa(B, i);
+        for (int j = 0; j < i; j++)
+        {
+            const double *bj = filaMatrizDensa(B, j);
+            double l = fila_l[j];
+            for (int c = 0; c < m; c++)
+                bi[c] -= l * bj[c];
+        }
+    }
+
+    // Sustitución hacia atrás
+    for (int i = n - 1; i >= 0; i--)
+    {
+        const double *fila_u = filaMatrizDensa(M, i);
+        double *bi = filaMatrizDensa(B, i);
+        for (int j = i + 1; j < n; j++)
+        {
+            const double *bj = filaMatrizDensa(B, j);
+            double u = fila_u[j];
+            for (int c = 0; c < m; c++)
+                bi[c] -= u * bj[c];
+        }
+        double inv = 1.0 / fila_u[i];
+        for (int c = 0; c < m; c++)
+            bi[c] *= inv;
+    }
+}
+
+void resolverLUTraspuesta(const FactorizacionLU *F, const double *b, double *x)
+{
+    const MatrizDensa *M = &F->LU;
+    int n = M->filas;
+
+    if (x != b)
+        for (int i = 0; i < n; i++)
+            x[i] = b[i];
+
+    // Uᵀ*z = b: la columna i de Uᵀ es la fila i de U; despejado z_i se resta
+    // de las componentes siguientes
+    for (int i = 0; i < n; i++)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        double zi = x[i] / fila[i];
+        x[i] = zi;
+        for (int j = i + 1; j < n; j++)
+            x[j] -= fila[j] * zi;
+    }
+
+    // Lᵀ*w = z (diagonal unitaria), con las filas de L como columnas de Lᵀ
+    for (int i = n - 1; i > 0; i--)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        double wi = x[i];
+        for (int j = 0; j < i; j++)
+            x[j] -= fila[j] * wi;
+    }
+
+    // x = Pᵀ*w: los intercambios en orden inverso
+    for (int k = n - 1; k >= 0; k--)
+    {
+        int p = F->pivotes[k];
+        if (p != k)
+        {
+            double aux = x[k];
+            x[k] = x[p];
+            x[p] = aux;
+        }
+    }
+}
+
+double determinanteLU(const FactorizacionLU *F)
+{
+    double det = (double)F->signo;
+    for (int i = 0; i < F->LU.filas; i++)
+        det *= MD(&F->LU, i, i);
+    return det;
+}
+
+EstadoSolver inversaLU(const FactorizacionLU *F, MatrizDensa *inversa)
+{
+    int n = F->LU.filas;
+
+    if (crearMatrizDensa(inversa, n, n) != 0)
+        return SOLVER_ERROR_MEMORIA;
+
+    // X = I y se resuelven las n columnas a la vez
+    for (int i = 0; i < n; i++)
+    {
+        double *fila = filaMatrizDensa(inversa, i);
+        memset(fila, 0, (size_t)n * sizeof(double));
+        fila[i] = 1.0;
+    }
+    resolverLUMultiple(F, inversa);
+    return SOLVER_OK;
+}
+
+/* Norma 1 de un vector */
+static double normaUnoVector(const double *v, int n)
+{
+    double suma = 0.0;
+    for (int i = 0; i < n; i++)
+        suma += fabs(v[i]);
+    return suma;
+}
+
+EstadoSolver estimarCondicionLU(const MatrizDensa *A, const FactorizacionLU *F, double *condicion)
+{
+    int n = F->LU.filas;
+
+    double norma_A = normaUnoMatrizDensa(A);
+    // x, y (= A⁻¹ x, y luego z = A⁻ᵀ ξ) y ξ = signo(y) en un solo bloque; ξ
+    // empieza en cero para que la primera comparación de signos nunca coincida
+    double *x = (double *)calloc(3 * (size_t)n, sizeof(double));
+    if (norma_A < 0.0 || x == NULL)
+    {
+        free(x);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    double *y = x + n;
+    double *signos = y + n;
+
+    for (int i = 0; i < n; i++)
+        x[i] = 1.0 / n;
+
+    double estimacion = 0.0;
+    int j_anterior = -1;
+    for (int iter = 0; iter < ITERACIONES_CONDICION; iter++)
+    {
+        resolverLU(F, x, y);
+        double norma_y = normaUnoVector(y, n);
+        if (iter > 0 && norma_y <= estimacion)
+            break; // e_j no mejoró la estimación
+        estimacion = norma_y;
+
+        int mismos_signos = 1;
+        for (int i = 0; i < n; i++)
+        {
+            double s = (y[i] >= 0.0) ? 1.0 : -1.0;
+            if (s != signos[i])
+                mismos_signos = 0;
+            signos[i] = s;
+        }
+        if (mismos_signos)
+            break; // z sería el mismo del paso anterior
+
+        // z = A⁻ᵀ ξ; el e_j con |z_j| máximo es la mejor dirección de ascenso
+        resolverLUTraspuesta(F, signos, y);
+        int j = 0;
+        double z_x = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            if (fabs(y[i]) > fabs(y[j]))
+                j = i;
+            z_x += y[i] * x[i];
+        }
+        if (fabs(y[j]) <= z_x || j == j_anterior)
+            break; // x ya es un máximo local
+        j_anterior = j;
+
+        memset(x, 0, (size_t)n * sizeof(double));
+        x[j] = 1.0;
+    }
+
+    // Vector alternado de Higham: 2 ||A⁻¹ x||₁ / (3n) también acota ||A⁻¹||₁
+    for (int i = 0; i < n; i++)
+    {
+        double magnitud = (n > 1) ? 1.0 + (double)i / (n - 1) : 1.0;
+        x[i] = (i % 2 == 0) ? magnitud : -magnitud;
+    }
+    resolverLU(F, x, y);
+    double alternada = 2.0 * normaUnoVector(y, n) / (3.0 * n);
+    if (alternada > estimacion)
+        estimacion = alternada;
+
+    free(x);
+    *condicion = norma_A * estimacion;
+    return SOLVER_OK;
+}
+
+void liberarFactorizacionLU(FactorizacionLU *F)
+{
+    if (F == NULL)
+        return;
+    liberarMatrizDensa(&F->LU);
+    free(F->pivotes);
+    F->pivotes = NULL;
+}
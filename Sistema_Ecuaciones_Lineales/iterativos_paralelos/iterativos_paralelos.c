@@ -0,0 +1,331 @@
+/**
+ * @file iterativos_paralelos.c
+ * @brief Implementación de los métodos iterativos multihilo.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "iterativos_paralelos.h"
+#include "../pool_hilos/pool_hilos.h"
+#include "../nucleos_simd/nucleos_simd.h"
+
+#define FILAS_MINIMAS_POR_HILO 32 // Por debajo de esto no conviene repartir
+
+/* Cada hilo escribe su error parcial en su propia línea de caché (sin false sharing) */
+typedef struct
+{
+    double valor;
+    char relleno[ALINEACION_MATRIZ - sizeof(double)];
+} ParcialHilo;
+
+typedef struct
+{
+    const MatrizDensa *A;
+    const double *b;
+    const double *x_viejo;
+    double *x_nuevo;
+    ParcialHilo *parciales;
+} ContextoJacobi;
+
+typedef struct
+{
+    PoolHilos *pool;
+    const MatrizDensa *A;
+    const double *b;
+    double *x;
+    double *nuevos;             // Valores calculados para el color actual, antes de escribirlos
+    const int *orden;           // Filas agrupadas por color
+    const int *inicio_color;    // Filas del color c: orden[inicio_color[c] .. inicio_color[c+1])
+    int num_colores;
+    double omega;
+    int simetrico;
+    ParcialHilo *parciales;
+} ContextoMulticolor;
+
+/* Ajusta la cantidad de hilos para que cada uno tenga trabajo suficiente */
+static int ajustarHilos(int num_hilos, int n)
+{
+    if (num_hilos <= 0)
+        num_hilos = numNucleosDisponibles();
+    if (num_hilos > n / FILAS_MINIMAS_POR_HILO)
+        num_hilos = n / FILAS_MINIMAS_POR_HILO > 0 ? n / FILAS_MINIMAS_POR_HILO : 1;
+    return num_hilos;
+}
+
+static void iteracionJacobi(void *contexto, int id_hilo, int num_hilos)
+{
+    ContextoJacobi *c = (ContextoJacobi *)contexto;
+    int inicio, fin;
+    rangoHilo(c->A->filas, id_hilo, num_hilos, &inicio, &fin);
+
+    int n = c->A->columnas;
+    const double *x_viejo = c->x_viejo;
+    double error_local = 0.0;
+
+    for (int i = inicio; i < fin; i++)
+    {
+        const double *fila = filaMatrizDensa(c->A, i);
+        // Mismo bucle que jacobiDensa(): los valores coinciden bit a bit
+        double suma = 0.0;
+        for (int j = 0; j < n; j++)
+            suma += fila[j] * x_viejo[j];
+        suma -= fila[i] * x_viejo[i];
+
+        double valor = (c->b[i] - suma) / fila[i];
+        double d = fabs(valor - x_viejo[i]);
+        if (d > error_local)
+            error_local = d;
+        c->x_nuevo[i] = valor;
+    }
+
+    c->parciales[id_hilo].valor = error_local;
+}
+
+EstadoSolver jacobiParalelo(const MatrizDensa *A, const double *b, double *x,
+                            const ParametrosIterativos *param, int num_hilos,
+                            ResultadoIterativo *res)
+{
+    int n = A->filas;
+
+    for (int i = 0; i < n; i++)
+        if (MD(A, i, i) == 0.0)
+            return SOLVER_SINGULAR;
+
+    num_hilos = ajustarHilos(num_hilos, n);
+
+    double *otro = (double *)malloc((size_t)n * sizeof(double));
+    ParcialHilo *parciales = (ParcialHilo *)calloc((size_t)num_hilos, sizeof(ParcialHilo));
+    PoolHilos *pool = crearPoolHilos(num_hilos);
+    if (otro == NULL || parciales == NULL || pool == NULL)
+    {
+        free(otro);
+        free(parciales);
+        destruirPoolHilos(pool);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    num_hilos = numHilosPool(pool);
+
+    ContextoJacobi contexto = { A, b, x, otro, parciales };
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        ejecutarEnPool(pool, iteracionJacobi, &contexto);
+
+        // Reducción de los máximos parciales
+        error = 0.0;
+        for (int h = 0; h < num_hilos; h++)
+            if (parciales[h].valor > error)
+                error = parciales[h].valor;
+        iteracion++;
+
+        // El vector nuevo pasa a ser el viejo (intercambio de punteros, sin copiar)
+        const double *aux = contexto.x_viejo;
+        contexto.x_viejo = contexto.x_nuevo;
+        contexto.x_nuevo = (double *)aux;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    // La última iteración quedó en x_viejo; copiarla a x si está en el buffer auxiliar
+    if (contexto.x_viejo != x)
+        for (int i = 0; i < n; i++)
+            x[i] = contexto.x_viejo[i];
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    destruirPoolHilos(pool);
+    free(parciales);
+    free(otro);
+    return estado;
+}
+
+int colorearFilas(const MatrizDensa *A, int *colores)
+{
+    int n = A->filas;
+    // usado[c] == i indica que el color c ya lo tiene una fila acoplada con i
+    int *usado = (int *)malloc((size_t)(n + 1) * sizeof(int));
+    if (usado == NULL)
+        return -1;
+    for (int c = 0; c <= n; c++)
+        usado[c] = -1;
+
+    int num_colores = 0;
+    for (int i = 0; i < n; i++)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        for (int j = 0; j < i; j++)
+            if (fila[j] != 0.0 || MD(A, j, i) != 0.0)
+                usado[colores[j]] = i;
+
+        int c = 0;
+        while (usado[c] == i)
+            c++;
+        colores[i] = c;
+        if (c + 1 > num_colores)
+            num_colores = c + 1;
+    }
+
+    free(usado);
+    return num_colores;
+}
+
+/* Actualiza todas las filas de un color: primero se calculan (leyendo x), luego se escriben */
+static double actualizarColor(ContextoMulticolor *c, int color, int id_hilo, int num_hilos)
+{
+    int base = c->inicio_color[color];
+    int cantidad = c->inicio_color[color + 1] - base;
+    int inicio, fin;
+    rangoHilo(cantidad, id_hilo, num_hilos, &inicio, &fin);
+
+    int n = c->A->columnas;
+    const double *x = c->x;
+    double error_local = 0.0;
+
+    for (int k = base + inicio; k < base + fin; k++)
+    {
+        int i = c->orden[k];
+        const double *fila = filaMatrizDensa(c->A, i);
+        double suma = productoEscalarSimd(fila, x, n) - fila[i] * x[i];
+
+        double x_gs = (c->b[i] - suma) / fila[i];
+        c->nuevos[k] = c->omega * x_gs + (1.0 - c->omega) * x[i];
+    }
+
+    // Nadie escribe x mientras otro hilo todavía lo está leyendo
+    barreraPool(c->pool);
+
+    for (int k = base + inicio; k < base + fin; k++)
+    {
+        int i = c->orden[k];
+        double d = fabs(c->nuevos[k] - c->x[i]);
+        if (d > error_local)
+            error_local = d;
+        c->x[i] = c->nuevos[k];
+    }
+
+    // El color siguiente necesita ver todos los valores de este color
+    barreraPool(c->pool);
+    return error_local;
+}
+
+static void iteracionMulticolor(void *contexto, int id_hilo, int num_hilos)
+{
+    ContextoMulticolor *c = (ContextoMulticolor *)contexto;
+    double error_local = 0.0;
+    double e;
+
+    for (int color = 0; color < c->num_colores; color++)
+    {
+        e = actualizarColor(c, color, id_hilo, num_hilos);
+        if (e > error_local)
+            error_local = e;
+    }
+
+    if (c->simetrico)
+    {
+        for (int color = c->num_colores - 1; color >= 0; color--)
+        {
+            e = actualizarColor(c, color, id_hilo, num_hilos);
+            if (e > error_local)
+                error_local = e;
+        }
+    }
+
+    c->parciales[id_hilo].valor = error_local;
+}
+
+EstadoSolver gaussSeidelMulticolor(const MatrizDensa *A, const double *b, double *x,
+                                   const ParametrosIterativos *param, int simetrico,
+                                   int num_hilos, ResultadoIterativo *res)
+{
+    int n = A->filas;
+    double omega = param->omega;
+
+    if (omega <= 0.0 || omega >= 2.0)
+        omega = 1.0;
+
+    for (int i = 0; i < n; i++)
+        if (MD(A, i, i) == 0.0)
+            return SOLVER_SINGULAR;
+
+    num_hilos = ajustarHilos(num_hilos, n);
+
+    int *colores = (int *)malloc((size_t)n * sizeof(int));
+    int *orden = (int *)malloc((size_t)n * sizeof(int));
+    int *inicio_color = (int *)calloc((size_t)n + 1, sizeof(int));
+    double *nuevos = (double *)malloc((size_t)n * sizeof(double));
+    ParcialHilo *parciales = (ParcialHilo *)calloc((size_t)num_hilos, sizeof(ParcialHilo));
+    PoolHilos *pool = crearPoolHilos(num_hilos);
+    int num_colores = -1;
+
+    if (colores != NULL && orden != NULL && inicio_color != NULL && nuevos != NULL &&
+        parciales != NULL && pool != NULL)
+        num_colores = colorearFilas(A, colores);
+
+    if (num_colores < 0)
+    {
+        destruirPoolHilos(pool);
+        free(colores); free(orden); free(inicio_color); free(nuevos); free(parciales);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    num_hilos = numHilosPool(pool);
+
+    // Agrupar las filas por color (ordenamiento por conteo, estable)
+    for (int i = 0; i < n; i++)
+        inicio_color[colores[i] + 1]++;
+    for (int c = 0; c < num_colores; c++)
+        inicio_color[c + 1] += inicio_color[c];
+    for (int i = 0; i < n; i++)
+        orden[inicio_color[colores[i]]++] = i;
+    for (int c = num_colores; c > 0; c--)
+        inicio_color[c] = inicio_color[c - 1];
+    inicio_color[0] = 0;
+
+    ContextoMulticolor contexto = { pool, A, b, x, nuevos, orden, inicio_color,
+                                    num_colores, omega, simetrico, parciales };
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        ejecutarEnPool(pool, iteracionMulticolor, &contexto);
+
+        error = 0.0;
+        for (int h = 0; h < num_hilos; h++)
+            if (parciales[h].valor > error)
+                error = parciales[h].valor;
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    destruirPoolHilos(pool);
+    free(colores);
+    free(orden);
+    free(inicio_color);
+    free(nuevos);
+    free(parciales);
+    return estado;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file iterativos_paralelos.h
+ * @brief Métodos iterativos que reparten el trabajo de cada iteración entre varios hilos.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Compilar junto con ../pool_hilos/pool_hilos.c, ../nucleos_simd/nucleos_simd.c y con -pthread.
+ */
+#ifndef ITERATIVOS_PARALELOS_H
+#define ITERATIVOS_PARALELOS_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Método de Jacobi multihilo.
+ * @details En Jacobi cada componente x_i^{(k+1)} depende sólo de x^{(k)}, por lo que
+ *          las filas son independientes: cada hilo calcula un bloque contiguo de
+ *          filas. En la misma pasada cada hilo obtiene el máximo |x_nuevo - x_viejo|
+ *          de su bloque y luego se reducen los máximos parciales, de modo que el
+ *          error no requiere un recorrido serial adicional.
+ *
+ *          El error informado es la norma infinito max_i |x_i^{(k+1)} - x_i^{(k)}|
+ *          (jacobiDensa() usa la norma euclidiana). Cada iteración produce
+ *          exactamente los mismos valores que jacobiDensa(), sin importar la
+ *          cantidad de hilos.
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param param Tolerancia y máximo de iteraciones.
+ * @param num_hilos Cantidad de hilos a usar (<= 0: un hilo por núcleo).
+ * @param res Si no es NULL, recibe iteraciones y error final.
+ * @return SOLVER_OK, SOLVER_SINGULAR, SOLVER_DIVERGE, SOLVER_MAX_ITER o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver jacobiParalelo(const MatrizDensa *A, const double *b, double *x,
+                            const ParametrosIterativos *param, int num_hilos,
+                            ResultadoIterativo *res);
+
+/**
+ * @brief Colorea las filas de A de modo que dos filas acopladas nunca compartan color.
+ * @details Las filas i y j están acopladas si a_ij != 0 o a_ji != 0. Se usa el
+ *          coloreo voraz en el orden natural: cada fila toma el menor color que
+ *          no usa ninguna fila acoplada ya coloreada. Para matrices tridiagonales
+ *          o provenientes de grillas (5 puntos) resulta el clásico rojo-negro
+ *          (2 colores); una matriz llena necesita n colores.
+ * @param A Matriz n x n.
+ * @param colores Vector de n enteros (salida): color de cada fila.
+ * @return Cantidad de colores usados, o -1 si hubo error de memoria.
+ */
+int colorearFilas(const MatrizDensa *A, int *colores);
+
+/**
+ * @brief Gauss-Seidel multicolor con sobre-relajación (SOR) o SSOR, multihilo.
+ * @details Las filas de un mismo color no dependen entre sí, así que se actualizan
+ *          todas a la vez repartidas entre los hilos; los colores se procesan en
+ *          orden, de modo que cada color usa los valores ya actualizados de los
+ *          anteriores (como Gauss-Seidel). Cada fila es un producto escalar sobre
+ *          memoria contigua, con productoEscalarSimd() (AVX2/AVX-512 si el
+ *          procesador lo soporta).
+ *
+ *          Con simetrico != 0 cada iteración es un barrido hacia adelante y otro
+ *          hacia atrás (SSOR). El resultado equivale a Gauss-Seidel/SOR con las
+ *          filas reordenadas por color, por lo que las iteraciones pueden diferir
+ *          levemente de gaussSeidelDensa(). El error es el máximo cambio de una
+ *          componente durante la iteración (norma infinito).
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param param Tolerancia, máximo de iteraciones y omega (0 < omega < 2).
+ * @param simetrico 0 para SOR, distinto de 0 para SSOR.
+ * @param num_hilos Cantidad de hilos a usar (<= 0: un hilo por núcleo).
+ * @param res Si no es NULL, recibe iteraciones y error final.
+ * @return SOLVER_OK, SOLVER_SINGULAR, SOLVER_DIVERGE, SOLVER_MAX_ITER o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver gaussSeidelMulticolor(const MatrizDensa *A, const double *b, double *x,
+                                   const ParametrosIterativos *param, int simetrico,
+                                   int num_hilos, ResultadoIterativo *res);
+
+#endif // ITERATIVOS_PARALELOS_H
@@ -0,0 +1,225 @@
+/**
+ * @file jacobi_procesos.c
+ * @brief Implementación del método de Jacobi repartido entre procesos.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Memoria compartida (un único mmap anónimo con MAP_SHARED, heredado por fork):
+ *
+ *   | barrera (relleno a una línea) | x^(0 mod 3) | x^(1 mod 3) | x^(2 mod 3) |
+ *
+ * Cada vector ocupa un múltiplo de la línea de caché y los bloques de filas
+ * empiezan en múltiplos de la línea, así dos procesos nunca escriben en la misma
+ * línea (sin false sharing entre procesos).
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "jacobi_procesos.h"
+
+#define DOUBLES_POR_LINEA ((int)(ALINEACION_MATRIZ / sizeof(double)))
+
+/* Redondea hacia arriba a un múltiplo de la línea de caché */
+static size_t redondearLinea(size_t bytes)
+{
+    return (bytes + ALINEACION_MATRIZ - 1) / ALINEACION_MATRIZ * ALINEACION_MATRIZ;
+}
+
+/* Filas [*inicio, *fin) del proceso id: bloques contiguos de líneas de caché completas */
+static void rangoProceso(int n, int id, int num_procesos, int *inicio, int *fin)
+{
+    long lineas = (n + DOUBLES_POR_LINEA - 1) / DOUBLES_POR_LINEA;
+    *inicio = (int)(lineas * id / num_procesos) * DOUBLES_POR_LINEA;
+    *fin = (int)(lineas * (id + 1) / num_procesos) * DOUBLES_POR_LINEA;
+    if (*inicio > n)
+        *inicio = n;
+    if (*fin > n)
+        *fin = n;
+}
+
+/*
+ * Barridos de Jacobi de un proceso sobre sus filas [inicio, fin). Todos los
+ * procesos ejecutan esta función con los mismos datos compartidos y llegan a la
+ * misma cantidad de iteraciones; la solución queda en vectores[iteraciones % 3].
+ */
+static EstadoSolver trabajadorJacobi(const MatrizDensa *A, const double *b, double *vectores[3],
+                                     pthread_barrier_t *barrera, int inicio, int fin,
+                                     const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    int n = A->filas;
+
+    // Copia propia del bloque de filas: la reserva y la escribe este proceso, así
+    // sus páginas quedan en el nodo NUMA donde corre. Sin memoria se leen las
+    // filas de A (compartidas con el padre hasta que alguno escriba)
+    MatrizDensa bloque;
+    const double *filas = filaMatrizDensa(A, inicio);
+    int stride = A->stride;
+    if (fin > inicio && crearMatrizDensa(&bloque, fin - inicio, n) == 0)
+    {
+        for (int i = inicio; i < fin; i++)
+            memcpy(filaMatrizDensa(&bloque, i - inicio), filaMatrizDensa(A, i), (size_t)n * sizeof(double));
+        filas = bloque.datos;
+        stride = bloque.stride;
+    }
+    else
+        bloque.datos = NULL;
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        const double *x = vectores[iteracion % 3];
+        double *x_nuevo = vectores[(iteracion + 1) % 3];
+
+        // Las mismas operaciones que jacobiDensaSinReserva(), sólo para el bloque
+        for (int i = inicio; i < fin; i++)
+        {
+            const double *fila = filas + (size_t)(i - inicio) * (size_t)stride;
+            double suma = 0.0;
+            for (int j = 0; j < n; j++)
+                suma += fila[j] * x[j];
+            suma -= fila[i] * x[i];
+            x_nuevo[i] = (b[i] - suma) / fila[i];
+        }
+
+        // Después de la barrera x_nuevo está completo. Nadie escribe en él ni en x
+        // hasta la próxima barrera: el siguiente barrido escribe el tercer vector
+        pthread_barrier_wait(barrera);
+
+        error = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double d = x_nuevo[i] - x[i];
+            error += d * d;
+        }
+        error = sqrt(error);
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (bloque.datos != NULL)
+        liberarMatrizDensa(&bloque);
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+    return estado;
+}
+
+EstadoSolver jacobiProcesos(const MatrizDensa *A, const double *b, double *x,
+                            const ParametrosIterativos *param, int num_procesos,
+                            ResultadoIterativo *res)
+{
+    int n = A->filas;
+
+    for (int i = 0; i < n; i++)
+        if (MD(A, i, i) == 0.0)
+            return SOLVER_SINGULAR;
+
+    if (num_procesos <= 0)
+    {
+        long nucleos = sysconf(_SC_NPROCESSORS_ONLN);
+        num_procesos = nucleos > 0 ? (int)nucleos : 1;
+    }
+    if (num_procesos > n / FILAS_MINIMAS_POR_PROCESO)
+        num_procesos = n / FILAS_MINIMAS_POR_PROCESO;
+    if (num_procesos <= 1)
+        return jacobiDensa(A, b, x, param, res);
+
+    size_t cabecera = redondearLinea(sizeof(pthread_barrier_t));
+    size_t largo = redondearLinea((size_t)n * sizeof(double));
+    size_t bytes = cabecera + 3 * largo;
+    char *compartida = (char *)mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (compartida == MAP_FAILED)
+        return SOLVER_ERROR_MEMORIA;
+
+    pthread_barrier_t *barrera = (pthread_barrier_t *)compartida;
+    double *vectores[3];
+    for (int k = 0; k < 3; k++)
+        vectores[k] = (double *)(compartida + cabecera + k * largo);
+    memcpy(vectores[0], x, (size_t)n * sizeof(double));
+
+    pthread_barrierattr_t atributos;
+    pthread_barrierattr_init(&atributos);
+    pthread_barrierattr_setpshared(&atributos, PTHREAD_PROCESS_SHARED);
+    int error_barrera = pthread_barrier_init(barrera, &atributos, (unsigned)num_procesos);
+    pthread_barrierattr_destroy(&atributos);
+    if (error_barrera != 0)
+    {
+        munmap(compartida, bytes);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    pid_t *hijos = (pid_t *)malloc((size_t)num_procesos * sizeof(pid_t));
+    if (hijos == NULL)
+    {
+        pthread_barrier_destroy(barrera);
+        munmap(compartida, bytes);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    // Evita que los hijos hereden (y vuelvan a escribir) lo pendiente en los buffers de stdio
+    fflush(NULL);
+
+    int creados = 0;
+    for (int id = 1; id < num_procesos; id++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            int inicio, fin;
+            rangoProceso(n, id, num_procesos, &inicio, &fin);
+            trabajadorJacobi(A, b, vectores, barrera, inicio, fin, param, NULL);
+            _exit(0);
+        }
+        if (pid < 0)
+            break;
+        hijos[creados++] = pid;
+    }
+
+    EstadoSolver estado;
+    if (creados == num_procesos - 1)
+    {
+        int inicio, fin;
+        rangoProceso(n, 0, num_procesos, &inicio, &fin);
+        ResultadoIterativo propio;
+        estado = trabajadorJacobi(A, b, vectores, barrera, inicio, fin, param, &propio);
+        memcpy(x, vectores[propio.iteraciones % 3], (size_t)n * sizeof(double));
+        if (res != NULL)
+            *res = propio;
+        for (int k = 0; k < creados; k++)
+            waitpid(hijos[k], NULL, 0);
+    }
+    else
+    {
+        // Los procesos creados esperan en la primera barrera una cantidad de
+        // procesos que no va a llegar: se terminan y se resuelve en este proceso
+        fprintf(stderr, "[ADVERTENCIA] No se pudieron crear %d procesos; se usa Jacobi en un solo proceso.\n",
+                num_procesos);
+        for (int k = 0; k < creados; k++)
+        {
+            kill(hijos[k], SIGKILL);
+            waitpid(hijos[k], NULL, 0);
+        }
+        estado = jacobiDensa(A, b, x, param, res);
+    }
+
+    free(hijos);
+    pthread_barrier_destroy(barrera);
+    munmap(compartida, bytes);
+    return estado;
+}
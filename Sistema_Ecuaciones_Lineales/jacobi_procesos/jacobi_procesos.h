@@ -0,0 +1,58 @@
+/**
+ * @file jacobi_procesos.h
+ * @brief Método de Jacobi por bloques de filas repartido entre varios procesos.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * jacobiParalelo() reparte las filas entre hilos que comparten toda la memoria
+ * del proceso: la matriz completa sigue siendo parte de un único espacio de
+ * direcciones y sus páginas quedan en el nodo NUMA donde se cargó. Aquí cada
+ * trabajador es un proceso (fork) que copia a su propia memoria el bloque de
+ * filas que le toca, de modo que la matriz queda distribuida: cada proceso sólo
+ * toca A(inicio:fin, :) y esas páginas se reservan en el nodo donde corre.
+ *
+ * Lo único compartido (memoria compartida POSIX, mmap con MAP_SHARED) son los
+ * vectores x y una barrera entre procesos. En cada barrido cada proceso escribe
+ * las componentes de su bloque y lee el vector completo: con una matriz densa
+ * el "halo" que necesita un bloque de filas es todo x, y el intercambio es la
+ * propia escritura en la memoria compartida.
+ *
+ * Compilar con -pthread (barrera compartida entre procesos). Sólo POSIX.
+ */
+#ifndef JACOBI_PROCESOS_H
+#define JACOBI_PROCESOS_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+#define FILAS_MINIMAS_POR_PROCESO 64 // Por debajo de esto no conviene crear otro proceso
+
+/**
+ * @brief Método de Jacobi con las filas de A repartidas entre num_procesos procesos.
+ * @details El proceso que llama es el trabajador 0 y crea los demás con fork().
+ *          Cada uno calcula x_i^{(k+1)} para sus filas leyendo x^{(k)} de la
+ *          memoria compartida. Después de la única barrera de cada barrido todos
+ *          calculan el mismo error ||x^{(k+1)} - x^{(k)}||₂ recorriendo el vector
+ *          en orden, así que todos toman la misma decisión de parar sin otra
+ *          sincronización. Con tres vectores rotando, ningún proceso sobrescribe
+ *          un vector que otro todavía lee.
+ *
+ *          Las operaciones de punto flotante son las mismas y en el mismo orden
+ *          que en jacobiDensa(): iteraciones, error y solución coinciden bit a bit
+ *          con cualquier cantidad de procesos.
+ *
+ *          Si no se puede crear algún proceso, se terminan los ya creados y se
+ *          resuelve con jacobiDensa() en el proceso que llama.
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param param Tolerancia y máximo de iteraciones.
+ * @param num_procesos Cantidad de procesos (<= 0: uno por núcleo). Se reduce
+ *                     para que cada uno tenga al menos FILAS_MINIMAS_POR_PROCESO filas.
+ * @param res Si no es NULL, recibe iteraciones y error final.
+ * @return Los mismos códigos que jacobiDensa().
+ */
+EstadoSolver jacobiProcesos(const MatrizDensa *A, const double *b, double *x,
+                            const ParametrosIterativos *param, int num_procesos,
+                            ResultadoIterativo *res);
+
+#endif // JACOBI_PROCESOS_H
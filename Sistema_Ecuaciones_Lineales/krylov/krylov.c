@@ -0,0 +1,746 @@
+/**
+ * @file krylov.c
+ * @brief Implementación de los métodos de Krylov y de los precondicionadores.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "krylov.h"
+
+static void aplicarDensa(const void *datos, const double *x, double *y)
+{
+    productoMatrizVector((const MatrizDensa *)datos, x, y);
+}
+
+static void aplicarCSR(const void *datos, const double *x, double *y)
+{
+    productoCSRVector((const MatrizCSR *)datos, x, y);
+}
+
+OperadorLineal operadorDensa(const MatrizDensa *A)
+{
+    OperadorLineal op = { A->filas, A, aplicarDensa };
+    return op;
+}
+
+OperadorLineal operadorCSR(const MatrizCSR *A)
+{
+    OperadorLineal op = { A->filas, A, aplicarCSR };
+    return op;
+}
+
+static double productoEscalar(const double *x, const double *y, int n)
+{
+    double suma = 0.0;
+    for (int i = 0; i < n; i++)
+        suma += x[i] * y[i];
+    return suma;
+}
+
+/**
+ * @brief Factorización de Cholesky incompleta IC(0).
+ * @details Copia tril(A) en L y luego, fila por fila, calcula
+ *
+ *            l_ij = (a_ij - Σ_{k<j} l_ik l_jk) / l_jj     (j < i, a_ij != 0)
+ *            l_ii = sqrt(a_ii - Σ_{k<i} l_ik²)
+ *
+ *          descartando los términos que caen fuera del patrón de A. Como las
+ *          columnas de cada fila están ordenadas, la suma Σ l_ik l_jk es una mezcla
+ *          de dos listas ordenadas y la diagonal queda última en cada fila de L.
+ */
+static EstadoSolver choleskyIncompleto(const MatrizCSR *A, MatrizCSR *L)
+{
+    int n = A->filas;
+    int nnz = 0;
+    for (int i = 0; i < n; i++)
+        for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+            if (A->columna[k] <= i)
+                nnz++;
+
+    if (crearMatrizCSR(L, n, n, nnz) != 0)
+        return SOLVER_ERROR_MEMORIA;
+
+    int pos = 0;
+    for (int i = 0; i < n; i++)
+    {
+        L->inicio_fila[i] = pos;
+        for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+        {
+            if (A->columna[k] <= i)
+            {
+                L->columna[pos] = A->columna[k];
+                L->valor[pos] = A->valor[k];
+                pos++;
+            }
+        }
+        if (pos == L->inicio_fila[i] || L->columna[pos - 1] != i)
+            return SOLVER_SINGULAR;     // Falta el elemento diagonal
+    }
+    L->inicio_fila[n] = pos;
+
+    for (int i = 0; i < n; i++)
+    {
+        int inicio_i = L->inicio_fila[i];
+        int diagonal_i = L->inicio_fila[i + 1] - 1;
+
+        for (int k = inicio_i; k < diagonal_i; k++)
+        {
+            int j = L->columna[k];
+            int inicio_j = L->inicio_fila[j];
+            int diagonal_j = L->inicio_fila[j + 1] - 1;
+
+            // Σ l_im l_jm para m < j común a las filas i y j
+            double suma = 0.0;
+            int a = inicio_i, c = inicio_j;
+            while (a < k && c < diagonal_j)
+            {
+                if (L->columna[a] == L->columna[c])
+                    suma += L->valor[a++] * L->valor[c++];
+                else if (L->columna[a] < L->columna[c])
+                    a++;
+                else
+                    c++;
+            }
+            L->valor[k] = (L->valor[k] - suma) / L->valor[diagonal_j];
+        }
+
+        double pivote = L->valor[diagonal_i];
+        for (int k = inicio_i; k < diagonal_i; k++)
+            pivote -= L->valor[k] * L->valor[k];
+        if (pivote <= 0.0)
+            return SOLVER_SINGULAR;
+        L->valor[diagonal_i] = sqrt(pivote);
+    }
+
+    return SOLVER_OK;
+}
+
+/**
+ * @brief Factorización LU incompleta ILU(0).
+ * @details Eliminación de Gauss (orden i-k-j) sobre una copia de A en la que sólo
+ *          se actualizan las posiciones no nulas de A: para cada fila i y cada
+ *          k < i del patrón, l_ik = a_ik / u_kk y a_ij -= l_ik u_kj para las j > k
+ *          del patrón de la fila k que también están en la fila i. El vector
+ *          posicion[] marca dónde está cada columna de la fila i (-1 si no está).
+ */
+static EstadoSolver luIncompleto(const MatrizCSR *A, MatrizCSR *F, int *posicion_diagonal)
+{
+    int n = A->filas;
+    if (crearMatrizCSR(F, n, n, A->nnz) != 0)
+        return SOLVER_ERROR_MEMORIA;
+    memcpy(F->inicio_fila, A->inicio_fila, (size_t)(n + 1) * sizeof(int));
+    memcpy(F->columna, A->columna, (size_t)A->nnz * sizeof(int));
+    memcpy(F->valor, A->valor, (size_t)A->nnz * sizeof(double));
+    F->nnz = A->nnz;
+
+    int *posicion = (int *)malloc((size_t)n * sizeof(int));
+    if (posicion == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    for (int j = 0; j < n; j++)
+        posicion[j] = -1;
+
+    EstadoSolver estado = SOLVER_OK;
+    for (int i = 0; i < n && estado == SOLVER_OK; i++)
+    {
+        int inicio = F->inicio_fila[i];
+        int fin = F->inicio_fila[i + 1];
+        for (int k = inicio; k < fin; k++)
+            posicion[F->columna[k]] = k;
+
+        posicion_diagonal[i] = posicion[i];
+        if (posicion[i] < 0)
+            estado = SOLVER_SINGULAR;       // Falta el elemento diagonal
+
+        for (int k = inicio; k < fin && estado == SOLVER_OK && F->columna[k] < i; k++)
+        {
+            int fila_k = F->columna[k];
+            F->valor[k] /= F->valor[posicion_diagonal[fila_k]];
+            double l = F->valor[k];
+            for (int m = posicion_diagonal[fila_k] + 1; m < F->inicio_fila[fila_k + 1]; m++)
+            {
+                int destino = posicion[F->columna[m]];
+                if (destino >= 0)
+                    F->valor[destino] -= l * F->valor[m];
+            }
+        }
+
+        if (estado == SOLVER_OK && F->valor[posicion_diagonal[i]] == 0.0)
+            estado = SOLVER_SINGULAR;
+
+        for (int k = inicio; k < fin; k++)
+            posicion[F->columna[k]] = -1;
+    }
+
+    free(posicion);
+    return estado;
+}
+
+EstadoSolver crearPrecondicionadorCSR(Precondicionador *P, TipoPrecondicionador tipo,
+                                      const MatrizCSR *A)
+{
+    memset(P, 0, sizeof(Precondicionador));
+    P->tipo = tipo;
+    P->n = A->filas;
+
+    if (tipo == PRECOND_JACOBI)
+    {
+        P->diagonal_inversa = (double *)malloc((size_t)A->filas * sizeof(double));
+        if (P->diagonal_inversa == NULL)
+            return SOLVER_ERROR_MEMORIA;
+
+        for (int i = 0; i < A->filas; i++)
+        {
+            double diagonal = 0.0;
+            for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+                if (A->columna[k] == i)
+                    diagonal += A->valor[k];
+            if (diagonal == 0.0)
+            {
+                liberarPrecondicionador(P);
+                return SOLVER_SINGULAR;
+            }
+            P->diagonal_inversa[i] = 1.0 / diagonal;
+        }
+    }
+    else if (tipo == PRECOND_CHOLESKY_INCOMPLETO)
+    {
+        EstadoSolver estado = choleskyIncompleto(A, &P->factor);
+        if (estado != SOLVER_OK)
+        {
+            liberarPrecondicionador(P);
+            return estado;
+        }
+    }
+    else if (tipo == PRECOND_LU_INCOMPLETO)
+    {
+        P->posicion_diagonal = (int *)malloc((size_t)A->filas * sizeof(int));
+        if (P->posicion_diagonal == NULL)
+            return SOLVER_ERROR_MEMORIA;
+        EstadoSolver estado = luIncompleto(A, &P->factor, P->posicion_diagonal);
+        if (estado != SOLVER_OK)
+        {
+            liberarPrecondicionador(P);
+            return estado;
+        }
+    }
+
+    return SOLVER_OK;
+}
+
+EstadoSolver crearPrecondicionadorDensa(Precondicionador *P, TipoPrecondicionador tipo,
+                                        const MatrizDensa *A)
+{
+    if (tipo == PRECOND_NINGUNO)
+    {
+        memset(P, 0, sizeof(Precondicionador));
+        P->n = A->filas;
+        return SOLVER_OK;
+    }
+
+    MatrizCSR dispersa;
+    if (csrDesdeDensa(&dispersa, A) != 0)
+        return SOLVER_ERROR_MEMORIA;
+    EstadoSolver estado = crearPrecondicionadorCSR(P, tipo, &dispersa);
+    liberarMatrizCSR(&dispersa);
+    return estado;
+}
+
+Precondicionador precondicionadorPersonalizado(int n,
+                                               void (*aplicar)(const void *datos, const double *r, double *z),
+                                               const void *datos)
+{
+    Precondicionador P;
+    memset(&P, 0, sizeof(Precondicionador));
+    P.tipo = PRECOND_PERSONALIZADO;
+    P.n = n;
+    P.aplicar = aplicar;
+    P.datos = datos;
+    return P;
+}
+
+void aplicarPrecondicionador(const Precondicionador *P, const double *r, double *z)
+{
+    int n = P->n;
+    if (P->tipo == PRECOND_NINGUNO)
+    {
+        if (z != r)
+            memcpy(z, r, (size_t)n * sizeof(double));
+        return;
+    }
+
+    if (P->tipo == PRECOND_JACOBI)
+    {
+        for (int i = 0; i < n; i++)
+            z[i] = r[i] * P->diagonal_inversa[i];
+        return;
+    }
+
+    if (P->tipo == PRECOND_PERSONALIZADO)
+    {
+        P->aplicar(P->datos, r, z);
+        return;
+    }
+
+    if (P->tipo == PRECOND_LU_INCOMPLETO)
+    {
+        // L y = r (L con diagonal 1) y luego U z = y
+        const MatrizCSR *F = &P->factor;
+        for (int i = 0; i < n; i++)
+        {
+            double suma = r[i];
+            for (int k = F->inicio_fila[i]; k < P->posicion_diagonal[i]; k++)
+                suma -= F->valor[k] * z[F->columna[k]];
+            z[i] = suma;
+        }
+        for (int i = n - 1; i >= 0; i--)
+        {
+            int diagonal = P->posicion_diagonal[i];
+            double suma = z[i];
+            for (int k = diagonal + 1; k < F->inicio_fila[i + 1]; k++)
+                suma -= F->valor[k] * z[F->columna[k]];
+            z[i] = suma / F->valor[diagonal];
+        }
+        return;
+    }
+
+    // IC(0): L y = r (hacia adelante) y luego Lᵀ z = y (hacia atrás, por columnas de Lᵀ)
+    const MatrizCSR *L = &P->factor;
+    for (int i = 0; i < n; i++)
+    {
+        int diagonal = L->inicio_fila[i + 1] - 1;
+        double suma = r[i];
+        for (int k = L->inicio_fila[i]; k < diagonal; k++)
+            suma -= L->valor[k] * z[L->columna[k]];
+        z[i] = suma / L->valor[diagonal];
+    }
+    for (int i = n - 1; i >= 0; i--)
+    {
+        int diagonal = L->inicio_fila[i + 1] - 1;
+        z[i] /= L->valor[diagonal];
+        for (int k = L->inicio_fila[i]; k < diagonal; k++)
+            z[L->columna[k]] -= L->valor[k] * z[i];
+    }
+}
+
+void liberarPrecondicionador(Precondicionador *P)
+{
+    free(P->diagonal_inversa);
+    P->diagonal_inversa = NULL;
+    free(P->posicion_diagonal);
+    P->posicion_diagonal = NULL;
+    if (P->tipo == PRECOND_CHOLESKY_INCOMPLETO || P->tipo == PRECOND_LU_INCOMPLETO)
+        liberarMatrizCSR(&P->factor);
+    P->tipo = PRECOND_NINGUNO;
+}
+
+/**
+ * @brief z = M⁻¹ r, o z = r si no hay precondicionador.
+ */
+static void precondicionar(const Precondicionador *P, const double *r, double *z, int n)
+{
+    if (P != NULL)
+        aplicarPrecondicionador(P, r, z);
+    else
+        memcpy(z, r, (size_t)n * sizeof(double));
+}
+
+/**
+ * @brief r = b - A x. Devuelve ||r||₂. Usa q como auxiliar.
+ */
+static double calcularResiduo(const OperadorLineal *A, const double *b, const double *x,
+                              double *r, double *q)
+{
+    int n = A->n;
+    A->aplicar(A->datos, x, q);
+    for (int i = 0; i < n; i++)
+        r[i] = b[i] - q[i];
+    return sqrt(productoEscalar(r, r, n));
+}
+
+EstadoSolver gradienteConjugado(const OperadorLineal *A, const double *b, double *x,
+                                const Precondicionador *P, const ParametrosIterativos *param,
+                                ResultadoIterativo *res, double *historial)
+{
+    int n = A->n;
+    double *r = (double *)malloc((size_t)n * sizeof(double));
+    double *z = (double *)malloc((size_t)n * sizeof(double));
+    double *p = (double *)malloc((size_t)n * sizeof(double));
+    double *q = (double *)malloc((size_t)n * sizeof(double));
+    if (r == NULL || z == NULL || p == NULL || q == NULL)
+    {
+        free(r);
+        free(z);
+        free(p);
+        free(q);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    double norma_b = sqrt(productoEscalar(b, b, n));
+    if (norma_b == 0.0)
+        norma_b = 1.0;      // b = 0: se mide el residuo absoluto
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = calcularResiduo(A, b, x, r, q) / norma_b;
+    if (historial != NULL)
+        historial[0] = error;
+
+    if (error <= param->tolerancia)
+        estado = SOLVER_OK;
+    else
+    {
+        precondicionar(P, r, z, n);
+        memcpy(p, z, (size_t)n * sizeof(double));
+        double rz = productoEscalar(r, z, n);
+
+        while (iteracion < param->max_iter)
+        {
+            A->aplicar(A->datos, p, q);
+            double pq = productoEscalar(p, q, n);
+            if (pq <= 0.0)
+            {
+                estado = SOLVER_DIVERGE;
+                break;
+            }
+
+            double alfa = rz / pq;
+            for (int i = 0; i < n; i++)
+            {
+                x[i] += alfa * p[i];
+                r[i] -= alfa * q[i];
+            }
+            iteracion++;
+
+            error = sqrt(productoEscalar(r, r, n)) / norma_b;
+            if (historial != NULL)
+                historial[iteracion] = error;
+            if (error <= param->tolerancia)
+            {
+                estado = SOLVER_OK;
+                break;
+            }
+
+            precondicionar(P, r, z, n);
+            double rz_nuevo = productoEscalar(r, z, n);
+            double beta = rz_nuevo / rz;
+            rz = rz_nuevo;
+            for (int i = 0; i < n; i++)
+                p[i] = z[i] + beta * p[i];
+        }
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    free(r);
+    free(z);
+    free(p);
+    free(q);
+    return estado;
+}
+
+EstadoSolver gradienteConjugadoDensa(const MatrizDensa *A, const double *b, double *x,
+                                     TipoPrecondicionador tipo, const ParametrosIterativos *param,
+                                     ResultadoIterativo *res, double *historial)
+{
+    Precondicionador P;
+    EstadoSolver estado = crearPrecondicionadorDensa(&P, tipo, A);
+    if (estado != SOLVER_OK)
+        return estado;
+
+    OperadorLineal op = operadorDensa(A);
+    estado = gradienteConjugado(&op, b, x, &P, param, res, historial);
+    liberarPrecondicionador(&P);
+    return estado;
+}
+
+EstadoSolver gradienteConjugadoCSR(const MatrizCSR *A, const double *b, double *x,
+                                   TipoPrecondicionador tipo, const ParametrosIterativos *param,
+                                   ResultadoIterativo *res, double *historial)
+{
+    Precondicionador P;
+    EstadoSolver estado = crearPrecondicionadorCSR(&P, tipo, A);
+    if (estado != SOLVER_OK)
+        return estado;
+
+    OperadorLineal op = operadorCSR(A);
+    estado = gradienteConjugado(&op, b, x, &P, param, res, historial);
+    liberarPrecondicionador(&P);
+    return estado;
+}
+
+EstadoSolver gmres(const OperadorLineal *A, const double *b, double *x,
+                   const Precondicionador *P, int reinicio, const ParametrosIterativos *param,
+                   ResultadoIterativo *res, double *historial)
+{
+    int n = A->n;
+    int m = reinicio;
+    if (m < 1)
+        m = 1;
+    if (m > n)
+        m = n;
+
+    // V: base de Krylov, m+1 vectores de n; H: Hessenberg (m+1) x m por filas
+    double *V = (double *)malloc((size_t)(m + 1) * n * sizeof(double));
+    double *H = (double *)malloc((size_t)(m + 1) * m * sizeof(double));
+    double *cs = (double *)malloc((size_t)m * sizeof(double));
+    double *sn = (double *)malloc((size_t)m * sizeof(double));
+    double *g = (double *)malloc((size_t)(m + 1) * sizeof(double));
+    double *y = (double *)malloc((size_t)m * sizeof(double));
+    double *r = (double *)malloc((size_t)n * sizeof(double));
+    double *w = (double *)malloc((size_t)n * sizeof(double));
+    double *z = (double *)malloc((size_t)n * sizeof(double));
+    if (V == NULL || H == NULL || cs == NULL || sn == NULL || g == NULL || y == NULL ||
+        r == NULL || w == NULL || z == NULL)
+    {
+        free(V);
+        free(H);
+        free(cs);
+        free(sn);
+        free(g);
+        free(y);
+        free(r);
+        free(w);
+        free(z);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    double norma_b = sqrt(productoEscalar(b, b, n));
+    if (norma_b == 0.0)
+        norma_b = 1.0;
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double beta = calcularResiduo(A, b, x, r, w);
+    double error = beta / norma_b;
+    if (historial != NULL)
+        historial[0] = error;
+    if (error <= param->tolerancia)
+        estado = SOLVER_OK;
+
+    while (estado == SOLVER_MAX_ITER && iteracion < param->max_iter)
+    {
+        for (int i = 0; i < n; i++)
+            V[i] = r[i] / beta;
+        g[0] = beta;
+
+        int j = 0;
+        while (j < m && iteracion < param->max_iter)
+        {
+            double *v = V + (size_t)j * n;
+            double *v_siguiente = V + (size_t)(j + 1) * n;
+
+            // Arnoldi: v_{j+1} = A M⁻¹ v_j ortogonalizado contra v_0 .. v_j
+            precondicionar(P, v, z, n);
+            A->aplicar(A->datos, z, v_siguiente);
+            for (int k = 0; k <= j; k++)
+            {
+                double *vk = V + (size_t)k * n;
+                double h = productoEscalar(v_siguiente, vk, n);
+                H[k * m + j] = h;
+                for (int i = 0; i < n; i++)
+                    v_siguiente[i] -= h * vk[i];
+            }
+            double h_siguiente = sqrt(productoEscalar(v_siguiente, v_siguiente, n));
+            H[(j + 1) * m + j] = h_siguiente;
+            if (h_siguiente != 0.0)
+                for (int i = 0; i < n; i++)
+                    v_siguiente[i] /= h_siguiente;
+
+            // Rotaciones de Givens anteriores sobre la nueva columna
+            for (int k = 0; k < j; k++)
+            {
+                double t = cs[k] * H[k * m + j] + sn[k] * H[(k + 1) * m + j];
+                H[(k + 1) * m + j] = -sn[k] * H[k * m + j] + cs[k] * H[(k + 1) * m + j];
+                H[k * m + j] = t;
+            }
+
+            // Nueva rotación que anula H[j+1][j]
+            double d = hypot(H[j * m + j], h_siguiente);
+            if (d == 0.0)
+            {
+                estado = SOLVER_SINGULAR;
+                break;
+            }
+            cs[j] = H[j * m + j] / d;
+            sn[j] = h_siguiente / d;
+            H[j * m + j] = d;
+            H[(j + 1) * m + j] = 0.0;
+            g[j + 1] = -sn[j] * g[j];
+            g[j] = cs[j] * g[j];
+
+            j++;
+            iteracion++;
+            error = fabs(g[j]) / norma_b;
+            if (historial != NULL)
+                historial[iteracion] = error;
+            // h_siguiente = 0: el subespacio es invariante y contiene la solución
+            if (error <= param->tolerancia || h_siguiente == 0.0)
+                break;
+        }
+
+        // Resolver el sistema triangular H y = g y actualizar x += M⁻¹ (V y)
+        for (int k = j - 1; k >= 0; k--)
+        {
+            double suma = g[k];
+            for (int l = k + 1; l < j; l++)
+                suma -= H[k * m + l] * y[l];
+            y[k] = suma / H[k * m + k];
+        }
+        for (int i = 0; i < n; i++)
+            w[i] = 0.0;
+        for (int k = 0; k < j; k++)
+        {
+            double *vk = V + (size_t)k * n;
+            for (int i = 0; i < n; i++)
+                w[i] += y[k] * vk[i];
+        }
+        precondicionar(P, w, z, n);
+        for (int i = 0; i < n; i++)
+            x[i] += z[i];
+
+        if (estado == SOLVER_SINGULAR)
+            break;
+
+        // Residuo verdadero al reiniciar (el estimado acumula errores de redondeo)
+        beta = calcularResiduo(A, b, x, r, w);
+        error = beta / norma_b;
+        if (historial != NULL)
+            historial[iteracion] = error;
+        if (error <= param->tolerancia)
+            estado = SOLVER_OK;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    free(V);
+    free(H);
+    free(cs);
+    free(sn);
+    free(g);
+    free(y);
+    free(r);
+    free(w);
+    free(z);
+    return estado;
+}
+
+EstadoSolver bicgstab(const OperadorLineal *A, const double *b, double *x,
+                      const Precondicionador *P, const ParametrosIterativos *param,
+                      ResultadoIterativo *res, double *historial)
+{
+    int n = A->n;
+    double *memoria = (double *)malloc((size_t)8 * n * sizeof(double));
+    if (memoria == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    double *r = memoria;
+    double *r0 = memoria + n;           // Residuo inicial "sombra", fijo
+    double *p = memoria + 2 * n;
+    double *v = memoria + 3 * n;
+    double *p_prec = memoria + 4 * n;   // M⁻¹ p
+    double *s = memoria + 5 * n;
+    double *s_prec = memoria + 6 * n;   // M⁻¹ s
+    double *t = memoria + 7 * n;
+
+    double norma_b = sqrt(productoEscalar(b, b, n));
+    if (norma_b == 0.0)
+        norma_b = 1.0;
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = calcularResiduo(A, b, x, r, t) / norma_b;
+    if (historial != NULL)
+        historial[0] = error;
+    if (error <= param->tolerancia)
+        estado = SOLVER_OK;
+
+    memcpy(r0, r, (size_t)n * sizeof(double));
+    for (int i = 0; i < n; i++)
+    {
+        p[i] = 0.0;
+        v[i] = 0.0;
+    }
+    double rho = 1.0, alfa = 1.0, omega = 1.0;
+
+    while (estado == SOLVER_MAX_ITER && iteracion < param->max_iter)
+    {
+        double rho_nuevo = productoEscalar(r0, r, n);
+        if (rho_nuevo == 0.0)
+        {
+            estado = SOLVER_DIVERGE;
+            break;
+        }
+        double beta = (rho_nuevo / rho) * (alfa / omega);
+        rho = rho_nuevo;
+        for (int i = 0; i < n; i++)
+            p[i] = r[i] + beta * (p[i] - omega * v[i]);
+
+        precondicionar(P, p, p_prec, n);
+        A->aplicar(A->datos, p_prec, v);
+        double r0v = productoEscalar(r0, v, n);
+        if (r0v == 0.0)
+        {
+            estado = SOLVER_DIVERGE;
+            break;
+        }
+        alfa = rho / r0v;
+        for (int i = 0; i < n; i++)
+            s[i] = r[i] - alfa * v[i];
+        iteracion++;
+
+        double norma_s = sqrt(productoEscalar(s, s, n)) / norma_b;
+        if (norma_s <= param->tolerancia)
+        {
+            // Media iteración alcanza
+            for (int i = 0; i < n; i++)
+                x[i] += alfa * p_prec[i];
+            error = norma_s;
+            if (historial != NULL)
+                historial[iteracion] = error;
+            estado = SOLVER_OK;
+            break;
+        }
+
+        precondicionar(P, s, s_prec, n);
+        A->aplicar(A->datos, s_prec, t);
+        double tt = productoEscalar(t, t, n);
+        omega = tt > 0.0 ? productoEscalar(t, s, n) / tt : 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            x[i] += alfa * p_prec[i] + omega * s_prec[i];
+            r[i] = s[i] - omega * t[i];
+        }
+
+        error = sqrt(productoEscalar(r, r, n)) / norma_b;
+        if (historial != NULL)
+            historial[iteracion] = error;
+        if (error <= param->tolerancia)
+        {
+            estado = SOLVER_OK;
+            break;
+        }
+        if (omega == 0.0)
+        {
+            estado = SOLVER_DIVERGE;
+            break;
+        }
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    free(memoria);
+    return estado;
+}
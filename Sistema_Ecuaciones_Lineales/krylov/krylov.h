@@ -0,0 +1,197 @@
+/**
+ * @file krylov.h
+ * @brief Métodos de subespacios de Krylov (Gradiente Conjugado, GMRES, BiCGSTAB) con precondicionadores.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Estos métodos sólo necesitan calcular productos y = A*x, así que se escriben
+ * una sola vez sobre un OperadorLineal y funcionan igual con una MatrizDensa o
+ * con una MatrizCSR (operadorDensa() / operadorCSR()).
+ *
+ * Precondicionar es resolver M z = r con una M "parecida" a A y barata de
+ * invertir; el método converge como si resolviera M⁻¹A x = M⁻¹b, que está mejor
+ * condicionado que el sistema original.
+ *
+ * Gradiente Conjugado sirve sólo para matrices simétricas definidas positivas;
+ * GMRES(m) y BiCGSTAB sirven para cualquier matriz no singular, aunque no sea
+ * simétrica ni diagonalmente dominante (donde Jacobi y Gauss-Seidel divergen).
+ * Todos miden la convergencia con el residuo relativo ||b - A x||₂ / ||b||₂.
+ */
+#ifndef KRYLOV_H
+#define KRYLOV_H
+
+#include "../matriz_densa/matriz_densa.h"
+#include "../matriz_dispersa/matriz_dispersa.h"
+
+/**
+ * @brief Operador y = A*x visto sólo a través de su producto.
+ */
+typedef struct
+{
+    int n;                                                      // Dimensión del sistema
+    const void *datos;                                          // Matriz (u otros datos) del operador
+    void (*aplicar)(const void *datos, const double *x, double *y);
+} OperadorLineal;
+
+/**
+ * @brief Precondicionadores disponibles.
+ */
+typedef enum
+{
+    PRECOND_NINGUNO = 0,            // M = I
+    PRECOND_JACOBI,                 // M = diag(A)
+    PRECOND_CHOLESKY_INCOMPLETO,    // M = L Lᵀ con L del mismo patrón que tril(A), IC(0)
+    PRECOND_LU_INCOMPLETO,          // M = L U con L y U del mismo patrón que A, ILU(0)
+    PRECOND_PERSONALIZADO           // z = M⁻¹ r lo calcula una función de quien llama
+} TipoPrecondicionador;
+
+/**
+ * @brief Precondicionador ya construido, listo para aplicar z = M⁻¹ r.
+ */
+typedef struct
+{
+    TipoPrecondicionador tipo;
+    int n;
+    double *diagonal_inversa;       // PRECOND_JACOBI: 1 / a_ii
+    MatrizCSR factor;               // IC(0): L; ILU(0): L (diagonal 1, implícita) y U juntas
+    int *posicion_diagonal;         // ILU(0): posición de u_ii en cada fila de factor
+    void (*aplicar)(const void *datos, const double *r, double *z);   // PRECOND_PERSONALIZADO
+    const void *datos;              // PRECOND_PERSONALIZADO: datos para aplicar
+} Precondicionador;
+
+/**
+ * @brief Operador de una matriz densa (no se copia: A debe seguir existiendo).
+ */
+OperadorLineal operadorDensa(const MatrizDensa *A);
+
+/**
+ * @brief Operador de una matriz CSR (no se copia: A debe seguir existiendo).
+ */
+OperadorLineal operadorCSR(const MatrizCSR *A);
+
+/**
+ * @brief Construye un precondicionador para una matriz CSR.
+ * @details Para IC(0) la matriz debe ser simétrica definida positiva y tener las
+ *          columnas de cada fila ordenadas (como las deja csrDesdeTripletas()).
+ *          Sólo se usa el triángulo inferior de A. L conserva el patrón de ceros
+ *          de tril(A), por lo que ocupa O(nnz) memoria.
+ *          ILU(0) no necesita simetría, pero sí las columnas ordenadas.
+ * @return SOLVER_OK; SOLVER_SINGULAR si hay un cero en la diagonal, IC(0) encuentra
+ *         un pivote no positivo o ILU(0) un pivote nulo; SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver crearPrecondicionadorCSR(Precondicionador *P, TipoPrecondicionador tipo,
+                                      const MatrizCSR *A);
+
+/**
+ * @brief Construye un precondicionador para una matriz densa.
+ * @details Para IC(0) e ILU(0) se toma el patrón de los elementos no nulos de A,
+ *          de modo que si A es llena el resultado es la factorización completa.
+ */
+EstadoSolver crearPrecondicionadorDensa(Precondicionador *P, TipoPrecondicionador tipo,
+                                        const MatrizDensa *A);
+
+/**
+ * @brief Precondicionador definido por quien llama.
+ * @param n Dimensión del sistema.
+ * @param aplicar Función que calcula z = M⁻¹ r (r y z no se solapan).
+ * @param datos Datos que recibe aplicar (no se copian).
+ */
+Precondicionador precondicionadorPersonalizado(int n,
+                                               void (*aplicar)(const void *datos, const double *r, double *z),
+                                               const void *datos);
+
+/**
+ * @brief Calcula z = M⁻¹ r. Con PRECOND_NINGUNO copia r en z.
+ */
+void aplicarPrecondicionador(const Precondicionador *P, const double *r, double *z);
+
+/**
+ * @brief Libera la memoria del precondicionador.
+ */
+void liberarPrecondicionador(Precondicionador *P);
+
+/**
+ * @brief Gradiente Conjugado precondicionado para sistemas simétricos definidos positivos.
+ * @details En aritmética exacta termina en a lo sumo n iteraciones, y en la
+ *          práctica converge en O(√κ) iteraciones (κ = número de condición de
+ *          M⁻¹A), frente a las O(κ) de Jacobi o Gauss-Seidel.
+ *
+ *          Se detiene cuando el residuo relativo ||b - A x||₂ / ||b||₂ es menor o
+ *          igual que param->tolerancia. El residuo se actualiza con la recurrencia
+ *          del método (no se recalcula A x en cada paso). param->omega no se usa.
+ * @param A Operador simétrico definido positivo.
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param P Precondicionador (NULL: sin precondicionar).
+ * @param param Tolerancia y máximo de iteraciones.
+ * @param res Si no es NULL, recibe iteraciones y residuo relativo final.
+ * @param historial Si no es NULL, vector de param->max_iter + 1 elementos donde se
+ *                  guarda el residuo relativo inicial y el de cada iteración.
+ * @return SOLVER_OK, SOLVER_MAX_ITER, SOLVER_DIVERGE (pᵀAp <= 0: A no es definida
+ *         positiva) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver gradienteConjugado(const OperadorLineal *A, const double *b, double *x,
+                                const Precondicionador *P, const ParametrosIterativos *param,
+                                ResultadoIterativo *res, double *historial);
+
+/**
+ * @brief Gradiente Conjugado sobre una MatrizDensa, construyendo el precondicionador pedido.
+ * @return Igual que gradienteConjugado(), o el error de crearPrecondicionadorDensa().
+ */
+EstadoSolver gradienteConjugadoDensa(const MatrizDensa *A, const double *b, double *x,
+                                     TipoPrecondicionador tipo, const ParametrosIterativos *param,
+                                     ResultadoIterativo *res, double *historial);
+
+/**
+ * @brief Gradiente Conjugado sobre una MatrizCSR, construyendo el precondicionador pedido.
+ * @return Igual que gradienteConjugado(), o el error de crearPrecondicionadorCSR().
+ */
+EstadoSolver gradienteConjugadoCSR(const MatrizCSR *A, const double *b, double *x,
+                                   TipoPrecondicionador tipo, const ParametrosIterativos *param,
+                                   ResultadoIterativo *res, double *historial);
+
+/**
+ * @brief GMRES con reinicio cada m iteraciones, GMRES(m), precondicionado por derecha.
+ * @details Construye una base ortonormal del subespacio de Krylov con Arnoldi
+ *          (Gram-Schmidt modificado) y elige la x que minimiza ||b - A x||₂ en él,
+ *          reduciendo la Hessenberg con rotaciones de Givens; así el residuo se
+ *          conoce en cada iteración sin calcularlo. Como el precondicionador va
+ *          por derecha (A M⁻¹ u = b, x = M⁻¹ u), ese residuo es el del sistema
+ *          original. Cada m iteraciones se actualiza x, se recalcula el residuo
+ *          verdadero y se reinicia, de modo que la memoria es O(m·n).
+ * @param A Operador no singular.
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param P Precondicionador (NULL: sin precondicionar).
+ * @param reinicio Dimensión m del subespacio antes de reiniciar (p. ej. 30).
+ * @param param Tolerancia (residuo relativo) y máximo de iteraciones totales.
+ * @param res Si no es NULL, recibe iteraciones y residuo relativo final.
+ * @param historial Si no es NULL, vector de param->max_iter + 1 elementos con el
+ *                  residuo relativo inicial y el de cada iteración.
+ * @return SOLVER_OK, SOLVER_MAX_ITER, SOLVER_SINGULAR (A M⁻¹ singular en el
+ *         subespacio) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver gmres(const OperadorLineal *A, const double *b, double *x,
+                   const Precondicionador *P, int reinicio, const ParametrosIterativos *param,
+                   ResultadoIterativo *res, double *historial);
+
+/**
+ * @brief BiCGSTAB (gradiente biconjugado estabilizado), precondicionado por derecha.
+ * @details Usa memoria O(n) fija y dos productos A*x por iteración, pero su
+ *          residuo no decrece de forma monótona. Si el método se interrumpe
+ *          (ρ = 0 u ω = 0) devuelve SOLVER_DIVERGE; en ese caso conviene GMRES.
+ * @param A Operador no singular.
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param P Precondicionador (NULL: sin precondicionar).
+ * @param param Tolerancia (residuo relativo) y máximo de iteraciones.
+ * @param res Si no es NULL, recibe iteraciones y residuo relativo final.
+ * @param historial Si no es NULL, vector de param->max_iter + 1 elementos con el
+ *                  residuo relativo inicial y el de cada iteración.
+ * @return SOLVER_OK, SOLVER_MAX_ITER, SOLVER_DIVERGE o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver bicgstab(const OperadorLineal *A, const double *b, double *x,
+                      const Precondicionador *P, const ParametrosIterativos *param,
+                      ResultadoIterativo *res, double *historial);
+
+#endif // KRYLOV_H
@@ -0,0 +1,597 @@
+/**
+ * @file lu_en_disco.c
+ * @brief Implementación de la factorización LU fuera de memoria por paneles.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * ============================================================================
+ * LECTURA ANTICIPADA
+ * ============================================================================
+ * Cada operación conoce de antemano la secuencia completa de paneles que va a
+ * leer (el "orden"). Un hilo lector la recorre y deja cada panel en uno de dos
+ * búferes (la entrada e va al búfer e % 2); el hilo principal toma los paneles
+ * en el mismo orden y libera cada búfer al terminar de usarlo. Así la lectura
+ * del panel siguiente se superpone con el cálculo sobre el actual.
+ *
+ * Al factorizar, el panel j < k que se lee en el paso k tiene que ser el ya
+ * factorizado: cada entrada del orden indica cuántos paneles deben estar
+ * escritos antes de leerla, y el hilo principal avisa después de cada escritura.
+ * ============================================================================
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "lu_en_disco.h"
+
+#define TAM_MOSAICO_DISCO 256 // Filas por mosaico en la actualización con un panel anterior
+#define ANCHO_SUBPANEL 32      // Columnas que se eliminan juntas dentro del panel en memoria
+
+/**
+ * @brief Lector de paneles en segundo plano con doble búfer.
+ */
+typedef struct
+{
+    const MatrizEnDisco *M;
+    const int *orden;           // Paneles a leer, en orden
+    const int *escritos_antes;  // Paneles que deben estar escritos antes de leer cada entrada (NULL: ninguno)
+    int cantidad;               // Entradas de orden
+    double *buffers[2];
+    int leidos;                 // Entradas ya cargadas en un búfer
+    int consumidos;             // Entradas ya liberadas por el hilo principal
+    int escritos;               // Paneles escritos por el hilo principal
+    int error;                  // 1 si falló alguna lectura
+    int cancelar;               // El hilo principal abandona la operación
+    pthread_mutex_t mutex;
+    pthread_cond_t cambio;
+    pthread_t hilo;
+} LectorPaneles;
+
+/* Columnas del panel p (el último puede ser más angosto) */
+static int columnasPanel(const MatrizEnDisco *M, int p)
+{
+    int inicio = p * M->ancho_panel;
+    return (M->n - inicio < M->ancho_panel) ? M->n - inicio : M->ancho_panel;
+}
+
+static off_t desplazamientoPanel(const MatrizEnDisco *M, int p)
+{
+    return (off_t)p * M->ancho_panel * M->n * (off_t)sizeof(double);
+}
+
+/* pread/pwrite pueden transferir menos bytes de los pedidos: se repite hasta completar */
+static int transferirCompleto(int fd, void *datos, size_t bytes, off_t desplazamiento, int escribir)
+{
+    char *p = (char *)datos;
+    while (bytes > 0)
+    {
+        ssize_t hecho = escribir ? pwrite(fd, p, bytes, desplazamiento) : pread(fd, p, bytes, desplazamiento);
+        if (hecho < 0 && errno == EINTR)
+            continue;
+        if (hecho <= 0)
+            return 1;
+        p += hecho;
+        bytes -= (size_t)hecho;
+        desplazamiento += hecho;
+    }
+    return 0;
+}
+
+int anchoPanelEnDisco(int n, size_t memoria)
+{
+    size_t por_columna = (size_t)PANELES_EN_MEMORIA * (size_t)n * sizeof(double);
+    size_t ancho = memoria / por_columna;
+    if (ancho < 1)
+        ancho = 1;
+    if (ancho > (size_t)n)
+        ancho = (size_t)n;
+    return (int)ancho;
+}
+
+int crearMatrizEnDisco(MatrizEnDisco *M, const char *ruta, int n, size_t memoria)
+{
+    M->fd = -1;
+    M->temporal = NULL;
+    M->n = n;
+    M->ancho_panel = anchoPanelEnDisco(n, memoria);
+    M->num_paneles = (n + M->ancho_panel - 1) / M->ancho_panel;
+    M->factorizada = 0;
+    M->pivotes = (int *)malloc((size_t)n * sizeof(int));
+    if (n <= 0 || M->pivotes == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo crear la matriz en disco (n = %d).\n", n);
+        free(M->pivotes);
+        M->pivotes = NULL;
+        return 1;
+    }
+
+    if (ruta == NULL)
+    {
+        M->temporal = tmpfile();
+        if (M->temporal != NULL)
+            M->fd = fileno(M->temporal);
+    }
+    else
+        M->fd = open(ruta, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    // El archivo con el tamaño final y sin datos: el sistema de archivos lo llena de ceros
+    off_t largo = (off_t)n * n * (off_t)sizeof(double);
+    if (M->fd < 0 || ftruncate(M->fd, largo) != 0)
+    {
+        fprintf(stderr, "[ERROR] No se pudo crear el archivo de paneles %s.\n", ruta != NULL ? ruta : "(temporal)");
+        cerrarMatrizEnDisco(M);
+        return 1;
+    }
+    return 0;
+}
+
+int escribirPanelEnDisco(MatrizEnDisco *M, int p, const double *panel)
+{
+    size_t bytes = (size_t)columnasPanel(M, p) * M->n * sizeof(double);
+    M->factorizada = 0;
+    return transferirCompleto(M->fd, (void *)panel, bytes, desplazamientoPanel(M, p), 1);
+}
+
+int leerPanelEnDisco(const MatrizEnDisco *M, int p, double *panel)
+{
+    size_t bytes = (size_t)columnasPanel(M, p) * M->n * sizeof(double);
+    return transferirCompleto(M->fd, panel, bytes, desplazamientoPanel(M, p), 0);
+}
+
+int cargarMatrizEnDisco(MatrizEnDisco *M, const MatrizDensa *A)
+{
+    int n = M->n;
+    int ancho = M->ancho_panel;
+    size_t por_panel = (size_t)ancho * n;
+    double *paneles = (double *)malloc(PANELES_EN_MEMORIA * por_panel * sizeof(double));
+    if (paneles == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para cargar la matriz en disco.\n");
+        return 1;
+    }
+
+    for (int p0 = 0; p0 < M->num_paneles; p0 += PANELES_EN_MEMORIA)
+    {
+        int cantidad = (M->num_paneles - p0 < PANELES_EN_MEMORIA) ? M->num_paneles - p0 : PANELES_EN_MEMORIA;
+        int c0 = p0 * ancho;
+        int c1 = (c0 + cantidad * ancho < n) ? c0 + cantidad * ancho : n;
+
+        // Una pasada por las filas de A: el tramo [c0, c1) de cada fila es contiguo
+        for (int i = 0; i < n; i++)
+        {
+            const double *fila = filaMatrizDensa(A, i);
+            for (int c = c0; c < c1; c++)
+                paneles[(size_t)(c - c0) * n + i] = fila[c];
+        }
+
+        for (int q = 0; q < cantidad; q++)
+        {
+            if (escribirPanelEnDisco(M, p0 + q, paneles + q * por_panel) != 0)
+            {
+                fprintf(stderr, "[ERROR] No se pudo escribir el panel %d en disco.\n", p0 + q);
+                free(paneles);
+                return 1;
+            }
+        }
+    }
+
+    free(paneles);
+    return 0;
+}
+
+/* ---------------------------------------------------------------------------
+   Lector en segundo plano
+   --------------------------------------------------------------------------- */
+
+static void *hiloLector(void *argumento)
+{
+    LectorPaneles *L = (LectorPaneles *)argumento;
+
+    for (int e = 0; e < L->cantidad; e++)
+    {
+        pthread_mutex_lock(&L->mutex);
+        // Espera un búfer libre y, si hace falta, que el panel ya esté escrito
+        while (!L->cancelar && (e - L->consumidos >= 2 ||
+                                (L->escritos_antes != NULL && L->escritos < L->escritos_antes[e])))
+            pthread_cond_wait(&L->cambio, &L->mutex);
+        int cancelar = L->cancelar;
+        pthread_mutex_unlock(&L->mutex);
+        if (cancelar)
+            break;
+
+        int error = leerPanelEnDisco(L->M, L->orden[e], L->buffers[e % 2]);
+
+        pthread_mutex_lock(&L->mutex);
+        if (error)
+            L->error = 1;
+        L->leidos++;
+        pthread_cond_broadcast(&L->cambio);
+        pthread_mutex_unlock(&L->mutex);
+    }
+    return NULL;
+}
+
+static int iniciarLector(LectorPaneles *L, const MatrizEnDisco *M, const int *orden,
+                         const int *escritos_antes, int cantidad)
+{
+    size_t por_panel = (size_t)M->ancho_panel * M->n;
+    L->M = M;
+    L->orden = orden;
+    L->escritos_antes = escritos_antes;
+    L->cantidad = cantidad;
+    L->leidos = 0;
+    L->consumidos = 0;
+    L->escritos = 0;
+    L->error = 0;
+    L->cancelar = 0;
+    L->buffers[0] = (double *)malloc(2 * por_panel * sizeof(double));
+    if (L->buffers[0] == NULL)
+        return 1;
+    L->buffers[1] = L->buffers[0] + por_panel;
+
+    pthread_mutex_init(&L->mutex, NULL);
+    pthread_cond_init(&L->cambio, NULL);
+    if (pthread_create(&L->hilo, NULL, hiloLector, L) != 0)
+    {
+        pthread_mutex_destroy(&L->mutex);
+        pthread_cond_destroy(&L->cambio);
+        free(L->buffers[0]);
+        return 1;
+    }
+    return 0;
+}
+
+/* Espera la próxima entrada del orden; devuelve NULL si su lectura falló */
+static const double *siguientePanel(LectorPaneles *L)
+{
+    pthread_mutex_lock(&L->mutex);
+    while (L->leidos <= L->consumidos)
+        pthread_cond_wait(&L->cambio, &L->mutex);
+    int error = L->error;
+    pthread_mutex_unlock(&L->mutex);
+    return error ? NULL : L->buffers[L->consumidos % 2];
+}
+
+static void liberarPanel(LectorPaneles *L)
+{
+    pthread_mutex_lock(&L->mutex);
+    L->consumidos++;
+    pthread_cond_broadcast(&L->cambio);
+    pthread_mutex_unlock(&L->mutex);
+}
+
+static void avisarPanelEscrito(LectorPaneles *L)
+{
+    pthread_mutex_lock(&L->mutex);
+    L->escritos++;
+    pthread_cond_broadcast(&L->cambio);
+    pthread_mutex_unlock(&L->mutex);
+}
+
+static void terminarLector(LectorPaneles *L)
+{
+    pthread_mutex_lock(&L->mutex);
+    L->cancelar = 1;
+    pthread_cond_broadcast(&L->cambio);
+    pthread_mutex_unlock(&L->mutex);
+    pthread_join(L->hilo, NULL);
+    pthread_mutex_destroy(&L->mutex);
+    pthread_cond_destroy(&L->cambio);
+    free(L->buffers[0]);
+}
+
+/* ---------------------------------------------------------------------------
+   Factorización
+   --------------------------------------------------------------------------- */
+
+/* Aplica al panel actual (w columnas) los intercambios de las filas [f0, f1) */
+static void intercambiarFilasPanel(double *panel, int n, int w, const int *pivotes, int f0, int f1)
+{
+    for (int r = f0; r < f1; r++)
+    {
+        int p = pivotes[r];
+        if (p == r)
+            continue;
+        for (int c = 0; c < w; c++)
+        {
+            double *columna = panel + (size_t)c * n;
+            double aux = columna[r];
+            columna[r] = columna[p];
+            columna[p] = aux;
+        }
+    }
+}
+
+/*
+ * Actualiza el panel actual (w columnas) con el panel anterior L_j (wj columnas,
+ * que empiezan en la fila/columna j0): primero U_jk = L_jj⁻¹ A_jk sobre las filas
+ * [j0, j0+wj) y después A_(debajo) -= L_(debajo),j U_jk por mosaicos de filas, así
+ * el trozo de L_j y del panel actual quedan en caché mientras se recorren.
+ */
+static void actualizarConPanel(double *panel, int n, int w, const double *Lj, int j0, int wj)
+{
+    int fin_j = j0 + wj;
+
+    for (int c = 0; c < w; c++)
+    {
+        double *columna = panel + (size_t)c * n;
+        for (int t = 0; t < wj; t++)
+        {
+            const double *l = Lj + (size_t)t * n;
+            double u = columna[j0 + t];
+            for (int i = j0 + t + 1; i < fin_j; i++)
+                columna[i] -= l[i] * u;
+        }
+    }
+
+    for (int i0 = fin_j; i0 < n; i0 += TAM_MOSAICO_DISCO)
+    {
+        int i1 = (i0 + TAM_MOSAICO_DISCO < n) ? i0 + TAM_MOSAICO_DISCO : n;
+        for (int c = 0; c < w; c++)
+        {
+            double *columna = panel + (size_t)c * n;
+            for (int t = 0; t < wj; t++)
+            {
+                const double *l = Lj + (size_t)t * n;
+                double u = columna[j0 + t];
+                for (int i = i0; i < i1; i++)
+                    columna[i] -= l[i] * u;
+            }
+        }
+    }
+}
+
+/*
+ * Eliminación clásica de las columnas [c0, c1) del panel actual (w columnas que
+ * empiezan en la columna global k0). Los intercambios se aplican a todo el ancho
+ * del panel; la actualización, sólo a las columnas [c0, c1).
+ */
+static EstadoSolver eliminarColumnasPanel(double *panel, int n, int w, int k0, int c0, int c1, int *pivotes)
+{
+    for (int c = c0; c < c1; c++)
+    {
+        int g = k0 + c;
+        double *columna = panel + (size_t)c * n;
+
+        int p = g;
+        double maximo = fabs(columna[g]);
+        for (int i = g + 1; i < n; i++)
+            if (fabs(columna[i]) > maximo)
+            {
+                maximo = fabs(columna[i]);
+                p = i;
+            }
+        pivotes[g] = p;
+        if (maximo == 0.0)
+            return SOLVER_SINGULAR;
+        if (p != g)
+            intercambiarFilasPanel(panel, n, w, pivotes, g, g + 1);
+
+        double inv_pivote = 1.0 / columna[g];
+        for (int i = g + 1; i < n; i++)
+            columna[i] *= inv_pivote;
+
+        for (int c2 = c + 1; c2 < c1; c2++)
+        {
+            double *otra = panel + (size_t)c2 * n;
+            double u = otra[g];
+            for (int i = g + 1; i < n; i++)
+                otra[i] -= columna[i] * u;
+        }
+    }
+    return SOLVER_OK;
+}
+
+/*
+ * Factoriza el panel actual (columnas globales [k0, k0+w)) con pivoteo parcial.
+ * Un panel ancho se procesa por subpaneles de ANCHO_SUBPANEL columnas ("right-
+ * looking"): eliminación clásica del subpanel y actualización del resto del panel
+ * con actualizarConPanel(), que recorre memoria contigua por mosaicos.
+ */
+static EstadoSolver factorizarPanelEnDisco(double *panel, int n, int w, int k0, int *pivotes)
+{
+    for (int s0 = 0; s0 < w; s0 += ANCHO_SUBPANEL)
+    {
+        int s1 = (s0 + ANCHO_SUBPANEL < w) ? s0 + ANCHO_SUBPANEL : w;
+        EstadoSolver estado = eliminarColumnasPanel(panel, n, w, k0, s0, s1, pivotes);
+        if (estado != SOLVER_OK)
+            return estado;
+        if (s1 < w)
+            actualizarConPanel(panel + (size_t)s1 * n, n, w - s1, panel + (size_t)s0 * n, k0 + s0, s1 - s0);
+    }
+    return SOLVER_OK;
+}
+
+EstadoSolver factorizarEnDisco(MatrizEnDisco *M)
+{
+    int n = M->n;
+    int P = M->num_paneles;
+    int ancho = M->ancho_panel;
+
+    // Orden de lectura: en el paso k, el panel k y luego los paneles 0..k-1
+    int cantidad = P * (P + 1) / 2;
+    int *orden = (int *)calloc(2 * (size_t)cantidad, sizeof(int));
+    double *actual = (double *)malloc((size_t)ancho * n * sizeof(double));
+    if (orden == NULL || actual == NULL)
+    {
+        free(orden);
+        free(actual);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    int *escritos_antes = orden + cantidad;
+    int e = 0;
+    for (int k = 0; k < P; k++)
+    {
+        orden[e] = k;
+        escritos_antes[e++] = 0; // Todavía tiene los datos originales
+        for (int j = 0; j < k; j++)
+        {
+            orden[e] = j;
+            escritos_antes[e++] = j + 1;
+        }
+    }
+
+    LectorPaneles L;
+    if (iniciarLector(&L, M, orden, escritos_antes, cantidad) != 0)
+    {
+        free(orden);
+        free(actual);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    EstadoSolver estado = SOLVER_OK;
+    M->factorizada = 0;
+    for (int k = 0; k < P && estado == SOLVER_OK; k++)
+    {
+        int k0 = k * ancho;
+        int w = columnasPanel(M, k);
+
+        const double *leido = siguientePanel(&L);
+        if (leido == NULL)
+        {
+            estado = SOLVER_ERROR_MEMORIA;
+            break;
+        }
+        memcpy(actual, leido, (size_t)w * n * sizeof(double));
+        liberarPanel(&L);
+
+        for (int j = 0; j < k; j++)
+        {
+            const double *Lj = siguientePanel(&L);
+            if (Lj == NULL)
+            {
+                estado = SOLVER_ERROR_MEMORIA;
+                break;
+            }
+            int j0 = j * ancho;
+            intercambiarFilasPanel(actual, n, w, M->pivotes, j0, j0 + ancho);
+            actualizarConPanel(actual, n, w, Lj, j0, ancho);
+            liberarPanel(&L);
+        }
+        if (estado != SOLVER_OK)
+            break;
+
+        estado = factorizarPanelEnDisco(actual, n, w, k0, M->pivotes);
+        if (estado == SOLVER_OK && escribirPanelEnDisco(M, k, actual) != 0)
+            estado = SOLVER_ERROR_MEMORIA;
+        avisarPanelEscrito(&L);
+    }
+
+    terminarLector(&L);
+    free(orden);
+    free(actual);
+    if (estado == SOLVER_ERROR_MEMORIA)
+        fprintf(stderr, "[ERROR] Falló la lectura o escritura del archivo de paneles.\n");
+    M->factorizada = (estado == SOLVER_OK);
+    return estado;
+}
+
+/* ---------------------------------------------------------------------------
+   Resolución
+   --------------------------------------------------------------------------- */
+
+EstadoSolver resolverEnDisco(const MatrizEnDisco *M, const double *b, double *x)
+{
+    int n = M->n;
+    int P = M->num_paneles;
+    int ancho = M->ancho_panel;
+
+    if (!M->factorizada)
+        return SOLVER_ERROR_MEMORIA;
+
+    // Paneles 0..P-1 para L*y = P*b y luego P-1..0 para U*x = y
+    int *orden = (int *)malloc(2 * (size_t)P * sizeof(int));
+    if (orden == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    for (int p = 0; p < P; p++)
+    {
+        orden[p] = p;
+        orden[P + p] = P - 1 - p;
+    }
+
+    LectorPaneles L;
+    if (iniciarLector(&L, M, orden, NULL, 2 * P) != 0)
+    {
+        free(orden);
+        return SOLVER_ERROR_MEMORIA;
+    }
+
+    if (x != b)
+        memcpy(x, b, (size_t)n * sizeof(double));
+
+    EstadoSolver estado = SOLVER_OK;
+    for (int p = 0; p < P && estado == SOLVER_OK; p++)
+    {
+        const double *panel = siguientePanel(&L);
+        if (panel == NULL)
+        {
+            estado = SOLVER_ERROR_MEMORIA;
+            break;
+        }
+        int j0 = p * ancho;
+        int w = columnasPanel(M, p);
+
+        // Los intercambios de este panel, y sólo entonces sus columnas de L
+        for (int r = j0; r < j0 + w; r++)
+        {
+            double aux = x[r];
+            x[r] = x[M->pivotes[r]];
+            x[M->pivotes[r]] = aux;
+        }
+        for (int t = 0; t < w; t++)
+        {
+            const double *l = panel + (size_t)t * n;
+            double y = x[j0 + t];
+            for (int i = j0 + t + 1; i < n; i++)
+                x[i] -= l[i] * y;
+        }
+        liberarPanel(&L);
+    }
+
+    for (int p = P - 1; p >= 0 && estado == SOLVER_OK; p--)
+    {
+        const double *panel = siguientePanel(&L);
+        if (panel == NULL)
+        {
+            estado = SOLVER_ERROR_MEMORIA;
+            break;
+        }
+        int j0 = p * ancho;
+        int w = columnasPanel(M, p);
+
+        // Sustitución hacia atrás por columnas de U (contiguas en el panel)
+        for (int t = w - 1; t >= 0; t--)
+        {
+            const double *u = panel + (size_t)t * n;
+            int g = j0 + t;
+            x[g] /= u[g];
+            double xg = x[g];
+            for (int i = 0; i < g; i++)
+                x[i] -= u[i] * xg;
+        }
+        liberarPanel(&L);
+    }
+
+    terminarLector(&L);
+    free(orden);
+    return estado;
+}
+
+void cerrarMatrizEnDisco(MatrizEnDisco *M)
+{
+    if (M == NULL)
+        return;
+    if (M->temporal != NULL)
+        fclose(M->temporal); // tmpfile se borra al cerrarse
+    else if (M->fd >= 0)
+        close(M->fd);
+    M->temporal = NULL;
+    M->fd = -1;
+    free(M->pivotes);
+    M->pivotes = NULL;
+    M->factorizada = 0;
+}
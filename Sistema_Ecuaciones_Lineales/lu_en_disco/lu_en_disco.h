@@ -0,0 +1,129 @@
+/**
+ * @file lu_en_disco.h
+ * @brief Eliminación de Gauss (LU con pivoteo parcial) fuera de memoria: la matriz
+ *        vive en un archivo, dividida en paneles de columnas.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * eliminacionGaussDensa() y factorizarLU() necesitan las n² entradas en memoria.
+ * Aquí la matriz se guarda en un archivo como paneles de ancho_panel columnas
+ * consecutivas; cada panel es un bloque contiguo de n x ancho_panel doubles por
+ * columnas (la columna c del panel p empieza en (p*ancho_panel + c)*n):
+ *
+ *   | panel 0 | panel 1 | ... | panel P-1 |     (P = ceil(n / ancho_panel))
+ *
+ * En memoria sólo hay tres paneles a la vez: el que se factoriza y dos búferes
+ * que un hilo lector llena por adelantado (lectura asíncrona con doble búfer).
+ * El ancho del panel sale del presupuesto de memoria (anchoPanelEnDisco()), así
+ * que la memoria usada no depende de n² y la E/S es previsible: factorizar lee
+ * P(P+1)/2 paneles y escribe P; cada resolución lee 2P paneles.
+ *
+ * Uso:
+ *   MatrizEnDisco M;
+ *   crearMatrizEnDisco(&M, NULL, n, 512UL << 20);  // archivo temporal, 512 MB de paneles
+ *   for (int p = 0; p < M.num_paneles; p++)
+ *       ... llenar un panel por columnas y escribirPanelEnDisco(&M, p, panel) ...
+ *   factorizarEnDisco(&M);
+ *   resolverEnDisco(&M, b, x);
+ *   cerrarMatrizEnDisco(&M);
+ *
+ * Compilar con -pthread. Sólo POSIX (pread/pwrite).
+ */
+#ifndef LU_EN_DISCO_H
+#define LU_EN_DISCO_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include "../matriz_densa/matriz_densa.h"
+
+#define PANELES_EN_MEMORIA 3 // El panel en factorización y los dos búferes del lector
+
+/**
+ * @brief Matriz n x n guardada en un archivo por paneles de columnas, y su factorización.
+ */
+typedef struct
+{
+    int fd;                 // Descriptor del archivo de paneles
+    FILE *temporal;         // Archivo temporal (tmpfile) si no se dio ruta, NULL si no
+    int n;                  // Tamaño de la matriz
+    int ancho_panel;        // Columnas por panel (el último puede tener menos)
+    int num_paneles;        // ceil(n / ancho_panel)
+    int *pivotes;           // En el paso k se intercambió la fila k con la fila pivotes[k]
+    int factorizada;        // 1 después de factorizarEnDisco() exitosa
+} MatrizEnDisco;
+
+/**
+ * @brief Ancho de panel para que PANELES_EN_MEMORIA paneles de n filas entren en memoria bytes.
+ * @return Entre 1 y n.
+ */
+int anchoPanelEnDisco(int n, size_t memoria);
+
+/**
+ * @brief Crea el archivo de paneles de una matriz n x n (con todos los elementos en cero).
+ * @param M Matriz en disco (salida).
+ * @param ruta Archivo a crear (se trunca si existe), o NULL para un archivo temporal
+ *             que se borra solo al cerrarlo.
+ * @param n Tamaño de la matriz.
+ * @param memoria Bytes disponibles para paneles (ver anchoPanelEnDisco()).
+ * @return 0 si todo salió bien, 1 si hubo error (se informa con [ERROR]).
+ */
+int crearMatrizEnDisco(MatrizEnDisco *M, const char *ruta, int n, size_t memoria);
+
+/**
+ * @brief Escribe el panel p: columnas [p*ancho_panel, ...) guardadas una tras otra (n doubles cada una).
+ * @return 0 si todo salió bien, 1 si hubo error de escritura.
+ */
+int escribirPanelEnDisco(MatrizEnDisco *M, int p, const double *panel);
+
+/**
+ * @brief Lee el panel p (mismo formato que escribirPanelEnDisco()).
+ * @details Después de factorizarEnDisco() el panel contiene sus columnas de L
+ *          (debajo de la diagonal, con los intercambios de filas hasta ese panel)
+ *          y de U (diagonal y encima).
+ * @return 0 si todo salió bien, 1 si hubo error de lectura.
+ */
+int leerPanelEnDisco(const MatrizEnDisco *M, int p, double *panel);
+
+/**
+ * @brief Copia una MatrizDensa (en memoria o mapeada desde un archivo) al archivo de paneles.
+ * @details Arma PANELES_EN_MEMORIA paneles por pasada, recorriendo las filas de A
+ *          una vez por pasada: la memoria usada sigue siendo la de los paneles.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o de escritura.
+ */
+int cargarMatrizEnDisco(MatrizEnDisco *M, const MatrizDensa *A);
+
+/**
+ * @brief Factoriza P*A = L*U panel por panel, en el mismo archivo.
+ * @details Algoritmo "left-looking": para el panel k se aplican, en orden, los
+ *          intercambios y la actualización de cada panel j < k ya factorizado
+ *
+ *            U_jk = L_jj⁻¹ A_jk,   A_(debajo),k -= L_(debajo),j U_jk
+ *
+ *          y luego se factoriza el panel con pivoteo parcial y se escribe. Así
+ *          cada panel se escribe una sola vez y los paneles anteriores sólo se
+ *          leen. Mientras se usa un panel el hilo lector ya está leyendo el
+ *          siguiente; un panel de L nunca se lee antes de haberse escrito.
+ *
+ *          Los intercambios de un panel no se aplican a las columnas de los
+ *          paneles anteriores (ya escritos): resolverEnDisco() los aplica a b
+ *          panel por panel, en el mismo orden.
+ * @return SOLVER_OK, SOLVER_SINGULAR (pivote nulo) o SOLVER_ERROR_MEMORIA
+ *         (también si falla la lectura o escritura del archivo).
+ */
+EstadoSolver factorizarEnDisco(MatrizEnDisco *M);
+
+/**
+ * @brief Resuelve A*x = b con la factorización del archivo (lee cada panel dos veces).
+ * @param M Matriz factorizada con factorizarEnDisco().
+ * @param b Vector de términos independientes (no se modifica).
+ * @param x Solución (salida). Puede ser el mismo puntero que b.
+ * @return SOLVER_OK o SOLVER_ERROR_MEMORIA (memoria o E/S).
+ */
+EstadoSolver resolverEnDisco(const MatrizEnDisco *M, const double *b, double *x);
+
+/**
+ * @brief Cierra el archivo de paneles (el temporal se borra) y libera los pivotes.
+ */
+void cerrarMatrizEnDisco(MatrizEnDisco *M);
+
+#endif // LU_EN_DISCO_H
@@ -0,0 +1,229 @@
+/**
+ * @file matriz_banda.c
+ * @brief Implementación del algoritmo de Thomas y de Gauss para matrices banda.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "matriz_banda.h"
+
+EstadoSolver resolverTridiagonal(int n, const double *inferior, const double *diagonal,
+                                 const double *superior, const double *d, double *x)
+{
+    if (n <= 0)
+        return SOLVER_OK;
+
+    // c[i] = superior[i] ya dividido por el pivote de la fila i
+    double *c = (double *)malloc((size_t)n * sizeof(double));
+    if (c == NULL)
+        return SOLVER_ERROR_MEMORIA;
+
+    // Eliminación hacia adelante: x guarda los términos independientes transformados
+    if (diagonal[0] == 0.0)
+    {
+        free(c);
+        return SOLVER_SINGULAR;
+    }
+    c[0] = (n > 1) ? superior[0] / diagonal[0] : 0.0;
+    x[0] = d[0] / diagonal[0];
+    for (int i = 1; i < n; i++)
+    {
+        double pivote = diagonal[i] - inferior[i] * c[i - 1];
+        if (pivote == 0.0)
+        {
+            free(c);
+            return SOLVER_SINGULAR;
+        }
+        c[i] = (i < n - 1) ? superior[i] / pivote : 0.0;
+        x[i] = (d[i] - inferior[i] * x[i - 1]) / pivote;
+    }
+
+    // Sustitución hacia atrás
+    for (int i = n - 2; i >= 0; i--)
+        x[i] -= c[i] * x[i + 1];
+
+    free(c);
+    return SOLVER_OK;
+}
+
+EstadoSolver resolverTridiagonalCiclico(int n, const double *inferior, const double *diagonal,
+                                        const double *superior, const double *d, double *x)
+{
+    if (n <= 0)
+        return SOLVER_OK;
+    if (n == 1)
+    {
+        // x[0] es a la vez su vecino izquierdo y derecho
+        double a = inferior[0] + diagonal[0] + superior[0];
+        if (a == 0.0)
+            return SOLVER_SINGULAR;
+        x[0] = d[0] / a;
+        return SOLVER_OK;
+    }
+    if (n == 2)
+    {
+        // Las esquinas caen sobre las diagonales vecinas: sistema 2 x 2
+        double a = diagonal[0], b = inferior[0] + superior[0];
+        double c = inferior[1] + superior[1], e = diagonal[1];
+        double det = a * e - b * c;
+        if (det == 0.0)
+            return SOLVER_SINGULAR;
+        double x0 = (d[0] * e - b * d[1]) / det;
+        double x1 = (a * d[1] - c * d[0]) / det;
+        x[0] = x0;
+        x[1] = x1;
+        return SOLVER_OK;
+    }
+
+    // A = T + u·vᵀ con u = (γ, 0, ..., 0, α) y v = (1, 0, ..., 0, β/γ), donde
+    // α = A(n-1, 0) y β = A(0, n-1). T es A sin esquinas y con diagonal[0] - γ y
+    // diagonal[n-1] - αβ/γ. γ = -diagonal[0] evita la cancelación en T(0, 0)
+    double alfa = superior[n - 1];
+    double beta = inferior[0];
+    double gamma = (diagonal[0] != 0.0) ? -diagonal[0] : 1.0;
+
+    double *bloque = (double *)malloc(2 * (size_t)n * sizeof(double));
+    if (bloque == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    double *diagonal_t = bloque;    // Diagonal de T
+    double *z = bloque + n;         // u y luego T⁻¹u
+
+    for (int i = 0; i < n; i++)
+    {
+        diagonal_t[i] = diagonal[i];
+        z[i] = 0.0;
+    }
+    diagonal_t[0] -= gamma;
+    diagonal_t[n - 1] -= alfa * beta / gamma;
+    z[0] = gamma;
+    z[n - 1] = alfa;
+
+    // resolverTridiagonal no usa inferior[0] ni superior[n-1]: las esquinas quedan fuera de T
+    EstadoSolver estado = resolverTridiagonal(n, inferior, diagonal_t, superior, d, x);
+    if (estado == SOLVER_OK)
+        estado = resolverTridiagonal(n, inferior, diagonal_t, superior, z, z);
+    if (estado != SOLVER_OK)
+    {
+        free(bloque);
+        return estado;
+    }
+
+    double denominador = 1.0 + z[0] + beta * z[n - 1] / gamma;
+    if (denominador == 0.0)
+    {
+        free(bloque);
+        return SOLVER_SINGULAR;
+    }
+    double factor = (x[0] + beta * x[n - 1] / gamma) / denominador;
+    for (int i = 0; i < n; i++)
+        x[i] -= factor * z[i];
+
+    free(bloque);
+    return SOLVER_OK;
+}
+
+int crearMatrizBanda(MatrizBanda *M, int n, int inferiores, int superiores)
+{
+    memset(M, 0, sizeof(MatrizBanda));
+    if (n <= 0 || inferiores < 0 || superiores < 0)
+        return 1;
+
+    int ancho = 2 * inferiores + superiores + 1;
+    M->datos = (double *)calloc((size_t)n * ancho, sizeof(double));
+    if (M->datos == NULL)
+        return 1;
+
+    M->n = n;
+    M->inferiores = inferiores;
+    M->superiores = superiores;
+    M->ancho = ancho;
+    return 0;
+}
+
+void liberarMatrizBanda(MatrizBanda *M)
+{
+    free(M->datos);
+    memset(M, 0, sizeof(MatrizBanda));
+}
+
+void productoBandaVector(const MatrizBanda *M, const double *x, double *y)
+{
+    int n = M->n;
+    for (int i = 0; i < n; i++)
+    {
+        int desde = (i - M->inferiores > 0) ? i - M->inferiores : 0;
+        int hasta = (i + M->superiores < n - 1) ? i + M->superiores : n - 1;
+        double suma = 0.0;
+        for (int j = desde; j <= hasta; j++)
+            suma += MB(M, i, j) * x[j];
+        y[i] = suma;
+    }
+}
+
+EstadoSolver eliminacionGaussBanda(MatrizBanda *A, double *b, double *x)
+{
+    int n = A->n;
+    int kl = A->inferiores;
+    int ancho_u = A->inferiores + A->superiores; // Ancho de U con el relleno del pivoteo
+
+    for (int k = 0; k < n; k++)
+    {
+        int ultima_fila = (k + kl < n - 1) ? k + kl : n - 1;
+        int ultima_columna = (k + ancho_u < n - 1) ? k + ancho_u : n - 1;
+
+        // Pivoteo parcial entre las filas que tienen elementos en la columna k
+        int p = k;
+        double maximo = fabs(MB(A, k, k));
+        for (int i = k + 1; i <= ultima_fila; i++)
+        {
+            double valor = fabs(MB(A, i, k));
+            if (valor > maximo)
+            {
+                maximo = valor;
+                p = i;
+            }
+        }
+        if (maximo == 0.0)
+            return SOLVER_SINGULAR;
+
+        if (p != k)
+        {
+            for (int j = k; j <= ultima_columna; j++)
+            {
+                double temp = MB(A, k, j);
+                MB(A, k, j) = MB(A, p, j);
+                MB(A, p, j) = temp;
+            }
+            double temp = b[k];
+            b[k] = b[p];
+            b[p] = temp;
+        }
+
+        // Eliminación: sólo las filas k+1..k+kl y las columnas hasta k+kl+ku
+        double pivote = MB(A, k, k);
+        for (int i = k + 1; i <= ultima_fila; i++)
+        {
+            double factor = MB(A, i, k) / pivote;
+            if (factor == 0.0)
+                continue;
+            MB(A, i, k) = 0.0;
+            for (int j = k + 1; j <= ultima_columna; j++)
+                MB(A, i, j) -= factor * MB(A, k, j);
+            b[i] -= factor * b[k];
+        }
+    }
+
+    // Sustitución hacia atrás sobre U (ancho kl+ku)
+    for (int i = n - 1; i >= 0; i--)
+    {
+        int ultima_columna = (i + ancho_u < n - 1) ? i + ancho_u : n - 1;
+        double suma = b[i];
+        for (int j = i + 1; j <= ultima_columna; j++)
+            suma -= MB(A, i, j) * x[j];
+        x[i] = suma / MB(A, i, i);
+    }
+    return SOLVER_OK;
+}
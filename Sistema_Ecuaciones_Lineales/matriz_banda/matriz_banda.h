@@ -0,0 +1,118 @@
+/**
+ * @file matriz_banda.h
+ * @brief Sistemas tridiagonales (algoritmo de Thomas) y matrices banda, en O(n).
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Muchos sistemas que aparecen en la práctica sólo tienen elementos no nulos
+ * cerca de la diagonal: el de las segundas derivadas de los splines cúbicos es
+ * tridiagonal, y las discretizaciones en diferencias finitas son banda. Guardarlos
+ * como matriz densa cuesta O(n²) memoria y resolverlos con Gauss O(n³) tiempo,
+ * aunque casi todo sea cero. Aquí sólo se guardan las diagonales:
+ *
+ *   - resolverTridiagonal(): tres vectores (inferior, diagonal, superior) y el
+ *     algoritmo de Thomas, O(n) tiempo y memoria.
+ *   - resolverTridiagonalCiclico(): lo mismo con los elementos de las esquinas
+ *     (problemas periódicos), con Sherman-Morrison sobre dos pasadas de Thomas.
+ *   - MatrizBanda: kl diagonales debajo y ku encima de la principal, resuelta con
+ *     Gauss con pivoteo parcial en O(n·kl·(kl+ku)).
+ */
+#ifndef MATRIZ_BANDA_H
+#define MATRIZ_BANDA_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Matriz banda n x n guardada por filas.
+ * @details La fila i guarda las columnas i-inferiores .. i+superiores+inferiores
+ *          (ancho = 2*inferiores + superiores + 1 valores). Las inferiores columnas
+ *          extra a la derecha quedan en cero y reciben el relleno que producen los
+ *          intercambios de filas del pivoteo parcial. Usar la macro MB(M, i, j),
+ *          válida sólo para -inferiores <= j - i <= superiores.
+ */
+typedef struct
+{
+    int n;              // Tamaño de la matriz
+    int inferiores;     // Diagonales no nulas debajo de la principal (kl)
+    int superiores;     // Diagonales no nulas encima de la principal (ku)
+    int ancho;          // Valores guardados por fila: 2*kl + ku + 1
+    double *datos;      // n*ancho valores
+} MatrizBanda;
+
+/** @brief Acceso al elemento (i, j) de una MatrizBanda (puntero). */
+#define MB(M, i, j) ((M)->datos[(size_t)(i) * (size_t)(M)->ancho + (size_t)((j) - (i) + (M)->inferiores)])
+
+/**
+ * @brief Resuelve un sistema tridiagonal con el algoritmo de Thomas.
+ * @details La fila i del sistema es
+ *
+ *            inferior[i]*x[i-1] + diagonal[i]*x[i] + superior[i]*x[i+1] = d[i]
+ *
+ *          (inferior[0] y superior[n-1] no se usan). Es eliminación de Gauss sin
+ *          pivoteo restringida a las tres diagonales: 8n operaciones y un vector
+ *          auxiliar de n doubles. Es estable si la matriz es diagonalmente
+ *          dominante o simétrica definida positiva, como las de los splines.
+ * @param n Tamaño del sistema.
+ * @param inferior, diagonal, superior Diagonales de la matriz (no se modifican).
+ * @param d Términos independientes (no se modifica).
+ * @param x Solución (salida). Puede ser el mismo puntero que d.
+ * @return SOLVER_OK, SOLVER_SINGULAR (pivote nulo) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver resolverTridiagonal(int n, const double *inferior, const double *diagonal,
+                                 const double *superior, const double *d, double *x);
+
+/**
+ * @brief Resuelve un sistema tridiagonal cíclico (con esquinas) en O(n).
+ * @details La fila i del sistema es, con índices módulo n,
+ *
+ *            inferior[i]*x[i-1] + diagonal[i]*x[i] + superior[i]*x[i+1] = d[i]
+ *
+ *          es decir, inferior[0] es el elemento (0, n-1) y superior[n-1] el
+ *          (n-1, 0). Aparece en los splines periódicos y en diferencias finitas
+ *          con condiciones periódicas. Con la fórmula de Sherman-Morrison la
+ *          matriz se escribe como T + u·vᵀ, con T tridiagonal, y se resuelven
+ *          T·y = d y T·z = u con resolverTridiagonal():
+ *
+ *            x = y - (vᵀy / (1 + vᵀz)) · z
+ *
+ *          Son dos pasadas de Thomas (unas 17n operaciones) en lugar de Gauss
+ *          denso. Para n <= 2 las esquinas se suman a las diagonales vecinas.
+ * @param n Tamaño del sistema.
+ * @param inferior, diagonal, superior Diagonales de la matriz, con las esquinas (no se modifican).
+ * @param d Términos independientes (no se modifica).
+ * @param x Solución (salida). Puede ser el mismo puntero que d.
+ * @return SOLVER_OK, SOLVER_SINGULAR o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver resolverTridiagonalCiclico(int n, const double *inferior, const double *diagonal,
+                                        const double *superior, const double *d, double *x);
+
+/**
+ * @brief Reserva una matriz banda n x n en cero.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o tamaños inválidos.
+ */
+int crearMatrizBanda(MatrizBanda *M, int n, int inferiores, int superiores);
+
+/**
+ * @brief Libera la memoria de la matriz y deja sus campos en cero.
+ */
+void liberarMatrizBanda(MatrizBanda *M);
+
+/**
+ * @brief Calcula y = M*x recorriendo sólo la banda.
+ */
+void productoBandaVector(const MatrizBanda *M, const double *x, double *y);
+
+/**
+ * @brief Eliminación de Gauss con pivoteo parcial sobre una MatrizBanda.
+ * @details El pivote de la columna k se busca sólo entre las filas k..k+kl (las
+ *          demás ya son cero), y cada fila se actualiza sólo en las kl+ku columnas
+ *          que pueden ser no nulas, así que el costo es O(n·kl·(kl+ku)) en lugar
+ *          de O(n³).
+ * @param A Matriz banda (se transforma en triangular superior de ancho kl+ku).
+ * @param b Vector de términos independientes (se modifica).
+ * @param x Vector solución (salida, n elementos).
+ * @return SOLVER_OK o SOLVER_SINGULAR.
+ */
+EstadoSolver eliminacionGaussBanda(MatrizBanda *A, double *b, double *x);
+
+#endif // MATRIZ_BANDA_H
@@ -0,0 +1,376 @@
+/**
+ * @file matriz_densa.c
+ * @brief Implementación de la matriz densa contigua y de los solvers asociados.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Con double** cada acceso a una fila es una indirección y las filas quedan
+ * dispersas en el heap; aquí la matriz completa es un único bloque, por lo que
+ * recorrer una fila (o pasar a la siguiente) es acceso secuencial a memoria y el
+ * prefetcher del procesador puede anticipar las lecturas.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "matriz_densa.h"
+#include "../nucleos_simd/nucleos_simd.h"
+
+/* Reserva alineada portable (aligned_alloc exige tamaño múltiplo de la alineación) */
+void *reservarAlineado(size_t bytes)
+{
+    bytes = (bytes + ALINEACION_MATRIZ - 1) / ALINEACION_MATRIZ * ALINEACION_MATRIZ;
+#ifdef _WIN32
+    return _aligned_malloc(bytes, ALINEACION_MATRIZ);
+#else
+    return aligned_alloc(ALINEACION_MATRIZ, bytes);
+#endif
+}
+
+void liberarAlineado(void *p)
+{
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+int crearMatrizDensa(MatrizDensa *M, int filas, int columnas)
+{
+    const int dobles_por_linea = ALINEACION_MATRIZ / (int)sizeof(double);
+
+    M->filas = 0;
+    M->columnas = 0;
+    M->stride = 0;
+    M->datos = NULL;
+
+    if (filas <= 0 || columnas <= 0)
+        return 1;
+
+    // Redondear el ancho de fila a un múltiplo de la línea de caché
+    int stride = (columnas + dobles_por_linea - 1) / dobles_por_linea * dobles_por_linea;
+    size_t bytes = (size_t)filas * (size_t)stride * sizeof(double);
+
+    double *datos = (double *)reservarAlineado(bytes);
+    if (datos == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para la matriz %dx%d.\n", filas, columnas);
+        return 1;
+    }
+    memset(datos, 0, bytes);
+
+    M->filas = filas;
+    M->columnas = columnas;
+    M->stride = stride;
+    M->datos = datos;
+    return 0;
+}
+
+void liberarMatrizDensa(MatrizDensa *M)
+{
+    if (M == NULL)
+        return;
+    liberarAlineado(M->datos);
+    M->datos = NULL;
+    M->filas = 0;
+    M->columnas = 0;
+    M->stride = 0;
+}
+
+int copiarMatrizDensa(MatrizDensa *destino, const MatrizDensa *origen)
+{
+    if (crearMatrizDensa(destino, origen->filas, origen->columnas) != 0)
+        return 1;
+    // Ambas matrices tienen el mismo stride, por lo que se copia el bloque entero
+    memcpy(destino->datos, origen->datos,
+           (size_t)origen->filas * (size_t)origen->stride * sizeof(double));
+    return 0;
+}
+
+int matrizDensaDesdePunteros(MatrizDensa *M, double **A, int filas, int columnas)
+{
+    if (crearMatrizDensa(M, filas, columnas) != 0)
+        return 1;
+    for (int i = 0; i < filas; i++)
+        memcpy(filaMatrizDensa(M, i), A[i], (size_t)columnas * sizeof(double));
+    return 0;
+}
+
+void productoMatrizVector(const MatrizDensa *M, const double *x, double *y)
+{
+    for (int i = 0; i < M->filas; i++)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        double suma = 0.0;
+        for (int j = 0; j < M->columnas; j++)
+            suma += fila[j] * x[j];
+        y[i] = suma;
+    }
+}
+
+double normaUnoMatrizDensa(const MatrizDensa *M)
+{
+    double *suma = (double *)calloc((size_t)M->columnas, sizeof(double));
+    if (suma == NULL)
+        return -1.0;
+
+    // Por filas: cada fila es contigua y suma[] entra en caché
+    for (int i = 0; i < M->filas; i++)
+    {
+        const double *fila = filaMatrizDensa(M, i);
+        for (int j = 0; j < M->columnas; j++)
+            suma[j] += fabs(fila[j]);
+    }
+
+    double norma = 0.0;
+    for (int j = 0; j < M->columnas; j++)
+        if (suma[j] > norma)
+            norma = suma[j];
+    free(suma);
+    return norma;
+}
+
+const char *nombreEstadoSolver(EstadoSolver estado)
+{
+    switch (estado)
+    {
+    case SOLVER_OK:
+        return "OK";
+    case SOLVER_ERROR_MEMORIA:
+        return "ERROR_MEMORIA";
+    case SOLVER_SINGULAR:
+        return "SINGULAR";
+    case SOLVER_DIVERGE:
+        return "DIVERGE";
+    case SOLVER_MAX_ITER:
+        return "MAX_ITER";
+    }
+    return "DESCONOCIDO";
+}
+
+void iniciarControlConvergencia(ControlConvergencia *c)
+{
+    for (int i = 0; i < VENTANA_CONVERGENCIA; i++)
+        c->errores[i] = INFINITY;
+}
+
+int controlarConvergencia(ControlConvergencia *c, double error, int iteracion,
+                          const ParametrosIterativos *param, EstadoSolver *estado)
+{
+    if (error <= param->tolerancia)
+    {
+        *estado = SOLVER_OK;
+        return 1;
+    }
+    // errores[iteracion % V] todavía guarda el error de la iteración (iteracion - V).
+    // El error de un paso puede crecer aunque el método converja (Jacobi con T no
+    // normal): la divergencia se juzga sobre la ventana, no contra el paso anterior
+    int posicion = iteracion % VENTANA_CONVERGENCIA;
+    if (!isfinite(error) || error > c->errores[posicion])
+    {
+        *estado = SOLVER_DIVERGE;
+        return 1;
+    }
+    if (iteracion > 2 * VENTANA_CONVERGENCIA)
+    {
+        double factor = pow(error / c->errores[posicion], 1.0 / VENTANA_CONVERGENCIA);
+        double restantes = (factor < 1.0) ? log(param->tolerancia / error) / log(factor) : INFINITY;
+        if (iteracion + restantes > param->max_iter)
+        {
+            *estado = SOLVER_MAX_ITER;
+            return 1;
+        }
+    }
+    c->errores[posicion] = error;
+
+    if (iteracion >= param->max_iter)
+    {
+        *estado = SOLVER_MAX_ITER;
+        return 1;
+    }
+    return 0;
+}
+
+EstadoSolver eliminacionGaussDensa(MatrizDensa *A, double *b, double *x, double *det)
+{
+    int n = A->filas;
+    double determinante = 1.0;
+
+    // Eliminación hacia adelante con pivoteo parcial
+    for (int i = 0; i < n - 1; i++)
+    {
+        // Buscar el mayor |A[l][i]| para l >= i (columna: paso = stride)
+        int pivote_fila = i + indiceMaximoAbsSimd(&MD(A, i, i), n - i, A->stride);
+        double maximo = fabs(MD(A, pivote_fila, i));
+
+        if (maximo == 0.0)
+        {
+            if (det != NULL)
+                *det = 0.0;
+            return SOLVER_SINGULAR;
+        }
+
+        // Intercambiar filas: ambas son tramos contiguos de memoria
+        if (pivote_fila != i)
+        {
+            double *fila_i = filaMatrizDensa(A, i);
+            double *fila_p = filaMatrizDensa(A, pivote_fila);
+            for (int m = i; m < n; m++)
+            {
+                double aux = fila_i[m];
+                fila_i[m] = fila_p[m];
+                fila_p[m] = aux;
+            }
+            double aux = b[pivote_fila];
+            b[pivote_fila] = b[i];
+            b[i] = aux;
+            determinante = -determinante;
+        }
+
+        const double *fila_pivote = filaMatrizDensa(A, i);
+        for (int j = i + 1; j < n; j++)
+        {
+            double *fila_j = filaMatrizDensa(A, j);
+            double factor = -fila_j[i] / fila_pivote[i];
+            if (factor == 0.0)
+                continue;
+
+            axpySimd(fila_j + i, fila_pivote + i, factor, n - i);
+            b[j] += factor * b[i];
+        }
+    }
+
+    for (int i = 0; i < n; i++)
+        determinante *= MD(A, i, i);
+    if (det != NULL)
+        *det = determinante;
+
+    if (MD(A, n - 1, n - 1) == 0.0)
+        return SOLVER_SINGULAR;
+
+    // Retrosustitución
+    for (int i = n - 1; i >= 0; i--)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        double suma = b[i] - productoEscalarSimd(fila + i + 1, x + i + 1, n - i - 1);
+        x[i] = suma / fila[i];
+    }
+
+    return SOLVER_OK;
+}
+
+EstadoSolver jacobiDensa(const MatrizDensa *A, const double *b, double *x,
+                         const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    double *x_nuevo = (double *)malloc((size_t)A->filas * sizeof(double));
+    if (x_nuevo == NULL)
+        return SOLVER_ERROR_MEMORIA;
+
+    EstadoSolver estado = jacobiDensaSinReserva(A, b, x, x_nuevo, param, res);
+    free(x_nuevo);
+    return estado;
+}
+
+EstadoSolver jacobiDensaSinReserva(const MatrizDensa *A, const double *b, double *x, double *x_nuevo,
+                                   const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    int n = A->filas;
+
+    for (int i = 0; i < n; i++)
+        if (MD(A, i, i) == 0.0)
+            return SOLVER_SINGULAR;
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            // Producto escalar completo de la fila (sin ramas) y luego se quita la diagonal
+            const double *fila = filaMatrizDensa(A, i);
+            double suma = 0.0;
+            for (int j = 0; j < n; j++)
+                suma += fila[j] * x[j];
+            suma -= fila[i] * x[i];
+            x_nuevo[i] = (b[i] - suma) / fila[i];
+        }
+
+        error = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double d = x_nuevo[i] - x[i];
+            error += d * d;
+            x[i] = x_nuevo[i];
+        }
+        error = sqrt(error);
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+    return estado;
+}
+
+EstadoSolver gaussSeidelDensa(const MatrizDensa *A, const double *b, double *x,
+                              const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    int n = A->filas;
+    double omega = param->omega;
+
+    if (omega <= 0.0 || omega >= 2.0)
+        omega = 1.0;
+
+    for (int i = 0; i < n; i++)
+        if (MD(A, i, i) == 0.0)
+            return SOLVER_SINGULAR;
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    // Gauss-Seidel actualiza x en el lugar: x[j] para j < i ya contiene la iteración
+    // nueva, por lo que no hacen falta los vectores x_nuevo/x_viejo.
+    while (iteracion < param->max_iter)
+    {
+        error = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            const double *fila = filaMatrizDensa(A, i);
+            double suma = 0.0;
+            for (int j = 0; j < n; j++)
+                suma += fila[j] * x[j];
+            suma -= fila[i] * x[i];
+
+            double x_gs = (b[i] - suma) / fila[i];
+            double x_relajado = omega * x_gs + (1.0 - omega) * x[i];
+            double d = x_relajado - x[i];
+            error += d * d;
+            x[i] = x_relajado;
+        }
+        error = sqrt(error);
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+    return estado;
+}
@@ -0,0 +1,223 @@
+/**
+ * @file matriz_densa.h
+ * @brief Matriz densa contigua (row-major, alineada a 64 bytes) y versiones de los
+ *        solvers clásicos que trabajan sobre ella.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * A diferencia de la representación double** (una llamada a malloc por fila),
+ * todos los elementos viven en un único bloque de memoria. La fila i comienza en
+ * datos + i*stride, donde stride (>= columnas) se redondea a un múltiplo de 8
+ * doubles para que cada fila empiece en una línea de caché de 64 bytes.
+ */
+#ifndef MATRIZ_DENSA_H
+#define MATRIZ_DENSA_H
+
+#include <stddef.h>
+
+#define ALINEACION_MATRIZ 64 // Bytes (una línea de caché)
+
+/**
+ * @brief Códigos de retorno comunes a los solvers de la librería.
+ */
+typedef enum
+{
+    SOLVER_OK = 0,          // El sistema se resolvió (o el método convergió)
+    SOLVER_ERROR_MEMORIA,   // No se pudo reservar memoria
+    SOLVER_SINGULAR,        // Pivote (o diagonal) nulo: no hay solución única
+    SOLVER_DIVERGE,         // El error entre iteraciones comenzó a crecer
+    SOLVER_MAX_ITER         // Se alcanzó (o no alcanzaría) el máximo de iteraciones sin converger
+} EstadoSolver;
+
+/**
+ * @brief Matriz densa almacenada por filas en un bloque contiguo.
+ */
+typedef struct
+{
+    int filas;      // Número de filas
+    int columnas;   // Número de columnas
+    int stride;     // Distancia (en doubles) entre el inicio de dos filas consecutivas
+    double *datos;  // Bloque contiguo alineado a ALINEACION_MATRIZ bytes
+} MatrizDensa;
+
+/**
+ * @brief Parámetros de entrada de los métodos iterativos.
+ */
+typedef struct
+{
+    double tolerancia;  // Criterio de parada sobre ||x_nuevo - x_viejo||_2
+    int max_iter;       // Número máximo de iteraciones
+    double omega;       // Factor de relajación (sólo Gauss-Seidel/SOR, 0 < omega < 2)
+} ParametrosIterativos;
+
+/**
+ * @brief Resultado de un método iterativo.
+ */
+typedef struct
+{
+    int iteraciones;    // Iteraciones realizadas
+    double error;       // Error de la última iteración
+} ResultadoIterativo;
+
+/**
+ * @brief Iteraciones que se usan para estimar la velocidad de convergencia.
+ */
+#define VENTANA_CONVERGENCIA 10
+
+/**
+ * @brief Historia reciente del error de un método iterativo.
+ * @details Lo usan todos los solvers iterativos de la librería para decidir
+ *          cuándo detenerse (ver controlarConvergencia()).
+ */
+typedef struct
+{
+    double errores[VENTANA_CONVERGENCIA];   // Últimos errores (buffer circular por iteración)
+} ControlConvergencia;
+
+/**
+ * @brief Prepara el control antes de la primera iteración.
+ */
+void iniciarControlConvergencia(ControlConvergencia *c);
+
+/**
+ * @brief Decide si un método iterativo debe detenerse tras la iteración dada.
+ * @details Criterios, en este orden:
+ *
+ *            - error <= tolerancia: SOLVER_OK.
+ *            - error mayor que el de VENTANA_CONVERGENCIA iteraciones atrás, o no
+ *              finito: SOLVER_DIVERGE. No se compara con la iteración anterior:
+ *              el error de un paso puede crecer aunque el método converja.
+ *            - A partir de 2*VENTANA_CONVERGENCIA iteraciones se estima el factor de
+ *              reducción por iteración ρ = (e_k / e_{k-V})^(1/V). Si con ese ritmo
+ *              harían falta más de max_iter iteraciones en total para llegar a la
+ *              tolerancia (o ρ = 1: el error está estancado) se detiene ya con
+ *              SOLVER_MAX_ITER, en lugar de agotar las iteraciones restantes.
+ *            - iteracion >= max_iter: SOLVER_MAX_ITER.
+ *
+ * @param c Control iniciado con iniciarControlConvergencia().
+ * @param error Error de la iteración que acaba de terminar.
+ * @param iteracion Iteraciones realizadas (contando la actual, desde 1).
+ * @param param Tolerancia y máximo de iteraciones.
+ * @param estado Motivo de la parada (salida, sólo si se devuelve 1).
+ * @return 1 si el método debe detenerse, 0 si debe seguir iterando.
+ */
+int controlarConvergencia(ControlConvergencia *c, double error, int iteracion,
+                          const ParametrosIterativos *param, EstadoSolver *estado);
+
+/** @brief Acceso al elemento (i, j) de una MatrizDensa (puntero). */
+#define MD(M, i, j) ((M)->datos[(size_t)(i) * (size_t)(M)->stride + (size_t)(j)])
+
+/**
+ * @brief Devuelve un puntero al inicio de la fila i.
+ */
+static inline double *filaMatrizDensa(const MatrizDensa *M, int i)
+{
+    return M->datos + (size_t)i * (size_t)M->stride;
+}
+
+/**
+ * @brief Reserva bytes de memoria alineada a ALINEACION_MATRIZ (liberar con liberarAlineado).
+ * @return Puntero a la memoria, o NULL si no se pudo reservar.
+ */
+void *reservarAlineado(size_t bytes);
+
+/**
+ * @brief Libera memoria obtenida con reservarAlineado().
+ */
+void liberarAlineado(void *p);
+
+/**
+ * @brief Reserva una matriz de filas x columnas inicializada en cero.
+ * @param M Matriz a inicializar (salida).
+ * @param filas Número de filas.
+ * @param columnas Número de columnas.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o tamaño inválido.
+ */
+int crearMatrizDensa(MatrizDensa *M, int filas, int columnas);
+
+/**
+ * @brief Libera la memoria de la matriz y deja sus campos en cero.
+ * @param M Matriz a liberar.
+ */
+void liberarMatrizDensa(MatrizDensa *M);
+
+/**
+ * @brief Crea en destino una copia independiente de origen.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+int copiarMatrizDensa(MatrizDensa *destino, const MatrizDensa *origen);
+
+/**
+ * @brief Convierte una matriz double** (filas separadas) a una MatrizDensa.
+ * @param M Matriz destino (se reserva dentro de la función).
+ * @param A Matriz de origen, de tamaño filas x columnas.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+int matrizDensaDesdePunteros(MatrizDensa *M, double **A, int filas, int columnas);
+
+/**
+ * @brief Calcula y = M*x.
+ */
+void productoMatrizVector(const MatrizDensa *M, const double *x, double *y);
+
+/**
+ * @brief Norma 1 de M: máx_j Σ_i |m_ij| (mayor suma de columna en valor absoluto).
+ * @details Recorre M por filas acumulando las n sumas de columna a la vez.
+ * @return La norma, o -1 si no se pudo reservar el vector de sumas.
+ */
+double normaUnoMatrizDensa(const MatrizDensa *M);
+
+/**
+ * @brief Devuelve el nombre de un EstadoSolver ("OK", "SINGULAR", ...) para informes.
+ */
+const char *nombreEstadoSolver(EstadoSolver estado);
+
+/**
+ * @brief Eliminación de Gauss con pivoteo parcial sobre una MatrizDensa.
+ * @details Versión no interactiva de eliminacionGauss(): no imprime nada y no
+ *          termina el programa ante un error, sino que lo informa por el valor
+ *          de retorno. Siempre realiza pivoteo parcial (busca el máximo |a_ki|).
+ * @param A Matriz n x n (se transforma en triangular superior).
+ * @param b Vector de términos independientes (se modifica).
+ * @param x Vector solución (salida, n elementos).
+ * @param det Si no es NULL, recibe el determinante de A.
+ * @return SOLVER_OK o SOLVER_SINGULAR.
+ */
+EstadoSolver eliminacionGaussDensa(MatrizDensa *A, double *b, double *x, double *det);
+
+/**
+ * @brief Método de Jacobi sobre una MatrizDensa.
+ * @details Versión no interactiva de jacobi(). x se usa como aproximación inicial
+ *          y al terminar contiene la última iteración calculada. El criterio de
+ *          parada es el de controlarConvergencia().
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes.
+ * @param x Aproximación inicial / solución (entrada/salida).
+ * @param param Tolerancia y máximo de iteraciones.
+ * @param res Si no es NULL, recibe iteraciones y error final.
+ * @return SOLVER_OK, SOLVER_SINGULAR (diagonal nula), SOLVER_DIVERGE,
+ *         SOLVER_MAX_ITER o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver jacobiDensa(const MatrizDensa *A, const double *b, double *x,
+                         const ParametrosIterativos *param, ResultadoIterativo *res);
+
+/**
+ * @brief Igual que jacobiDensa(), pero con el vector de trabajo provisto por quien llama.
+ * @details Para resolver muchos sistemas sin reservar memoria en cada llamada
+ *          (ver EspacioTrabajo).
+ * @param x_nuevo Vector de trabajo de n elementos (su contenido se pierde).
+ * @return Los mismos códigos que jacobiDensa(), salvo SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver jacobiDensaSinReserva(const MatrizDensa *A, const double *b, double *x, double *x_nuevo,
+                                   const ParametrosIterativos *param, ResultadoIterativo *res);
+
+/**
+ * @brief Método de Gauss-Seidel con relajación (SOR) sobre una MatrizDensa.
+ * @details Versión no interactiva de gaussSeidel(). Usa param->omega como factor
+ *          de relajación (omega = 1 es Gauss-Seidel estándar).
+ * @return Los mismos códigos que jacobiDensa().
+ */
+EstadoSolver gaussSeidelDensa(const MatrizDensa *A, const double *b, double *x,
+                              const ParametrosIterativos *param, ResultadoIterativo *res);
+
+#endif // MATRIZ_DENSA_H
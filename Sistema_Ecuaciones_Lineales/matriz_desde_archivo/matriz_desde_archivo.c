@@ -1,29 +1,209 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
 #include "matriz_desde_archivo.h"
 
-int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *n)
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define MAGIA_BINARIO "SELBIN01"
+#define ORDEN_BYTES_BINARIO 0x01020304
+
+/**
+ * @brief Encabezado de 64 bytes del formato binario.
+ */
+typedef struct
 {
-    FILE *file = fopen(filename, "r");
-    if (file == NULL) {
-        printf("[ERROR] No se pudo abrir el archivo\n");
+    char magia[8];          // "SELBIN01"
+    int32_t orden_bytes;    // ORDEN_BYTES_BINARIO, para detectar otra arquitectura
+    int32_t n;              // Tamaño del sistema
+    int32_t stride;         // Elementos por fila de A en el archivo
+    int32_t reservado[11];
+} EncabezadoBinario;
+
+/**
+ * @brief Bytes del bloque con que se lee un archivo de texto.
+ */
+#define TAM_BLOQUE_LECTURA 16384
+
+/**
+ * @brief Caracteres como máximo de un número del archivo de texto.
+ */
+#define TAM_MAX_NUMERO 64
+
+/**
+ * @brief Lee un archivo de texto de a bloques de tamaño fijo.
+ * @details Sólo se guarda en memoria el bloque actual, no el archivo completo.
+ */
+typedef struct
+{
+    FILE *archivo;
+    char bloque[TAM_BLOQUE_LECTURA];
+    size_t pos;     // Próximo carácter del bloque
+    size_t largo;   // Caracteres válidos del bloque
+} LectorTexto;
+
+/**
+ * @brief Devuelve el próximo carácter sin consumirlo, o EOF al final del archivo.
+ */
+static int mirarCaracter(LectorTexto *L)
+{
+    if (L->pos == L->largo) {
+        L->largo = fread(L->bloque, 1, TAM_BLOQUE_LECTURA, L->archivo);
+        L->pos = 0;
+        if (L->largo == 0)
+            return EOF;
+    }
+    return (unsigned char)L->bloque[L->pos];
+}
+
+static int esBlanco(int c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+/**
+ * @brief Lee el próximo número del archivo, salteando los blancos y fines de línea previos.
+ * @return 0 si se leyó un número, -1 al final del archivo, 1 si hay un valor inválido.
+ */
+static int leerNumero(LectorTexto *L, double *valor)
+{
+    int c;
+    while ((c = mirarCaracter(L)) != EOF && esBlanco(c))
+        L->pos++;
+    if (c == EOF)
+        return -1;
+
+    // El número puede quedar partido entre dos bloques: se copia hasta el próximo blanco
+    char texto[TAM_MAX_NUMERO];
+    size_t largo = 0;
+    while ((c = mirarCaracter(L)) != EOF && !esBlanco(c)) {
+        if (largo == TAM_MAX_NUMERO - 1)
+            return 1;
+        texto[largo++] = (char)c;
+        L->pos++;
+    }
+    texto[largo] = '\0';
+
+    char *fin;
+    *valor = strtod(texto, &fin);
+    return *fin == '\0' ? 0 : 1;
+}
+
+/**
+ * @brief Lee cantidad números consecutivos (en cualquier cantidad de líneas).
+ * @return 0 si todo salió bien, 1 si faltan números o hay un valor inválido.
+ */
+static int parsearValores(LectorTexto *L, double *destino, int cantidad)
+{
+    for (int k = 0; k < cantidad; k++)
+        if (leerNumero(L, &destino[k]) != 0)
+            return 1;
+    return 0;
+}
+
+/**
+ * @brief Abre el archivo y lee su primera línea no vacía, de la que se deduce n.
+ * @param primera Valores de la primera fila (n coeficientes y b[0]), reservados con malloc.
+ * @return 0 si todo salió bien, 1 si hubo error (el archivo queda cerrado).
+ */
+static int prepararLecturaTexto(const char *archivo, LectorTexto *L, int *n, double **primera)
+{
+    L->archivo = fopen(archivo, "r");
+    L->pos = L->largo = 0;
+    if (L->archivo == NULL) {
+        fprintf(stderr, "[ERROR] No se pudo abrir el archivo\n");
         return 1;
     }
 
-    // Contar el número de filas (n)
-    *n = 0;
-    char line[1024];
-    while (fgets(line, sizeof(line), file)) {
-        (*n)++;
+    int capacidad = 16, columnas = 0, invalido = 0;
+    *primera = (double *)malloc(capacidad * sizeof(double));
+    while (*primera != NULL) {
+        double valor;
+        int resultado = leerNumero(L, &valor);
+        if (resultado != 0) {
+            invalido = resultado == 1;
+            break;
+        }
+        if (columnas == capacidad) {
+            double *mayor = (double *)realloc(*primera, 2 * capacidad * sizeof(double));
+            if (mayor == NULL) {
+                free(*primera);
+                *primera = NULL;
+                break;
+            }
+            *primera = mayor;
+            capacidad *= 2;
+        }
+        (*primera)[columnas++] = valor;
+
+        // Los blancos hasta el próximo número dicen si la primera fila terminó
+        int c;
+        while ((c = mirarCaracter(L)) == ' ' || c == '\t' || c == '\r')
+            L->pos++;
+        if (c == '\n' || c == EOF)
+            break;
     }
-    rewind(file);
+    if (*primera == NULL) {
+        fprintf(stderr, "[ERROR] Error de memoria\n");
+        fclose(L->archivo);
+        return 1;
+    }
+    if (invalido || columnas < 2) {
+        fprintf(stderr, "[ERROR] La primera fila del archivo debe tener n coeficientes y el término independiente\n");
+        free(*primera);
+        fclose(L->archivo);
+        return 1;
+    }
+    *n = columnas - 1;
+    return 0;
+}
+
+static void mostrarFila(const double *fila, double bi, int n)
+{
+    for (int j = 0; j < n && j < MAX_FILAS_ECO; j++)
+        printf("%8.3lf ", fila[j]);
+    if (n > MAX_FILAS_ECO)
+        printf("   ...   ");
+    printf("| %8.3lf\n", bi);
+}
+
+static void mostrarEncabezadoEco(int n)
+{
+    printf("\n--------------------------------------------------\n");
+    printf("Se obtuvo el siguiente sistema de ecuaciones del archivo:\n");
+    printf("n = %d\n", n);
+    printf("Matriz A y vector b:\n");
+}
+
+static void mostrarPieEco(int n)
+{
+    if (n > MAX_FILAS_ECO)
+        printf("... (%d filas más)\n", n - MAX_FILAS_ECO);
+    printf("--------------------------------------------------\n");
+}
+
+int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *n, int verbose)
+{
+    LectorTexto L;
+    double *primera;
+    if (prepararLecturaTexto(filename, &L, n, &primera) != 0)
+        return 1;
 
     // Crear matriz A y vector b
-    *A = (double **)malloc((*n) * sizeof(double *));
+    *A = (double **)calloc((*n), sizeof(double *));
     *b = (double *)malloc((*n) * sizeof(double));
     if (!(*A) || !(*b)) {
-        printf("[ERROR] Error de memoria\n");
-        fclose(file);
+        fprintf(stderr, "[ERROR] Error de memoria\n");
+        free(*A);
+        free(*b);
+        free(primera);
+        fclose(L.archivo);
         return 1;
     }
 
@@ -31,28 +211,32 @@ int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *
     for (int i = 0; i < *n; i++) {
         (*A)[i] = (double *)malloc((*n) * sizeof(double));
         if (!(*A)[i]) {
-            printf("[ERROR] Error de memoria\n");
-            fclose(file);
+            fprintf(stderr, "[ERROR] Error de memoria\n");
+            liberarMemoria(*A, *b, *n);
+            free(primera);
+            fclose(L.archivo);
             return 1;
         }
-        for (int j = 0; j < *n; j++) {
-            fscanf(file, "%lf", &((*A)[i][j]));
+        if (i == 0) {
+            memcpy((*A)[0], primera, (*n) * sizeof(double));
+            (*b)[0] = primera[*n];
+        } else if (parsearValores(&L, (*A)[i], *n) != 0 || parsearValores(&L, &(*b)[i], 1) != 0) {
+            fprintf(stderr, "[ERROR] Faltan valores o hay un valor inválido en la fila %d\n", i + 1);
+            liberarMemoria(*A, *b, *n);
+            free(primera);
+            fclose(L.archivo);
+            return 1;
         }
-        fscanf(file, "%lf", &((*b)[i]));
     }
-    fclose(file);
+    free(primera);
+    fclose(L.archivo);
 
-    // Imprimir para control
-    printf("\n--------------------------------------------------\n");
-    printf("Se obtuvo el siguiente sistema de ecuaciones del archivo:\n");
-    printf("n = %d\n", *n);
-    printf("Matriz A y vector b:\n");
-    for (int i = 0; i < *n; i++) {
-        for (int j = 0; j < *n; j++)
-            printf("%8.3lf ", (*A)[i][j]);
-        printf("| %8.3lf\n", (*b)[i]);
+    if (verbose) {
+        mostrarEncabezadoEco(*n);
+        for (int i = 0; i < *n && i < MAX_FILAS_ECO; i++)
+            mostrarFila((*A)[i], (*b)[i], *n);
+        mostrarPieEco(*n);
     }
-    printf("--------------------------------------------------\n");
 
     return 0;
 }
@@ -64,4 +248,181 @@ void liberarMemoria(double **A, double *b, int n)
     }
     free(A);
     free(b);
-}
\ No newline at end of file
+}
+
+int leerSistemaTexto(const char *archivo, MatrizDensa *A, double **b, int verbose)
+{
+    int n;
+    LectorTexto L;
+    double *primera;
+    if (prepararLecturaTexto(archivo, &L, &n, &primera) != 0)
+        return 1;
+
+    *b = (double *)malloc(n * sizeof(double));
+    if (*b == NULL || crearMatrizDensa(A, n, n) != 0) {
+        fprintf(stderr, "[ERROR] Error de memoria\n");
+        free(*b);
+        free(primera);
+        fclose(L.archivo);
+        return 1;
+    }
+
+    memcpy(filaMatrizDensa(A, 0), primera, n * sizeof(double));
+    (*b)[0] = primera[n];
+    free(primera);
+    for (int i = 1; i < n; i++) {
+        if (parsearValores(&L, filaMatrizDensa(A, i), n) != 0 || parsearValores(&L, &(*b)[i], 1) != 0) {
+            fprintf(stderr, "[ERROR] Faltan valores o hay un valor inválido en la fila %d\n", i + 1);
+            liberarMatrizDensa(A);
+            free(*b);
+            fclose(L.archivo);
+            return 1;
+        }
+    }
+    fclose(L.archivo);
+
+    if (verbose) {
+        mostrarEncabezadoEco(n);
+        for (int i = 0; i < n && i < MAX_FILAS_ECO; i++)
+            mostrarFila(filaMatrizDensa(A, i), (*b)[i], n);
+        mostrarPieEco(n);
+    }
+
+    return 0;
+}
+
+int guardarSistemaBinario(const char *archivo, const MatrizDensa *A, const double *b)
+{
+    FILE *file = fopen(archivo, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "[ERROR] No se pudo crear el archivo\n");
+        return 1;
+    }
+
+    EncabezadoBinario encabezado;
+    memset(&encabezado, 0, sizeof(encabezado));
+    memcpy(encabezado.magia, MAGIA_BINARIO, 8);
+    encabezado.orden_bytes = ORDEN_BYTES_BINARIO;
+    encabezado.n = A->filas;
+    encabezado.stride = A->stride;
+
+    size_t elementos = (size_t)A->filas * A->stride;
+    int ok = fwrite(&encabezado, sizeof(encabezado), 1, file) == 1 &&
+             fwrite(A->datos, sizeof(double), elementos, file) == elementos &&
+             fwrite(b, sizeof(double), (size_t)A->filas, file) == (size_t)A->filas;
+    if (fclose(file) != 0)
+        ok = 0;
+    if (!ok) {
+        fprintf(stderr, "[ERROR] No se pudo escribir el archivo\n");
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Verifica el encabezado y que el tamaño del archivo coincida con n y stride.
+ */
+static int validarEncabezado(const EncabezadoBinario *encabezado, size_t largo_archivo)
+{
+    if (memcmp(encabezado->magia, MAGIA_BINARIO, 8) != 0) {
+        fprintf(stderr, "[ERROR] El archivo no es un sistema binario\n");
+        return 1;
+    }
+    if (encabezado->orden_bytes != ORDEN_BYTES_BINARIO) {
+        fprintf(stderr, "[ERROR] El archivo fue escrito en una máquina con otro orden de bytes\n");
+        return 1;
+    }
+    if (encabezado->n <= 0 || encabezado->stride < encabezado->n) {
+        fprintf(stderr, "[ERROR] Encabezado del sistema binario inválido\n");
+        return 1;
+    }
+    size_t esperado = sizeof(EncabezadoBinario) +
+                      ((size_t)encabezado->n * encabezado->stride + encabezado->n) * sizeof(double);
+    if (largo_archivo != esperado) {
+        fprintf(stderr, "[ERROR] El archivo binario está incompleto o tiene datos de más\n");
+        return 1;
+    }
+    return 0;
+}
+
+static void asignarSistemaBinario(SistemaBinario *S, const EncabezadoBinario *encabezado, double *datos)
+{
+    S->n = encabezado->n;
+    S->A.filas = encabezado->n;
+    S->A.columnas = encabezado->n;
+    S->A.stride = encabezado->stride;
+    S->A.datos = datos;
+    S->b = datos + (size_t)encabezado->n * encabezado->stride;
+}
+
+int mapearSistemaBinario(const char *archivo, SistemaBinario *S)
+{
+    memset(S, 0, sizeof(SistemaBinario));
+    EncabezadoBinario encabezado;
+
+#ifndef _WIN32
+    int fd = open(archivo, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "[ERROR] No se pudo abrir el archivo\n");
+        return 1;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(encabezado) ||
+        read(fd, &encabezado, sizeof(encabezado)) != (ssize_t)sizeof(encabezado)) {
+        fprintf(stderr, "[ERROR] No se pudo leer el encabezado del archivo\n");
+        close(fd);
+        return 1;
+    }
+    if (validarEncabezado(&encabezado, (size_t)info.st_size) != 0) {
+        close(fd);
+        return 1;
+    }
+
+    void *mapa = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);      // El mapeo sigue siendo válido sin el descriptor
+    if (mapa == MAP_FAILED) {
+        fprintf(stderr, "[ERROR] No se pudo mapear el archivo en memoria\n");
+        return 1;
+    }
+    S->mapa = mapa;
+    S->largo_mapa = (size_t)info.st_size;
+    asignarSistemaBinario(S, &encabezado, (double *)((char *)mapa + sizeof(EncabezadoBinario)));
+    return 0;
+#else
+    FILE *file = fopen(archivo, "rb");
+    if (file == NULL) {
+        fprintf(stderr, "[ERROR] No se pudo abrir el archivo\n");
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long largo = ftell(file);
+    rewind(file);
+    if (largo < (long)sizeof(encabezado) || fread(&encabezado, sizeof(encabezado), 1, file) != 1 ||
+        validarEncabezado(&encabezado, (size_t)largo) != 0) {
+        fclose(file);
+        return 1;
+    }
+    size_t elementos = (size_t)encabezado.n * encabezado.stride + encabezado.n;
+    double *datos = (double *)malloc(elementos * sizeof(double));
+    if (datos == NULL || fread(datos, sizeof(double), elementos, file) != elementos) {
+        fprintf(stderr, "[ERROR] No se pudo leer el archivo\n");
+        free(datos);
+        fclose(file);
+        return 1;
+    }
+    fclose(file);
+    asignarSistemaBinario(S, &encabezado, datos);
+    return 0;
+#endif
+}
+
+void liberarSistemaBinario(SistemaBinario *S)
+{
+#ifndef _WIN32
+    if (S->mapa != NULL)
+        munmap(S->mapa, S->largo_mapa);
+#else
+    free(S->A.datos);
+#endif
+    memset(S, 0, sizeof(SistemaBinario));
+}
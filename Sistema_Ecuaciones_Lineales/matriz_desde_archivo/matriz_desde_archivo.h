@@ -1,17 +1,28 @@
 #ifndef MATRIZ_DESDE_ARCHIVO_H
 #define MATRIZ_DESDE_ARCHIVO_H
 
+#include <stddef.h>
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Filas del sistema que se muestran como máximo al imprimirlo para control.
+ */
+#define MAX_FILAS_ECO 10
+
 /**
  * @brief Lee un sistema de ecuaciones lineales desde un archivo.
  * @param filename Nombre del archivo.
  * @param A Puntero a la matriz A (salida).
  * @param b Puntero al vector b (salida).
  * @param n Puntero al tamaño del sistema (salida).
+ * @param verbose Si es distinto de 0 imprime el sistema leído para control
+ *        (sólo las primeras MAX_FILAS_ECO filas si es más grande).
  * @return 0 si todo salió bien, 1 si hubo error.
  *
  * El archivo debe tener n filas, cada una con n coeficientes y el término independiente.
+ * El archivo se recorre una sola vez, de a bloques de tamaño fijo.
  */
-int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *n);
+int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *n, int verbose);
 
 /**
  * @brief Libera la memoria reservada para la matriz y el vector.
@@ -21,4 +32,59 @@ int leerSistemaDesdeArchivo(const char *filename, double ***A, double **b, int *
  */
 void liberarMemoria(double **A, double *b, int n);
 
-#endif // MATRIZ_DESDE_ARCHIVO_H
\ No newline at end of file
+/**
+ * @brief Lee un sistema en formato de texto (el mismo de leerSistemaDesdeArchivo) en una MatrizDensa.
+ * @details El archivo se recorre una sola vez de a bloques de tamaño fijo, sin
+ *          cargarlo entero en memoria: n se deduce de la cantidad de números de la
+ *          primera fila (n coeficientes + término independiente) y los n(n+1)
+ *          valores se leen sin importar cómo estén repartidos en líneas, así que
+ *          no hay límite de largo de línea.
+ * @param archivo Ruta del archivo.
+ * @param A Matriz n x n (salida, creada aquí).
+ * @param b Vector de n términos independientes (salida, reservado con malloc).
+ * @param verbose Si es distinto de 0 imprime el sistema leído para control.
+ * @return 0 si todo salió bien, 1 si hubo error (el motivo se informa con [ERROR]).
+ */
+int leerSistemaTexto(const char *archivo, MatrizDensa *A, double **b, int verbose);
+
+/**
+ * @brief Sistema cargado desde un archivo binario.
+ * @details Si se obtuvo con mapearSistemaBinario(), A.datos y b apuntan dentro
+ *          del archivo mapeado en memoria; liberarSistemaBinario() lo desmapea.
+ */
+typedef struct
+{
+    MatrizDensa A;      // Matriz n x n (no liberar con liberarMatrizDensa)
+    double *b;          // Vector de n términos independientes
+    int n;              // Tamaño del sistema
+    void *mapa;         // Región mapeada (NULL si los datos se copiaron a memoria propia)
+    size_t largo_mapa;  // Bytes mapeados
+} SistemaBinario;
+
+/**
+ * @brief Guarda un sistema en formato binario.
+ * @details Formato: un encabezado de 64 bytes ("SELBIN01", marca de orden de
+ *          bytes, n y stride), luego las n filas de A con el mismo stride de la
+ *          MatrizDensa (en double, orden de bytes de la máquina) y por último b.
+ *          Como el encabezado ocupa 64 bytes y el mapeo empieza en un límite de
+ *          página, las filas quedan alineadas igual que en crearMatrizDensa().
+ * @return 0 si todo salió bien, 1 si hubo error.
+ */
+int guardarSistemaBinario(const char *archivo, const MatrizDensa *A, const double *b);
+
+/**
+ * @brief Carga un sistema binario mapeando el archivo en memoria, sin copiarlo.
+ * @details Las páginas se leen del disco recién cuando se usan. El mapeo es
+ *          privado: los solvers que modifican A o b (eliminacionGaussDensa) lo
+ *          pueden hacer sin alterar el archivo. Donde no hay mmap (Windows) los
+ *          datos se leen con fread.
+ * @return 0 si todo salió bien, 1 si hubo error.
+ */
+int mapearSistemaBinario(const char *archivo, SistemaBinario *S);
+
+/**
+ * @brief Libera (o desmapea) un sistema cargado con mapearSistemaBinario().
+ */
+void liberarSistemaBinario(SistemaBinario *S);
+
+#endif // MATRIZ_DESDE_ARCHIVO_H
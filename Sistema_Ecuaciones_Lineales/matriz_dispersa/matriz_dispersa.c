@@ -0,0 +1,463 @@
+/**
+ * @file matriz_dispersa.c
+ * @brief Implementación de la matriz CSR, el lector Matrix Market y los solvers dispersos.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include "matriz_dispersa.h"
+
+#define LARGO_LINEA_MM 1024
+
+int crearMatrizCSR(MatrizCSR *M, int filas, int columnas, int nnz)
+{
+    M->filas = filas;
+    M->columnas = columnas;
+    M->nnz = 0;
+    M->inicio_fila = (int *)calloc((size_t)filas + 1, sizeof(int));
+    // Se reserva al menos un elemento para que malloc(0) no devuelva NULL
+    M->columna = (int *)malloc((size_t)(nnz > 0 ? nnz : 1) * sizeof(int));
+    M->valor = (double *)malloc((size_t)(nnz > 0 ? nnz : 1) * sizeof(double));
+
+    if (M->inicio_fila == NULL || M->columna == NULL || M->valor == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para la matriz dispersa.\n");
+        liberarMatrizCSR(M);
+        return 1;
+    }
+    return 0;
+}
+
+void liberarMatrizCSR(MatrizCSR *M)
+{
+    if (M == NULL)
+        return;
+    free(M->inicio_fila);
+    free(M->columna);
+    free(M->valor);
+    M->inicio_fila = NULL;
+    M->columna = NULL;
+    M->valor = NULL;
+    M->filas = 0;
+    M->columnas = 0;
+    M->nnz = 0;
+}
+
+int csrDesdeTripletas(MatrizCSR *M, int filas, int columnas, int cantidad,
+                      const int *fila, const int *columna, const double *valor)
+{
+    for (int k = 0; k < cantidad; k++)
+    {
+        if (fila[k] < 0 || fila[k] >= filas || columna[k] < 0 || columna[k] >= columnas)
+        {
+            fprintf(stderr, "[ERROR] Elemento (%d, %d) fuera de la matriz %dx%d.\n",
+                    fila[k], columna[k], filas, columnas);
+            return 1;
+        }
+    }
+
+    if (crearMatrizCSR(M, filas, columnas, cantidad) != 0)
+        return 1;
+
+    // 1. Contar elementos por fila y acumular para obtener el inicio de cada fila
+    for (int k = 0; k < cantidad; k++)
+        M->inicio_fila[fila[k] + 1]++;
+    for (int i = 0; i < filas; i++)
+        M->inicio_fila[i + 1] += M->inicio_fila[i];
+
+    // 2. Ubicar cada tripleta en su fila
+    int *siguiente = (int *)malloc((size_t)(filas > 0 ? filas : 1) * sizeof(int));
+    if (siguiente == NULL)
+    {
+        liberarMatrizCSR(M);
+        return 1;
+    }
+    memcpy(siguiente, M->inicio_fila, (size_t)filas * sizeof(int));
+    for (int k = 0; k < cantidad; k++)
+    {
+        int destino = siguiente[fila[k]]++;
+        M->columna[destino] = columna[k];
+        M->valor[destino] = valor[k];
+    }
+    free(siguiente);
+
+    // 3. Ordenar las columnas de cada fila (inserción: las filas son cortas),
+    //    sumar repetidos y compactar
+    int escritura = 0;
+    int inicio = 0;
+    for (int i = 0; i < filas; i++)
+    {
+        int fin = M->inicio_fila[i + 1];
+        for (int k = inicio + 1; k < fin; k++)
+        {
+            int c = M->columna[k];
+            double v = M->valor[k];
+            int l = k - 1;
+            while (l >= inicio && M->columna[l] > c)
+            {
+                M->columna[l + 1] = M->columna[l];
+                M->valor[l + 1] = M->valor[l];
+                l--;
+            }
+            M->columna[l + 1] = c;
+            M->valor[l + 1] = v;
+        }
+
+        int inicio_nuevo = escritura;
+        for (int k = inicio; k < fin; k++)
+        {
+            if (escritura > inicio_nuevo && M->columna[escritura - 1] == M->columna[k])
+            {
+                M->valor[escritura - 1] += M->valor[k];
+            }
+            else
+            {
+                M->columna[escritura] = M->columna[k];
+                M->valor[escritura] = M->valor[k];
+                escritura++;
+            }
+        }
+        inicio = fin;
+        M->inicio_fila[i] = inicio_nuevo;
+    }
+    M->inicio_fila[filas] = escritura;
+    M->nnz = escritura;
+
+    return 0;
+}
+
+int csrDesdeDensa(MatrizCSR *M, const MatrizDensa *A)
+{
+    int nnz = 0;
+    for (int i = 0; i < A->filas; i++)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        for (int j = 0; j < A->columnas; j++)
+            if (fila[j] != 0.0)
+                nnz++;
+    }
+
+    if (crearMatrizCSR(M, A->filas, A->columnas, nnz) != 0)
+        return 1;
+
+    int k = 0;
+    for (int i = 0; i < A->filas; i++)
+    {
+        const double *fila = filaMatrizDensa(A, i);
+        M->inicio_fila[i] = k;
+        for (int j = 0; j < A->columnas; j++)
+        {
+            if (fila[j] != 0.0)
+            {
+                M->columna[k] = j;
+                M->valor[k] = fila[j];
+                k++;
+            }
+        }
+    }
+    M->inicio_fila[A->filas] = k;
+    M->nnz = k;
+    return 0;
+}
+
+/* Lee una línea completa; si no entra en el buffer se descarta el resto */
+static int leerLineaMM(FILE *file, char *linea, int largo)
+{
+    if (fgets(linea, largo, file) == NULL)
+        return 0;
+    if (strchr(linea, '\n') == NULL)
+    {
+        int c;
+        while ((c = getc(file)) != EOF && c != '\n')
+            ;
+    }
+    return 1;
+}
+
+int leerMatrixMarket(const char *archivo, MatrizCSR *M)
+{
+    FILE *file = fopen(archivo, "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo abrir el archivo '%s'\n", archivo);
+        return 1;
+    }
+
+    char linea[LARGO_LINEA_MM];
+    char objeto[32], formato[32], tipo[32], simetria[32];
+
+    // Encabezado: %%MatrixMarket matrix coordinate real general
+    if (!leerLineaMM(file, linea, sizeof(linea)) ||
+        sscanf(linea, "%%%%MatrixMarket %31s %31s %31s %31s", objeto, formato, tipo, simetria) != 4)
+    {
+        fprintf(stderr, "[ERROR] '%s' no tiene un encabezado Matrix Market válido.\n", archivo);
+        fclose(file);
+        return 1;
+    }
+    if (strcasecmp(objeto, "matrix") != 0 || strcasecmp(formato, "coordinate") != 0)
+    {
+        fprintf(stderr, "[ERROR] Sólo se admiten matrices Matrix Market en formato 'coordinate'.\n");
+        fclose(file);
+        return 1;
+    }
+
+    int es_pattern = (strcasecmp(tipo, "pattern") == 0);
+    if (!es_pattern && strcasecmp(tipo, "real") != 0 && strcasecmp(tipo, "integer") != 0)
+    {
+        fprintf(stderr, "[ERROR] Tipo Matrix Market no soportado: %s\n", tipo);
+        fclose(file);
+        return 1;
+    }
+
+    int es_simetrica = (strcasecmp(simetria, "symmetric") == 0);
+    int es_antisimetrica = (strcasecmp(simetria, "skew-symmetric") == 0);
+    if (!es_simetrica && !es_antisimetrica && strcasecmp(simetria, "general") != 0)
+    {
+        fprintf(stderr, "[ERROR] Simetría Matrix Market no soportada: %s\n", simetria);
+        fclose(file);
+        return 1;
+    }
+
+    // Saltar comentarios hasta la línea de tamaños
+    int filas = 0, columnas = 0, entradas = 0;
+    do
+    {
+        if (!leerLineaMM(file, linea, sizeof(linea)))
+        {
+            fprintf(stderr, "[ERROR] Falta la línea de tamaños en '%s'.\n", archivo);
+            fclose(file);
+            return 1;
+        }
+    } while (linea[0] == '%' || linea[strspn(linea, " \t\r\n")] == '\0');
+
+    if (sscanf(linea, "%d %d %d", &filas, &columnas, &entradas) != 3 ||
+        filas <= 0 || columnas <= 0 || entradas < 0)
+    {
+        fprintf(stderr, "[ERROR] Línea de tamaños inválida en '%s'.\n", archivo);
+        fclose(file);
+        return 1;
+    }
+
+    // En las matrices simétricas cada entrada fuera de la diagonal cuenta dos veces
+    int capacidad = (es_simetrica || es_antisimetrica) ? 2 * entradas : entradas;
+    int *fi = (int *)malloc((size_t)(capacidad > 0 ? capacidad : 1) * sizeof(int));
+    int *co = (int *)malloc((size_t)(capacidad > 0 ? capacidad : 1) * sizeof(int));
+    double *va = (double *)malloc((size_t)(capacidad > 0 ? capacidad : 1) * sizeof(double));
+    if (fi == NULL || co == NULL || va == NULL)
+    {
+        fprintf(stderr, "[ERROR] Error de memoria\n");
+        free(fi); free(co); free(va);
+        fclose(file);
+        return 1;
+    }
+
+    int cantidad = 0;
+    int leidas = 0;
+    while (leidas < entradas && leerLineaMM(file, linea, sizeof(linea)))
+    {
+        if (linea[0] == '%' || linea[strspn(linea, " \t\r\n")] == '\0')
+            continue;
+
+        char *p = linea;
+        char *fin;
+        long i = strtol(p, &fin, 10);
+        p = fin;
+        long j = strtol(p, &fin, 10);
+        if (fin == p)
+        {
+            fprintf(stderr, "[ERROR] Entrada %d mal formada en '%s'.\n", leidas + 1, archivo);
+            free(fi); free(co); free(va);
+            fclose(file);
+            return 1;
+        }
+        p = fin;
+        double v = 1.0;
+        if (!es_pattern)
+        {
+            v = strtod(p, &fin);
+            if (fin == p)
+            {
+                fprintf(stderr, "[ERROR] Falta el valor de la entrada %d en '%s'.\n", leidas + 1, archivo);
+                free(fi); free(co); free(va);
+                fclose(file);
+                return 1;
+            }
+        }
+
+        fi[cantidad] = (int)i - 1;
+        co[cantidad] = (int)j - 1;
+        va[cantidad] = v;
+        cantidad++;
+
+        if ((es_simetrica || es_antisimetrica) && i != j)
+        {
+            fi[cantidad] = (int)j - 1;
+            co[cantidad] = (int)i - 1;
+            va[cantidad] = es_antisimetrica ? -v : v;
+            cantidad++;
+        }
+        leidas++;
+    }
+    fclose(file);
+
+    if (leidas != entradas)
+    {
+        fprintf(stderr, "[ERROR] Se esperaban %d entradas pero '%s' tiene %d.\n", entradas, archivo, leidas);
+        free(fi); free(co); free(va);
+        return 1;
+    }
+
+    int resultado = csrDesdeTripletas(M, filas, columnas, cantidad, fi, co, va);
+    free(fi);
+    free(co);
+    free(va);
+    return resultado;
+}
+
+void productoCSRVector(const MatrizCSR *A, const double *x, double *y)
+{
+    for (int i = 0; i < A->filas; i++)
+    {
+        double suma = 0.0;
+        for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+            suma += A->valor[k] * x[A->columna[k]];
+        y[i] = suma;
+    }
+}
+
+/* Extrae la diagonal; devuelve 1 si algún elemento diagonal es nulo */
+static int extraerDiagonal(const MatrizCSR *A, double *diagonal)
+{
+    for (int i = 0; i < A->filas; i++)
+    {
+        diagonal[i] = 0.0;
+        for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+            if (A->columna[k] == i)
+                diagonal[i] = A->valor[k];
+        if (diagonal[i] == 0.0)
+            return 1;
+    }
+    return 0;
+}
+
+EstadoSolver jacobiCSR(const MatrizCSR *A, const double *b, double *x,
+                       const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    int n = A->filas;
+    double *diagonal = (double *)malloc((size_t)n * sizeof(double));
+    double *x_nuevo = (double *)malloc((size_t)n * sizeof(double));
+    if (diagonal == NULL || x_nuevo == NULL)
+    {
+        free(diagonal);
+        free(x_nuevo);
+        return SOLVER_ERROR_MEMORIA;
+    }
+    if (extraerDiagonal(A, diagonal) != 0)
+    {
+        free(diagonal);
+        free(x_nuevo);
+        return SOLVER_SINGULAR;
+    }
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            double suma = 0.0;
+            for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+                suma += A->valor[k] * x[A->columna[k]];
+            suma -= diagonal[i] * x[i];
+            x_nuevo[i] = (b[i] - suma) / diagonal[i];
+        }
+
+        error = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double d = x_nuevo[i] - x[i];
+            error += d * d;
+            x[i] = x_nuevo[i];
+        }
+        error = sqrt(error);
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    free(diagonal);
+    free(x_nuevo);
+    return estado;
+}
+
+EstadoSolver gaussSeidelCSR(const MatrizCSR *A, const double *b, double *x,
+                            const ParametrosIterativos *param, ResultadoIterativo *res)
+{
+    int n = A->filas;
+    double omega = param->omega;
+
+    if (omega <= 0.0 || omega >= 2.0)
+        omega = 1.0;
+
+    double *diagonal = (double *)malloc((size_t)n * sizeof(double));
+    if (diagonal == NULL)
+        return SOLVER_ERROR_MEMORIA;
+    if (extraerDiagonal(A, diagonal) != 0)
+    {
+        free(diagonal);
+        return SOLVER_SINGULAR;
+    }
+
+    EstadoSolver estado = SOLVER_MAX_ITER;
+    int iteracion = 0;
+    double error = 0.0;
+    ControlConvergencia control;
+    iniciarControlConvergencia(&control);
+
+    while (iteracion < param->max_iter)
+    {
+        error = 0.0;
+        for (int i = 0; i < n; i++)
+        {
+            double suma = 0.0;
+            for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+                suma += A->valor[k] * x[A->columna[k]];
+            suma -= diagonal[i] * x[i];
+
+            double x_gs = (b[i] - suma) / diagonal[i];
+            double x_relajado = omega * x_gs + (1.0 - omega) * x[i];
+            double d = x_relajado - x[i];
+            error += d * d;
+            x[i] = x_relajado;
+        }
+        error = sqrt(error);
+        iteracion++;
+
+        if (controlarConvergencia(&control, error, iteracion, param, &estado))
+            break;
+    }
+
+    if (res != NULL)
+    {
+        res->iteraciones = iteracion;
+        res->error = error;
+    }
+
+    free(diagonal);
+    return estado;
+}
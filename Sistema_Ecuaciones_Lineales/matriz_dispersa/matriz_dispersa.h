@@ -0,0 +1,97 @@
+/**
+ * @file matriz_dispersa.h
+ * @brief Matriz dispersa en formato CSR (Compressed Sparse Row) y solvers iterativos sobre ella.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Sólo se guardan los elementos no nulos. Para la fila i:
+ *
+ *   columna[k], valor[k]   con   inicio_fila[i] <= k < inicio_fila[i+1]
+ *
+ * y las columnas de cada fila quedan ordenadas de menor a mayor. La memoria es
+ * O(n + nnz) y un producto A*x cuesta O(nnz) en lugar de O(n²).
+ *
+ * Ejemplo: | 4 -1  0 |
+ *          |-1  4 -1 |   inicio_fila = {0, 2, 5, 7}
+ *          | 0 -1  4 |   columna     = {0, 1, 0, 1, 2, 1, 2}
+ *                        valor       = {4,-1,-1, 4,-1,-1, 4}
+ */
+#ifndef MATRIZ_DISPERSA_H
+#define MATRIZ_DISPERSA_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Matriz dispersa en formato CSR.
+ */
+typedef struct
+{
+    int filas;          // Número de filas
+    int columnas;       // Número de columnas
+    int nnz;            // Cantidad de elementos no nulos almacenados
+    int *inicio_fila;   // filas+1 elementos: inicio de cada fila en columna/valor
+    int *columna;       // nnz elementos: columna de cada no nulo
+    double *valor;      // nnz elementos: valor de cada no nulo
+} MatrizCSR;
+
+/**
+ * @brief Reserva una matriz CSR vacía con capacidad para nnz elementos.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+int crearMatrizCSR(MatrizCSR *M, int filas, int columnas, int nnz);
+
+/**
+ * @brief Libera la memoria de la matriz.
+ */
+void liberarMatrizCSR(MatrizCSR *M);
+
+/**
+ * @brief Construye una matriz CSR a partir de tripletas (fila, columna, valor).
+ * @details Las tripletas pueden venir en cualquier orden; las repetidas se suman.
+ *          Los índices son base 0.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o índices fuera de rango.
+ */
+int csrDesdeTripletas(MatrizCSR *M, int filas, int columnas, int cantidad,
+                      const int *fila, const int *columna, const double *valor);
+
+/**
+ * @brief Convierte una MatrizDensa a CSR descartando los ceros.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria.
+ */
+int csrDesdeDensa(MatrizCSR *M, const MatrizDensa *A);
+
+/**
+ * @brief Lee una matriz en formato Matrix Market de coordenadas.
+ * @details Acepta el encabezado "%%MatrixMarket matrix coordinate <tipo> <simetría>"
+ *          con tipo real, integer o pattern (los valores pattern valen 1) y
+ *          simetría general, symmetric o skew-symmetric (en los dos últimos casos
+ *          se completa el triángulo que falta). Los índices del archivo son base 1.
+ * @param archivo Ruta del archivo .mtx.
+ * @param M Matriz leída (salida).
+ * @return 0 si todo salió bien, 1 si hubo error (también si a una entrada le
+ *         falta el valor o el archivo tiene menos entradas que las declaradas).
+ */
+int leerMatrixMarket(const char *archivo, MatrizCSR *M);
+
+/**
+ * @brief Calcula y = A*x en O(nnz).
+ */
+void productoCSRVector(const MatrizCSR *A, const double *x, double *y);
+
+/**
+ * @brief Método de Jacobi sobre una matriz CSR.
+ * @details Mismo criterio de parada y códigos de retorno que jacobiDensa(), pero
+ *          cada iteración cuesta O(nnz).
+ */
+EstadoSolver jacobiCSR(const MatrizCSR *A, const double *b, double *x,
+                       const ParametrosIterativos *param, ResultadoIterativo *res);
+
+/**
+ * @brief Método de Gauss-Seidel con relajación (SOR) sobre una matriz CSR.
+ * @details Mismo criterio de parada y códigos de retorno que gaussSeidelDensa(),
+ *          pero cada iteración cuesta O(nnz).
+ */
+EstadoSolver gaussSeidelCSR(const MatrizCSR *A, const double *b, double *x,
+                            const ParametrosIterativos *param, ResultadoIterativo *res);
+
+#endif // MATRIZ_DISPERSA_H
@@ -0,0 +1,488 @@
+/**
+ * @file modo_lotes.c
+ * @brief Implementación del modo por lotes: opciones, resolución de cada archivo y recorrido del directorio.
+ * @author Tobias Funes
+ * @version 1.0
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "modo_lotes.h"
+#include "../matriz_desde_archivo/matriz_desde_archivo.h"
+#include "../factorizacion_lu/factorizacion_lu.h"
+#include "../precision_mixta/precision_mixta.h"
+#include "../diagnostico_convergencia/diagnostico_convergencia.h"
+#include "../jacobi_procesos/jacobi_procesos.h"
+#include "../lu_en_disco/lu_en_disco.h"
+
+/**
+ * @brief Muestra el uso del modo por lotes.
+ */
+static void mostrarUsoLotes(const char *programa)
+{
+    fprintf(stderr, "Uso: %s --entrada <archivo> | --dir <directorio> [opciones]\n", programa);
+    fprintf(stderr, "  --metodo <m>      gauss, lu, disco, mixta, jacobi, gauss-seidel, cg, gmres, bicgstab (por defecto lu)\n");
+    fprintf(stderr, "  --tol <t>         tolerancia de los métodos iterativos y de mixta (por defecto 1e-10)\n");
+    fprintf(stderr, "  --max-iter <k>    máximo de iteraciones (por defecto %d)\n", MAX_ITER_LOTE);
+    fprintf(stderr, "  --omega <w>       relajación de Gauss-Seidel (por defecto 1.0)\n");
+    fprintf(stderr, "  --precond <p>     ninguno, jacobi, ic, ilu para cg/gmres/bicgstab (por defecto jacobi)\n");
+    fprintf(stderr, "  --diagnostico <s> si, no: estimar el radio espectral antes de jacobi/gauss-seidel (por defecto si)\n");
+    fprintf(stderr, "  --memoria <MB>    memoria para los paneles del método disco (por defecto %d)\n", MEMORIA_DISCO_MB);
+    fprintf(stderr, "  --procesos <p>    procesos entre los que se reparten las filas de jacobi (por defecto 1; 0: uno por núcleo)\n");
+    fprintf(stderr, "  --salida <arch>   archivo de resultados (por defecto la salida estándar)\n");
+    fprintf(stderr, "Los archivos que terminan en .bin se cargan en formato binario (mapeados en memoria).\n");
+}
+
+/*
+ * Convierte el valor de una opción a double; todo el texto debe ser el número.
+ * Devuelve 0 si es válido, 1 (informado por stderr) si no.
+ */
+static int leerRealOpcion(const char *opcion, const char *valor, double *resultado)
+{
+    char *fin;
+    double numero = strtod(valor, &fin);
+    if (fin == valor || *fin != '\0' || !isfinite(numero))
+    {
+        fprintf(stderr, "[ERROR] Valor inválido para %s: %s\n", opcion, valor);
+        return 1;
+    }
+    *resultado = numero;
+    return 0;
+}
+
+/* Igual que leerRealOpcion() para un entero */
+static int leerEnteroOpcion(const char *opcion, const char *valor, int *resultado)
+{
+    char *fin;
+    long numero = strtol(valor, &fin, 10);
+    if (fin == valor || *fin != '\0' || numero < INT_MIN || numero > INT_MAX)
+    {
+        fprintf(stderr, "[ERROR] Valor inválido para %s: %s\n", opcion, valor);
+        return 1;
+    }
+    *resultado = (int)numero;
+    return 0;
+}
+
+int leerOpcionesLote(int argc, char const *argv[], OpcionesLote *op)
+{
+    op->entrada = NULL;
+    op->directorio = NULL;
+    op->salida = NULL;
+    op->metodo = "lu";
+    op->precond = PRECOND_JACOBI;
+    op->param.tolerancia = 1e-10;
+    op->param.max_iter = MAX_ITER_LOTE;
+    op->param.omega = 1.0;
+    op->diagnostico = 1;
+    op->procesos = 1;
+    double memoria_mb = MEMORIA_DISCO_MB;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *valor = (i + 1 < argc) ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--ayuda") == 0 || strcmp(argv[i], "-h") == 0)
+            return 1;
+        if (valor == NULL)
+        {
+            fprintf(stderr, "[ERROR] Falta el valor de la opción %s\n", argv[i]);
+            return 1;
+        }
+
+        if (strcmp(argv[i], "--entrada") == 0)
+            op->entrada = valor;
+        else if (strcmp(argv[i], "--dir") == 0)
+            op->directorio = valor;
+        else if (strcmp(argv[i], "--salida") == 0)
+            op->salida = valor;
+        else if (strcmp(argv[i], "--metodo") == 0)
+            op->metodo = valor;
+        else if (strcmp(argv[i], "--tol") == 0)
+        {
+            if (leerRealOpcion(argv[i], valor, &op->param.tolerancia) != 0)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--max-iter") == 0)
+        {
+            if (leerEnteroOpcion(argv[i], valor, &op->param.max_iter) != 0)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--omega") == 0)
+        {
+            if (leerRealOpcion(argv[i], valor, &op->param.omega) != 0)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--procesos") == 0)
+        {
+            if (leerEnteroOpcion(argv[i], valor, &op->procesos) != 0)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--memoria") == 0)
+        {
+            if (leerRealOpcion(argv[i], valor, &memoria_mb) != 0)
+                return 1;
+        }
+        else if (strcmp(argv[i], "--diagnostico") == 0)
+        {
+            if (strcmp(valor, "si") == 0)
+                op->diagnostico = 1;
+            else if (strcmp(valor, "no") == 0)
+                op->diagnostico = 0;
+            else
+            {
+                fprintf(stderr, "[ERROR] Valor de --diagnostico inválido: %s (si o no)\n", valor);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[i], "--precond") == 0)
+        {
+            if (strcmp(valor, "ninguno") == 0)
+                op->precond = PRECOND_NINGUNO;
+            else if (strcmp(valor, "jacobi") == 0)
+                op->precond = PRECOND_JACOBI;
+            else if (strcmp(valor, "ic") == 0)
+                op->precond = PRECOND_CHOLESKY_INCOMPLETO;
+            else if (strcmp(valor, "ilu") == 0)
+                op->precond = PRECOND_LU_INCOMPLETO;
+            else
+            {
+                fprintf(stderr, "[ERROR] Precondicionador desconocido: %s\n", valor);
+                return 1;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "[ERROR] Opción desconocida: %s\n", argv[i]);
+            return 1;
+        }
+        i++;
+    }
+
+    const char *metodos[] = { "gauss", "lu", "disco", "mixta", "jacobi", "gauss-seidel", "cg", "gmres", "bicgstab" };
+    int metodo_valido = 0;
+    for (size_t k = 0; k < sizeof(metodos) / sizeof(metodos[0]); k++)
+        if (strcmp(op->metodo, metodos[k]) == 0)
+            metodo_valido = 1;
+    if (!metodo_valido)
+    {
+        fprintf(stderr, "[ERROR] Método desconocido: %s\n", op->metodo);
+        return 1;
+    }
+    if ((op->entrada == NULL) == (op->directorio == NULL))
+    {
+        fprintf(stderr, "[ERROR] Indique exactamente una de --entrada o --dir\n");
+        return 1;
+    }
+    if (op->param.tolerancia <= 0 || op->param.max_iter <= 0 ||
+        op->param.omega <= 0 || op->param.omega >= 2)
+    {
+        fprintf(stderr, "[ERROR] Tolerancia, máximo de iteraciones u omega fuera de rango\n");
+        return 1;
+    }
+    // Al menos un MB y que los bytes entren en size_t
+    if (memoria_mb < 1.0 || memoria_mb > (double)(SIZE_MAX >> 21))
+    {
+        fprintf(stderr, "[ERROR] Memoria del método disco fuera de rango: %g MB\n", memoria_mb);
+        return 1;
+    }
+    op->memoria = (size_t)(memoria_mb * (1 << 20));
+    return 0;
+}
+
+/**
+ * @brief Resuelve A x = b con el método elegido. A y b pueden quedar modificados.
+ * @details Con lu además estima κ₁(A) sobre la misma factorización (O(n²)) y
+ *          advierte en la salida de errores si supera UMBRAL_CONDICION.
+ */
+static EstadoSolver resolverConMetodo(const OpcionesLote *op, const char *ruta, MatrizDensa *A,
+                                      double *b, double *x, ResultadoIterativo *res)
+{
+    int n = A->filas;
+    res->iteraciones = 0;
+    res->error = 0.0;
+    for (int i = 0; i < n; i++)
+        x[i] = 0.0;
+
+    if (strcmp(op->metodo, "gauss") == 0)
+        return eliminacionGaussDensa(A, b, x, NULL);
+
+    if (strcmp(op->metodo, "lu") == 0)
+    {
+        FactorizacionLU F;
+        EstadoSolver estado = factorizarLU(A, &F, TAM_BLOQUE_LU);
+        double condicion;
+        if (estado == SOLVER_OK)
+        {
+            resolverLU(&F, b, x);
+            if (estimarCondicionLU(A, &F, &condicion) == SOLVER_OK && condicion > UMBRAL_CONDICION)
+                fprintf(stderr, "[ADVERTENCIA] %s: matriz mal condicionada (κ₁ estimado %.2e), "
+                        "la solución puede tener pocas cifras correctas\n", ruta, condicion);
+        }
+        liberarFactorizacionLU(&F);
+        return estado;
+    }
+
+    if (strcmp(op->metodo, "disco") == 0)
+    {
+        // La matriz se pasa a un archivo temporal de paneles y se factoriza desde ahí
+        MatrizEnDisco M;
+        if (crearMatrizEnDisco(&M, NULL, n, op->memoria) != 0)
+            return SOLVER_ERROR_MEMORIA;
+        EstadoSolver estado = (cargarMatrizEnDisco(&M, A) == 0) ? factorizarEnDisco(&M) : SOLVER_ERROR_MEMORIA;
+        if (estado == SOLVER_OK)
+            estado = resolverEnDisco(&M, b, x);
+        cerrarMatrizEnDisco(&M);
+        return estado;
+    }
+
+    if (strcmp(op->metodo, "mixta") == 0)
+        return resolverPrecisionMixta(A, b, x, &op->param, res);
+
+    int es_jacobi = strcmp(op->metodo, "jacobi") == 0;
+    if (es_jacobi || strcmp(op->metodo, "gauss-seidel") == 0)
+    {
+        // Si el radio espectral estimado es claramente mayor que 1 no tiene sentido iterar
+        if (op->diagnostico)
+        {
+            DiagnosticoConvergencia d;
+            EstadoSolver estado = diagnosticarConvergencia(A, b, x, es_jacobi ? METODO_JACOBI : METODO_GAUSS_SEIDEL,
+                                                           &op->param, &d);
+            if (estado != SOLVER_OK)
+                return estado;
+            if (d.converge == PRONOSTICO_NO_CONVERGE)
+            {
+                fprintf(stderr, "[ADVERTENCIA] %s: radio espectral estimado %.4f > 1: %s no converge, no se itera\n",
+                        ruta, d.radio_espectral, op->metodo);
+                res->error = d.radio_espectral;
+                return SOLVER_DIVERGE;
+            }
+            // Cerca de 1 la estimación no decide: se itera y el control de estancamiento
+            // detiene el método si el error no baja
+            if (d.converge == PRONOSTICO_INCIERTO)
+                fprintf(stderr, "[ADVERTENCIA] %s: radio espectral estimado %.4f, cerca de 1: "
+                        "no se sabe si %s converge\n", ruta, d.radio_espectral, op->metodo);
+        }
+        if (es_jacobi && op->procesos != 1)
+            return jacobiProcesos(A, b, x, &op->param, op->procesos, res);
+        if (es_jacobi)
+            return jacobiDensa(A, b, x, &op->param, res);
+        return gaussSeidelDensa(A, b, x, &op->param, res);
+    }
+    if (strcmp(op->metodo, "cg") == 0)
+        return gradienteConjugadoDensa(A, b, x, op->precond, &op->param, res, NULL);
+
+    // gmres y bicgstab
+    Precondicionador P;
+    EstadoSolver estado = crearPrecondicionadorDensa(&P, op->precond, A);
+    if (estado != SOLVER_OK)
+        return estado;
+    OperadorLineal operador = operadorDensa(A);
+    if (strcmp(op->metodo, "gmres") == 0)
+        estado = gmres(&operador, b, x, &P, REINICIO_GMRES, &op->param, res, NULL);
+    else
+        estado = bicgstab(&operador, b, x, &P, &op->param, res, NULL);
+    liberarPrecondicionador(&P);
+    return estado;
+}
+
+int resolverArchivoLote(const OpcionesLote *op, const char *ruta, FILE *salida)
+{
+    size_t largo = strlen(ruta);
+    int binario = largo > 4 && strcmp(ruta + largo - 4, ".bin") == 0;
+
+    SistemaBinario S;
+    MatrizDensa A_texto;
+    double *b_texto = NULL;
+    MatrizDensa *A;
+    double *b;
+
+    if (binario)
+    {
+        if (mapearSistemaBinario(ruta, &S) != 0)
+        {
+            fprintf(stderr, "[ERROR] No se pudo cargar %s\n", ruta);
+            return 1;
+        }
+        A = &S.A;
+        b = S.b;
+    }
+    else
+    {
+        if (leerSistemaTexto(ruta, &A_texto, &b_texto, 0) != 0)
+        {
+            fprintf(stderr, "[ERROR] No se pudo cargar %s\n", ruta);
+            return 1;
+        }
+        A = &A_texto;
+        b = b_texto;
+    }
+
+    int n = A->filas;
+    double *x = (double *)malloc(n * sizeof(double));
+    EstadoSolver estado = SOLVER_ERROR_MEMORIA;
+    ResultadoIterativo res = { 0, 0.0 };
+    if (x != NULL)
+        estado = resolverConMetodo(op, ruta, A, b, x, &res);
+
+    fprintf(salida, "%s %s %d %s %d %.6e", ruta, op->metodo, n, nombreEstadoSolver(estado),
+            res.iteraciones, res.error);
+    if (estado == SOLVER_OK)
+        for (int i = 0; i < n; i++)
+            fprintf(salida, " %.17g", x[i]);
+    fprintf(salida, "\n");
+
+    free(x);
+    if (binario)
+        liberarSistemaBinario(&S);
+    else
+    {
+        liberarMatrizDensa(&A_texto);
+        free(b_texto);
+    }
+    return estado == SOLVER_OK ? 0 : 1;
+}
+
+static int compararNombres(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+int modoLotes(int argc, char const *argv[])
+{
+    OpcionesLote op;
+    if (leerOpcionesLote(argc, argv, &op) != 0)
+    {
+        mostrarUsoLotes(argv[0]);
+        return 1;
+    }
+
+    FILE *salida = stdout;
+    if (op.salida != NULL)
+    {
+        salida = fopen(op.salida, "w");
+        if (salida == NULL)
+        {
+            fprintf(stderr, "[ERROR] No se pudo crear el archivo de salida %s\n", op.salida);
+            return 1;
+        }
+    }
+    // Buffer grande: con miles de sistemas la escritura no debe dominar el tiempo
+    setvbuf(salida, NULL, _IOFBF, 1 << 16);
+
+    int resueltos = 0;
+    int fallidos = 0;
+    clock_t inicio = clock();
+
+    if (op.entrada != NULL)
+    {
+        if (resolverArchivoLote(&op, op.entrada, salida) == 0)
+            resueltos++;
+        else
+            fallidos++;
+    }
+    else
+    {
+        DIR *dir = opendir(op.directorio);
+        if (dir == NULL)
+        {
+            fprintf(stderr, "[ERROR] No se pudo abrir el directorio %s\n", op.directorio);
+            if (salida != stdout)
+                fclose(salida);
+            return 1;
+        }
+
+        // Se ordenan los nombres para que la salida no dependa del sistema de archivos
+        char **nombres = NULL;
+        int cantidad = 0, capacidad = 0;
+        int sin_memoria = 0;
+        struct dirent *entrada;
+        while (!sin_memoria && (entrada = readdir(dir)) != NULL)
+        {
+            if (entrada->d_name[0] == '.')
+                continue;
+            if (cantidad == capacidad)
+            {
+                int nueva_capacidad = capacidad > 0 ? 2 * capacidad : 64;
+                char **nuevos = (char **)realloc(nombres, nueva_capacidad * sizeof(char *));
+                if (nuevos == NULL)
+                {
+                    sin_memoria = 1;
+                    break;
+                }
+                nombres = nuevos;
+                capacidad = nueva_capacidad;
+            }
+            nombres[cantidad] = (char *)malloc(strlen(entrada->d_name) + 1);
+            if (nombres[cantidad] == NULL)
+                sin_memoria = 1;
+            else
+                strcpy(nombres[cantidad++], entrada->d_name);
+        }
+        closedir(dir);
+
+        // Resolver sólo parte del directorio daría un resultado incompleto sin aviso
+        if (sin_memoria)
+        {
+            fprintf(stderr, "[ERROR] Error de memoria al leer el directorio %s (%d archivos leídos)\n",
+                    op.directorio, cantidad);
+            for (int k = 0; k < cantidad; k++)
+                free(nombres[k]);
+            free(nombres);
+            if (salida != stdout)
+                fclose(salida);
+            return 1;
+        }
+        if (cantidad > 0)
+            qsort(nombres, cantidad, sizeof(char *), compararNombres);
+
+        char ruta[LARGO_RUTA];
+        for (int k = 0; k < cantidad; k++)
+        {
+            int largo = snprintf(ruta, sizeof(ruta), "%s/%s", op.directorio, nombres[k]);
+            struct stat info;
+            if (largo < 0 || (size_t)largo >= sizeof(ruta))
+            {
+                fprintf(stderr, "[ERROR] Ruta demasiado larga: %s/%s\n", op.directorio, nombres[k]);
+                fallidos++;
+            }
+            else if (stat(ruta, &info) != 0)
+            {
+                fprintf(stderr, "[ERROR] No se pudo acceder a %s\n", ruta);
+                fallidos++;
+            }
+            else if (!S_ISREG(info.st_mode))
+            {
+                // Subdirectorios, FIFOs, dispositivos...: no son sistemas
+            }
+            else if (resolverArchivoLote(&op, ruta, salida) == 0)
+                resueltos++;
+            else
+                fallidos++;
+            free(nombres[k]);
+        }
+        free(nombres);
+    }
+
+    // Con el buffer grande los errores de escritura (disco lleno) aparecen recién al vaciarlo
+    int error_escritura = ferror(salida);
+    if (salida != stdout)
+        error_escritura |= (fclose(salida) != 0);
+    else
+        error_escritura |= (fflush(salida) != 0);
+
+    fprintf(stderr, "%d sistemas resueltos, %d con error, en %.3f s\n", resueltos, fallidos,
+            (double)(clock() - inicio) / CLOCKS_PER_SEC);
+    if (error_escritura)
+    {
+        fprintf(stderr, "[ERROR] No se pudieron escribir los resultados en %s\n",
+                op.salida != NULL ? op.salida : "la salida estándar");
+        return 1;
+    }
+    return fallidos == 0 ? 0 : 1;
+}
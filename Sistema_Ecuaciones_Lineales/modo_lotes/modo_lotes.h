@@ -0,0 +1,82 @@
+/**
+ * @file modo_lotes.h
+ * @brief Modo por lotes (no interactivo) del programa de sistemas de ecuaciones lineales.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Cuando SistemaEcuacionesLineales.c recibe argumentos no muestra el menú: llama
+ * a modoLotes(), que resuelve un archivo o todos los de un directorio con el
+ * método elegido y escribe una línea de resultados por sistema. Está separado
+ * del programa interactivo para que las pruebas puedan usar leerOpcionesLote()
+ * y resolverArchivoLote() directamente.
+ *
+ * La salida estándar (o --salida) sólo recibe las líneas de resultados: los
+ * errores, advertencias y el resumen final van a stderr, también los de la
+ * librería, así que la salida se puede encadenar con otros programas.
+ */
+#ifndef MODO_LOTES_H
+#define MODO_LOTES_H
+
+#include <stdio.h>
+#include "../matriz_densa/matriz_densa.h"
+#include "../krylov/krylov.h"
+
+#define MAX_ITER_LOTE 10000 // Máximo de iteraciones por defecto
+#define LARGO_RUTA 4096 // Largo máximo de una ruta en el modo por lotes
+#define REINICIO_GMRES 30 // Dimensión del subespacio de GMRES antes de reiniciar
+#define MEMORIA_DISCO_MB 256 // Memoria para paneles del método disco, por defecto
+#define UMBRAL_CONDICION 1e12 // Con κ₁(A) mayor se pierden más de 12 de las ~16 cifras de x
+
+/**
+ * @brief Opciones del modo por lotes (no interactivo).
+ */
+typedef struct
+{
+    const char *entrada;            // Archivo con un sistema (texto, o binario si termina en .bin)
+    const char *directorio;         // Directorio con varios sistemas a resolver uno tras otro
+    const char *salida;             // Archivo de resultados (NULL: salida estándar)
+    const char *metodo;             // gauss, lu, disco, mixta, jacobi, gauss-seidel, cg, gmres o bicgstab
+    TipoPrecondicionador precond;   // Precondicionador de cg, gmres y bicgstab
+    ParametrosIterativos param;     // Tolerancia, máximo de iteraciones y omega
+    int diagnostico;                // 1: análisis previo de convergencia para jacobi y gauss-seidel
+    int procesos;                   // Procesos de jacobi (1: en este proceso, <= 0: uno por núcleo)
+    size_t memoria;                 // Bytes de paneles en memoria del método disco
+} OpcionesLote;
+
+/**
+ * @brief Interpreta los argumentos del modo por lotes.
+ * @details Los valores numéricos deben ser números completos ("--tol abc" o
+ *          "--max-iter 10x" son errores) y estar en rango.
+ * @return 0 si son válidos, 1 en caso contrario (el motivo se informa por stderr).
+ */
+int leerOpcionesLote(int argc, char const *argv[], OpcionesLote *op);
+
+/**
+ * @brief Carga, resuelve y escribe el resultado de un sistema.
+ * @details Escribe en salida una línea: archivo, método, n, estado,
+ *          iteraciones, error y, si el estado es OK, las n componentes de x.
+ * @param op Opciones (método, tolerancia, ...).
+ * @param ruta Archivo del sistema (texto, o binario si termina en .bin).
+ * @param salida Archivo de resultados.
+ * @return 0 si se resolvió, 1 en caso contrario.
+ */
+int resolverArchivoLote(const OpcionesLote *op, const char *ruta, FILE *salida);
+
+/**
+ * @brief Modo por lotes: resuelve uno o varios sistemas según los argumentos, sin menú ni pausas.
+ * @details Uso:
+ *   sistema.o --entrada <archivo> | --dir <directorio>  [--metodo <m>] [--tol <t>]
+ *             [--max-iter <k>] [--omega <w>] [--precond ninguno|jacobi|ic|ilu]
+ *             [--diagnostico si|no] [--procesos <p>] [--memoria <MB>] [--salida <archivo>]
+ *
+ *   Con --dir se resuelven los archivos regulares del directorio (no los
+ *   ocultos ni los subdirectorios), en orden alfabético.
+ *   Por cada sistema escribe una línea con: archivo, método, n, estado,
+ *   iteraciones, error y las n componentes de la solución. No imprime las
+ *   iteraciones; los errores se informan por stderr y el resumen final también.
+ * @return 0 si todos los sistemas se resolvieron, 1 en caso contrario (también
+ *         si no se pudo recorrer el directorio completo o escribir los resultados).
+ */
+int modoLotes(int argc, char const *argv[]);
+
+#endif // MODO_LOTES_H
@@ -0,0 +1,334 @@
+/**
+ * @file nucleos_simd.c
+ * @brief Implementación de los núcleos vectoriales y de la selección por procesador.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Las funciones con __attribute__((target("..."))) se compilan para ese conjunto
+ * de instrucciones aunque el resto del archivo no: sólo se llaman si
+ * detectarNivelSimd() comprobó que el procesador (y el sistema operativo, que
+ * debe guardar los registros anchos) las soporta.
+ */
+#include <math.h>
+#include "nucleos_simd.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NUCLEOS_X86 1
+#include <immintrin.h>
+#else
+#define NUCLEOS_X86 0
+#endif
+
+static NivelSimd nivel_disponible = SIMD_ESCALAR;
+static NivelSimd nivel_activo = SIMD_ESCALAR;
+
+/* ---------------------------------------------------------------------------
+   Versiones escalares
+   --------------------------------------------------------------------------- */
+
+static void axpyEscalar(double *y, const double *x, double alfa, int n)
+{
+    for (int k = 0; k < n; k++)
+        y[k] += alfa * x[k];
+}
+
+/* Cuatro sumas parciales independientes: el compilador puede vectorizarlas sin -ffast-math */
+static double productoEscalarEscalar(const double *u, const double *v, int n)
+{
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    int k = 0;
+    for (; k + 3 < n; k += 4)
+    {
+        s0 += u[k] * v[k];
+        s1 += u[k + 1] * v[k + 1];
+        s2 += u[k + 2] * v[k + 2];
+        s3 += u[k + 3] * v[k + 3];
+    }
+    for (; k < n; k++)
+        s0 += u[k] * v[k];
+    return (s0 + s1) + (s2 + s3);
+}
+
+static int indiceMaximoAbsEscalar(const double *v, int n, int paso)
+{
+    int indice = 0;
+    double maximo = -1.0;
+    for (int k = 0; k < n; k++)
+    {
+        double a = fabs(v[(size_t)k * paso]);
+        if (a > maximo)
+        {
+            maximo = a;
+            indice = k;
+        }
+    }
+    return indice;
+}
+
+/*
+ * Reducción final del argmax vectorial: el mayor valor entre los carriles y, a
+ * igual valor, el menor índice (cada carril ya guarda el primero de los suyos).
+ * Los índices se llevan como double, exactos hasta 2^53.
+ */
+static int reducirArgmax(const double *valores, const double *indices, int carriles, int indice,
+                         double maximo)
+{
+    for (int c = 0; c < carriles; c++)
+    {
+        if (indices[c] < 0.0)
+            continue;
+        int k = (int)indices[c];
+        if (valores[c] > maximo || (valores[c] == maximo && k < indice))
+        {
+            maximo = valores[c];
+            indice = k;
+        }
+    }
+    return indice;
+}
+
+#if NUCLEOS_X86
+
+/* ---------------------------------------------------------------------------
+   AVX2 + FMA (4 doubles)
+   --------------------------------------------------------------------------- */
+
+__attribute__((target("avx2,fma")))
+static void axpyAvx2(double *y, const double *x, double alfa, int n)
+{
+    __m256d a = _mm256_set1_pd(alfa);
+    int k = 0;
+    for (; k + 8 <= n; k += 8)
+    {
+        __m256d y0 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k));
+        __m256d y1 = _mm256_fmadd_pd(a, _mm256_loadu_pd(x + k + 4), _mm256_loadu_pd(y + k + 4));
+        _mm256_storeu_pd(y + k, y0);
+        _mm256_storeu_pd(y + k + 4, y1);
+    }
+    for (; k < n; k++)
+        y[k] += alfa * x[k];
+}
+
+__attribute__((target("avx2,fma")))
+static double productoEscalarAvx2(const double *u, const double *v, int n)
+{
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+    int k = 0;
+    for (; k + 8 <= n; k += 8)
+    {
+        s0 = _mm256_fmadd_pd(_mm256_loadu_pd(u + k), _mm256_loadu_pd(v + k), s0);
+        s1 = _mm256_fmadd_pd(_mm256_loadu_pd(u + k + 4), _mm256_loadu_pd(v + k + 4), s1);
+    }
+    s0 = _mm256_add_pd(s0, s1);
+    __m128d mitad = _mm_add_pd(_mm256_castpd256_pd128(s0), _mm256_extractf128_pd(s0, 1));
+    double suma = _mm_cvtsd_f64(_mm_add_sd(mitad, _mm_unpackhi_pd(mitad, mitad)));
+    for (; k < n; k++)
+        suma += u[k] * v[k];
+    return suma;
+}
+
+__attribute__((target("avx2,fma")))
+static int indiceMaximoAbsAvx2(const double *v, int n, int paso)
+{
+    const __m256d sin_signo = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+    __m256d maximo = _mm256_set1_pd(-1.0);
+    __m256d mejor = _mm256_set1_pd(-1.0);
+    __m256d indice = _mm256_setr_pd(0.0, 1.0, 2.0, 3.0);
+    const __m256d cuatro = _mm256_set1_pd(4.0);
+    __m256i desplazamiento = _mm256_setr_epi64x(0, paso, 2LL * paso, 3LL * paso);
+    const __m256i avance = _mm256_set1_epi64x(4LL * paso);
+
+    int k = 0;
+    for (; k + 4 <= n; k += 4)
+    {
+        __m256d x = (paso == 1) ? _mm256_loadu_pd(v + k)
+                                : _mm256_i64gather_pd(v, desplazamiento, 8);
+        x = _mm256_and_pd(x, sin_signo);
+        __m256d mayor = _mm256_cmp_pd(x, maximo, _CMP_GT_OQ); // Falso con NaN
+        maximo = _mm256_blendv_pd(maximo, x, mayor);
+        mejor = _mm256_blendv_pd(mejor, indice, mayor);
+        indice = _mm256_add_pd(indice, cuatro);
+        desplazamiento = _mm256_add_epi64(desplazamiento, avance);
+    }
+
+    double valores[4], indices[4];
+    _mm256_storeu_pd(valores, maximo);
+    _mm256_storeu_pd(indices, mejor);
+    int resultado = reducirArgmax(valores, indices, 4, 0, -1.0);
+
+    // Resto escalar: sus índices son mayores, sólo ganan con un valor estrictamente mayor
+    double maximo_escalar = -1.0;
+    for (int c = 0; c < 4; c++)
+        if (indices[c] >= 0.0 && (int)indices[c] == resultado)
+            maximo_escalar = valores[c];
+    for (; k < n; k++)
+    {
+        double a = fabs(v[(size_t)k * paso]);
+        if (a > maximo_escalar)
+        {
+            maximo_escalar = a;
+            resultado = k;
+        }
+    }
+    return resultado;
+}
+
+/* ---------------------------------------------------------------------------
+   AVX-512 (8 doubles, el resto con máscara)
+   --------------------------------------------------------------------------- */
+
+__attribute__((target("avx512f")))
+static void axpyAvx512(double *y, const double *x, double alfa, int n)
+{
+    __m512d a = _mm512_set1_pd(alfa);
+    int k = 0;
+    for (; k + 16 <= n; k += 16)
+    {
+        __m512d y0 = _mm512_fmadd_pd(a, _mm512_loadu_pd(x + k), _mm512_loadu_pd(y + k));
+        __m512d y1 = _mm512_fmadd_pd(a, _mm512_loadu_pd(x + k + 8), _mm512_loadu_pd(y + k + 8));
+        _mm512_storeu_pd(y + k, y0);
+        _mm512_storeu_pd(y + k + 8, y1);
+    }
+    for (; k < n; k += 8)
+    {
+        __mmask8 m = (n - k >= 8) ? (__mmask8)0xFF : (__mmask8)((1u << (n - k)) - 1);
+        __m512d yk = _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(m, x + k), _mm512_maskz_loadu_pd(m, y + k));
+        _mm512_mask_storeu_pd(y + k, m, yk);
+    }
+}
+
+__attribute__((target("avx512f")))
+static double productoEscalarAvx512(const double *u, const double *v, int n)
+{
+    __m512d s0 = _mm512_setzero_pd();
+    __m512d s1 = _mm512_setzero_pd();
+    int k = 0;
+    for (; k + 16 <= n; k += 16)
+    {
+        s0 = _mm512_fmadd_pd(_mm512_loadu_pd(u + k), _mm512_loadu_pd(v + k), s0);
+        s1 = _mm512_fmadd_pd(_mm512_loadu_pd(u + k + 8), _mm512_loadu_pd(v + k + 8), s1);
+    }
+    for (; k < n; k += 8)
+    {
+        __mmask8 m = (n - k >= 8) ? (__mmask8)0xFF : (__mmask8)((1u << (n - k)) - 1);
+        s0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, u + k), _mm512_maskz_loadu_pd(m, v + k), s0);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+}
+
+__attribute__((target("avx512f")))
+static int indiceMaximoAbsAvx512(const double *v, int n, int paso)
+{
+    __m512d maximo = _mm512_set1_pd(-1.0);
+    __m512d mejor = _mm512_set1_pd(-1.0);
+    __m512d indice = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+    const __m512d ocho = _mm512_set1_pd(8.0);
+    long long p = paso;
+    __m512i desplazamiento = _mm512_setr_epi64(0, p, 2 * p, 3 * p, 4 * p, 5 * p, 6 * p, 7 * p);
+    const __m512i avance = _mm512_set1_epi64(8 * p);
+
+    for (int k = 0; k < n; k += 8)
+    {
+        __mmask8 m = (n - k >= 8) ? (__mmask8)0xFF : (__mmask8)((1u << (n - k)) - 1);
+        __m512d x = (paso == 1) ? _mm512_maskz_loadu_pd(m, v + k)
+                                : _mm512_mask_i64gather_pd(_mm512_setzero_pd(), m, desplazamiento, v, 8);
+        x = _mm512_abs_pd(x);
+        // Sólo los carriles válidos; la comparación ordenada es falsa con NaN
+        __mmask8 mayor = _mm512_mask_cmp_pd_mask(m, x, maximo, _CMP_GT_OQ);
+        maximo = _mm512_mask_mov_pd(maximo, mayor, x);
+        mejor = _mm512_mask_mov_pd(mejor, mayor, indice);
+        indice = _mm512_add_pd(indice, ocho);
+        desplazamiento = _mm512_add_epi64(desplazamiento, avance);
+    }
+
+    double valores[8], indices[8];
+    _mm512_storeu_pd(valores, maximo);
+    _mm512_storeu_pd(indices, mejor);
+    return reducirArgmax(valores, indices, 8, 0, -1.0);
+}
+
+/* Se ejecuta al cargar el programa, antes de main: no hay carreras entre hilos */
+__attribute__((constructor))
+static void detectarNivelSimd(void)
+{
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        nivel_disponible = SIMD_AVX512;
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        nivel_disponible = SIMD_AVX2;
+    else
+        nivel_disponible = SIMD_ESCALAR;
+    nivel_activo = nivel_disponible;
+}
+
+#endif // NUCLEOS_X86
+
+/* ---------------------------------------------------------------------------
+   Interfaz
+   --------------------------------------------------------------------------- */
+
+NivelSimd nivelSimdDisponible(void)
+{
+    return nivel_disponible;
+}
+
+NivelSimd nivelSimdActivo(void)
+{
+    return nivel_activo;
+}
+
+NivelSimd fijarNivelSimd(NivelSimd nivel)
+{
+    nivel_activo = (nivel <= nivel_disponible) ? nivel : nivel_disponible;
+    return nivel_activo;
+}
+
+const char *nombreNivelSimd(NivelSimd nivel)
+{
+    switch (nivel)
+    {
+    case SIMD_ESCALAR:
+        return "escalar";
+    case SIMD_AVX2:
+        return "AVX2";
+    case SIMD_AVX512:
+        return "AVX-512";
+    }
+    return "DESCONOCIDO";
+}
+
+void axpySimd(double *y, const double *x, double alfa, int n)
+{
+#if NUCLEOS_X86
+    if (nivel_activo == SIMD_AVX512)
+        return axpyAvx512(y, x, alfa, n);
+    if (nivel_activo == SIMD_AVX2)
+        return axpyAvx2(y, x, alfa, n);
+#endif
+    axpyEscalar(y, x, alfa, n);
+}
+
+double productoEscalarSimd(const double *u, const double *v, int n)
+{
+#if NUCLEOS_X86
+    if (nivel_activo == SIMD_AVX512)
+        return productoEscalarAvx512(u, v, n);
+    if (nivel_activo == SIMD_AVX2)
+        return productoEscalarAvx2(u, v, n);
+#endif
+    return productoEscalarEscalar(u, v, n);
+}
+
+int indiceMaximoAbsSimd(const double *v, int n, int paso)
+{
+    if (n <= 0)
+        return 0;
+#if NUCLEOS_X86
+    if (nivel_activo == SIMD_AVX512)
+        return indiceMaximoAbsAvx512(v, n, paso);
+    if (nivel_activo == SIMD_AVX2)
+        return indiceMaximoAbsAvx2(v, n, paso);
+#endif
+    return indiceMaximoAbsEscalar(v, n, paso);
+}
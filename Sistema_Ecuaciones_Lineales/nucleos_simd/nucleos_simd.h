@@ -0,0 +1,80 @@
+/**
+ * @file nucleos_simd.h
+ * @brief Núcleos vectoriales (AVX2 / AVX-512) con selección en tiempo de ejecución.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Casi todo el tiempo de la eliminación de Gauss se va en tres bucles:
+ *
+ *   - la actualización de filas   fila_j[k] += factor * fila_i[k]   (AXPY)
+ *   - la retrosustitución         suma -= fila[j] * x[j]            (producto escalar)
+ *   - la búsqueda del pivote      max |a_li|, l >= i                (argmax |v|)
+ *
+ * Cada núcleo tiene una versión escalar (portable) y, en x86 con GCC o Clang,
+ * versiones AVX2+FMA y AVX-512 compiladas con __attribute__((target(...))): el
+ * programa se compila sin -march y al cargarse elige la mejor versión que
+ * soporta el procesador (__builtin_cpu_supports). Así el mismo ejecutable corre
+ * en cualquier x86-64 y aprovecha AVX-512 donde existe.
+ *
+ * Las versiones vectoriales usan FMA (un solo redondeo en a*x + y) y el
+ * producto escalar suma en varios acumuladores: los resultados pueden diferir
+ * de la versión escalar en el último bit. El argmax da siempre el mismo índice
+ * (el primero con el máximo valor absoluto; los NaN se ignoran).
+ */
+#ifndef NUCLEOS_SIMD_H
+#define NUCLEOS_SIMD_H
+
+/**
+ * @brief Conjuntos de instrucciones de los núcleos, de menor a mayor.
+ */
+typedef enum
+{
+    SIMD_ESCALAR = 0,   // C portable (el compilador puede vectorizarlo con -march)
+    SIMD_AVX2,          // 4 doubles por instrucción, con FMA
+    SIMD_AVX512         // 8 doubles por instrucción, con FMA y máscaras para el resto
+} NivelSimd;
+
+/**
+ * @brief Mejor nivel que soporta el procesador (y el compilador con que se construyó).
+ */
+NivelSimd nivelSimdDisponible(void);
+
+/**
+ * @brief Nivel que usan los núcleos (al inicio, nivelSimdDisponible()).
+ */
+NivelSimd nivelSimdActivo(void);
+
+/**
+ * @brief Limita el nivel de los núcleos, p. ej. para comparar versiones.
+ * @details No es seguro llamarla mientras otros hilos usan los núcleos.
+ * @param nivel Nivel pedido; si el procesador no lo soporta se usa nivelSimdDisponible().
+ * @return El nivel que quedó activo.
+ */
+NivelSimd fijarNivelSimd(NivelSimd nivel);
+
+/**
+ * @brief Nombre del nivel ("escalar", "AVX2", "AVX-512") para informes.
+ */
+const char *nombreNivelSimd(NivelSimd nivel);
+
+/**
+ * @brief y[k] += alfa * x[k] para k = 0..n-1.
+ * @details y y x no deben solaparse. No hace falta que estén alineados.
+ */
+void axpySimd(double *y, const double *x, double alfa, int n);
+
+/**
+ * @brief Devuelve Σ u[k] * v[k] para k = 0..n-1.
+ */
+double productoEscalarSimd(const double *u, const double *v, int n);
+
+/**
+ * @brief Índice k del primer elemento con el mayor |v[k * paso]|, k = 0..n-1.
+ * @details Con paso = 1 recorre un vector contiguo; con paso = stride recorre una
+ *          columna de una MatrizDensa (con AVX2/AVX-512 los elementos se juntan
+ *          con instrucciones gather).
+ * @return El índice (0 si n <= 0 o si todos los elementos son NaN).
+ */
+int indiceMaximoAbsSimd(const double *v, int n, int paso);
+
+#endif // NUCLEOS_SIMD_H
@@ -0,0 +1,200 @@
+/**
+ * @file pool_hilos.c
+ * @brief Implementación del pool de hilos persistentes.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Sincronización: un contador de "generación" protegido por un mutex. Para lanzar
+ * una tarea se incrementa la generación y se despierta a los hilos; cada hilo que
+ * termina decrementa el contador de pendientes y el último avisa al que llamó.
+ * La barrera interna usa el mismo esquema con su propio contador de generación.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "pool_hilos.h"
+
+struct PoolHilos
+{
+    int num_hilos;
+    pthread_t *hilos;           // num_hilos - 1 hilos trabajadores
+    pthread_mutex_t mutex;
+    pthread_cond_t hay_tarea;
+    pthread_cond_t tarea_terminada;
+    unsigned long generacion;   // Se incrementa con cada tarea lanzada
+    int pendientes;             // Trabajadores que todavía no terminaron la tarea
+    int terminar;
+    TareaParalela tarea;
+    void *contexto;
+    pthread_cond_t barrera_cond;
+    unsigned long barrera_generacion;
+    int barrera_llegados;
+};
+
+typedef struct
+{
+    PoolHilos *pool;
+    int id;
+} ArgumentoHilo;
+
+static void *bucleTrabajador(void *arg)
+{
+    ArgumentoHilo *a = (ArgumentoHilo *)arg;
+    PoolHilos *pool = a->pool;
+    int id = a->id;
+    unsigned long generacion_vista = 0;
+    free(a);
+
+    for (;;)
+    {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->generacion == generacion_vista && !pool->terminar)
+            pthread_cond_wait(&pool->hay_tarea, &pool->mutex);
+        if (pool->terminar)
+        {
+            pthread_mutex_unlock(&pool->mutex);
+            return NULL;
+        }
+        generacion_vista = pool->generacion;
+        TareaParalela tarea = pool->tarea;
+        void *contexto = pool->contexto;
+        pthread_mutex_unlock(&pool->mutex);
+
+        tarea(contexto, id, pool->num_hilos);
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->pendientes == 0)
+            pthread_cond_signal(&pool->tarea_terminada);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+}
+
+int numNucleosDisponibles(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n > 0)
+        return (int)n;
+#endif
+    return 1;
+}
+
+PoolHilos *crearPoolHilos(int num_hilos)
+{
+    if (num_hilos <= 0)
+        num_hilos = numNucleosDisponibles();
+
+    PoolHilos *pool = (PoolHilos *)calloc(1, sizeof(PoolHilos));
+    if (pool == NULL)
+        return NULL;
+
+    pool->num_hilos = num_hilos;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->hay_tarea, NULL);
+    pthread_cond_init(&pool->tarea_terminada, NULL);
+    pthread_cond_init(&pool->barrera_cond, NULL);
+
+    if (num_hilos > 1)
+    {
+        pool->hilos = (pthread_t *)malloc((size_t)(num_hilos - 1) * sizeof(pthread_t));
+        if (pool->hilos == NULL)
+        {
+            free(pool);
+            return NULL;
+        }
+    }
+
+    for (int i = 1; i < num_hilos; i++)
+    {
+        ArgumentoHilo *arg = (ArgumentoHilo *)malloc(sizeof(ArgumentoHilo));
+        if (arg != NULL)
+        {
+            arg->pool = pool;
+            arg->id = i;
+        }
+        if (arg == NULL || pthread_create(&pool->hilos[i - 1], NULL, bucleTrabajador, arg) != 0)
+        {
+            fprintf(stderr, "[ERROR] No se pudo crear el hilo %d del pool.\n", i);
+            free(arg);
+            // Se continúa con los hilos que sí se crearon
+            pool->num_hilos = i;
+            break;
+        }
+    }
+
+    return pool;
+}
+
+int numHilosPool(const PoolHilos *pool)
+{
+    return pool->num_hilos;
+}
+
+void ejecutarEnPool(PoolHilos *pool, TareaParalela tarea, void *contexto)
+{
+    if (pool->num_hilos == 1)
+    {
+        tarea(contexto, 0, 1);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->tarea = tarea;
+    pool->contexto = contexto;
+    pool->pendientes = pool->num_hilos - 1;
+    pool->generacion++;
+    pthread_cond_broadcast(&pool->hay_tarea);
+    pthread_mutex_unlock(&pool->mutex);
+
+    // El hilo que llama hace su parte
+    tarea(contexto, 0, pool->num_hilos);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->pendientes > 0)
+        pthread_cond_wait(&pool->tarea_terminada, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+void barreraPool(PoolHilos *pool)
+{
+    if (pool->num_hilos == 1)
+        return;
+
+    pthread_mutex_lock(&pool->mutex);
+    unsigned long generacion = pool->barrera_generacion;
+    if (++pool->barrera_llegados == pool->num_hilos)
+    {
+        // El último en llegar libera a los demás
+        pool->barrera_llegados = 0;
+        pool->barrera_generacion++;
+        pthread_cond_broadcast(&pool->barrera_cond);
+    }
+    else
+    {
+        while (generacion == pool->barrera_generacion)
+            pthread_cond_wait(&pool->barrera_cond, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+void destruirPoolHilos(PoolHilos *pool)
+{
+    if (pool == NULL)
+        return;
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->terminar = 1;
+    pthread_cond_broadcast(&pool->hay_tarea);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (int i = 1; i < pool->num_hilos; i++)
+        pthread_join(pool->hilos[i - 1], NULL);
+
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->hay_tarea);
+    pthread_cond_destroy(&pool->tarea_terminada);
+    pthread_cond_destroy(&pool->barrera_cond);
+    free(pool->hilos);
+    free(pool);
+}
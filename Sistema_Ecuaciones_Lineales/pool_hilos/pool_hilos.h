@@ -0,0 +1,74 @@
+/**
+ * @file pool_hilos.h
+ * @brief Pool de hilos persistentes (POSIX threads) para repartir trabajo entre núcleos.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Los hilos se crean una sola vez y quedan esperando tareas. Cada llamada a
+ * ejecutarEnPool() ejecuta la misma función en todos los hilos (el hilo que llama
+ * participa como hilo 0) y vuelve cuando todos terminaron, por lo que funciona
+ * como una región paralela con barrera al final. Así, un método iterativo puede
+ * repartir cada iteración sin pagar el costo de crear hilos en cada una.
+ *
+ * Compilar con -pthread.
+ */
+#ifndef POOL_HILOS_H
+#define POOL_HILOS_H
+
+/**
+ * @brief Función que ejecuta cada hilo.
+ * @param contexto Datos compartidos de la tarea.
+ * @param id_hilo Índice del hilo (0 .. num_hilos-1).
+ * @param num_hilos Cantidad total de hilos que ejecutan la tarea.
+ */
+typedef void (*TareaParalela)(void *contexto, int id_hilo, int num_hilos);
+
+typedef struct PoolHilos PoolHilos;
+
+/**
+ * @brief Crea un pool con num_hilos hilos (incluyendo al que llama).
+ * @param num_hilos Cantidad de hilos; si es <= 0 se usa un hilo por núcleo.
+ * @return El pool, o NULL si no se pudo crear.
+ */
+PoolHilos *crearPoolHilos(int num_hilos);
+
+/**
+ * @brief Devuelve la cantidad de hilos del pool.
+ */
+int numHilosPool(const PoolHilos *pool);
+
+/**
+ * @brief Ejecuta tarea(contexto, id, num_hilos) en todos los hilos y espera a que terminen.
+ */
+void ejecutarEnPool(PoolHilos *pool, TareaParalela tarea, void *contexto);
+
+/**
+ * @brief Barrera entre los hilos que ejecutan la tarea actual.
+ * @details Sólo puede llamarse desde dentro de una TareaParalela, y todos los
+ *          hilos deben llamarla la misma cantidad de veces. Ningún hilo sale de
+ *          la barrera hasta que todos llegaron a ella.
+ */
+void barreraPool(PoolHilos *pool);
+
+/**
+ * @brief Termina los hilos y libera el pool.
+ */
+void destruirPoolHilos(PoolHilos *pool);
+
+/**
+ * @brief Devuelve la cantidad de núcleos disponibles (al menos 1).
+ */
+int numNucleosDisponibles(void);
+
+/**
+ * @brief Reparte n elementos en bloques contiguos: el hilo id recibe [*inicio, *fin).
+ */
+static inline void rangoHilo(int n, int id_hilo, int num_hilos, int *inicio, int *fin)
+{
+    int base = n / num_hilos;
+    int resto = n % num_hilos;
+    *inicio = id_hilo * base + (id_hilo < resto ? id_hilo : resto);
+    *fin = *inicio + base + (id_hilo < resto ? 1 : 0);
+}
+
+#endif // POOL_HILOS_H
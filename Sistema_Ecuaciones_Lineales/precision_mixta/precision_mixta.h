@@ -0,0 +1,90 @@
+/**
+ * @file precision_mixta.h
+ * @brief Solver de precisión mixta: factorización LU en float y refinamiento iterativo en double.
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * La factorización LU es la parte O(n³) del trabajo y está limitada por cuánto
+ * dato cabe en los registros SIMD y en la caché: en float entran el doble de
+ * elementos que en double, así que factorizar en float cuesta aproximadamente la
+ * mitad. La solución obtenida sólo tiene ~7 cifras correctas, pero se puede
+ * corregir con refinamiento iterativo:
+ *
+ *   r = b - A*x          (en double, con la A original)
+ *   resolver L*U*d = P*r (con los factores en float, O(n²))
+ *   x = x + d
+ *
+ * Cada paso gana unas -log10(κ(A)·eps_float) cifras, de modo que si κ(A) es
+ * bastante menor que 1/eps_float ≈ 1e7, en pocos pasos x tiene precisión de
+ * double. Si la matriz está peor condicionada el refinamiento se estanca y
+ * conviene factorizarLU() en double.
+ */
+#ifndef PRECISION_MIXTA_H
+#define PRECISION_MIXTA_H
+
+#include "../matriz_densa/matriz_densa.h"
+#include "../factorizacion_lu/factorizacion_lu.h"
+
+/**
+ * @brief Factores de P*A = L*U guardados en float.
+ * @details Mismo formato que FactorizacionLU, con las filas en un bloque contiguo
+ *          alineado a ALINEACION_MATRIZ bytes (stride múltiplo de 16 floats).
+ */
+typedef struct
+{
+    int n;            // Tamaño de la matriz
+    int stride;       // Distancia (en floats) entre el inicio de dos filas
+    float *LU;        // L (debajo de la diagonal, diagonal unitaria implícita) y U
+    int *pivotes;     // En el paso k se intercambió la fila k con la fila pivotes[k]
+} FactorizacionLUSimple;
+
+/**
+ * @brief Factoriza A (n x n) en precisión simple como P*A = L*U, por bloques.
+ * @details Mismo algoritmo que factorizarLU() (panel, U12 y complemento de Schur
+ *          por mosaicos) sobre una copia de A convertida a float.
+ * @param A Matriz de coeficientes (no se modifica).
+ * @param F Factorización (salida). Debe liberarse con liberarFactorizacionLUSimple(),
+ *          también cuando se devuelve un error.
+ * @param tam_bloque Columnas por panel (<= 0 usa TAM_BLOQUE_LU).
+ * @return SOLVER_OK, SOLVER_SINGULAR, SOLVER_DIVERGE (algún elemento de A no
+ *         entra en el rango de float) o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver factorizarLUSimple(const MatrizDensa *A, FactorizacionLUSimple *F, int tam_bloque);
+
+/**
+ * @brief Resuelve A*x = b con los factores en float (O(n²)).
+ * @details Las sustituciones se acumulan en double; sólo los factores son float.
+ * @param b Vector de términos independientes (no se modifica).
+ * @param x Solución (salida). Puede ser el mismo puntero que b.
+ */
+void resolverLUSimple(const FactorizacionLUSimple *F, const double *b, double *x);
+
+/**
+ * @brief Libera la memoria de la factorización.
+ */
+void liberarFactorizacionLUSimple(FactorizacionLUSimple *F);
+
+/**
+ * @brief Resuelve A*x = b factorizando en float y refinando la solución en double.
+ * @details La convergencia se mide con el error hacia atrás normalizado
+ *
+ *            ||b - A x||∞ / (||A||∞ ||x||∞ + ||b||∞)
+ *
+ *          que no depende de la escala del sistema. Se detiene cuando es menor o
+ *          igual que param->tolerancia, o cuando un paso no lo reduce al menos a
+ *          la mitad (estancamiento: la tolerancia es menor que lo alcanzable en
+ *          double o A está demasiado mal condicionada para la factorización en
+ *          float). param->omega no se usa.
+ * @param A Matriz n x n (no se modifica).
+ * @param b Vector de términos independientes (no se modifica).
+ * @param x Solución (salida). Al terminar contiene la última aproximación calculada.
+ * @param param Tolerancia (p. ej. 1e-14) y máximo de pasos de refinamiento.
+ * @param res Si no es NULL, recibe los pasos de refinamiento realizados y el
+ *            error hacia atrás final.
+ * @return SOLVER_OK, SOLVER_MAX_ITER, SOLVER_DIVERGE (estancamiento o A fuera
+ *         del rango de float), SOLVER_SINGULAR o SOLVER_ERROR_MEMORIA.
+ */
+EstadoSolver resolverPrecisionMixta(const MatrizDensa *A, const double *b, double *x,
+                                    const ParametrosIterativos *param, ResultadoIterativo *res);
+
+#endif // PRECISION_MIXTA_H
@@ -0,0 +1,242 @@
+/**
+ * @file sistemas_por_lotes.c
+ * @brief Implementación de la eliminación de Gauss por lotes (estructura de arreglos).
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * resolverGrupo() resuelve un grupo de ANCHO_LOTE sistemas. Sus bucles internos
+ * recorren el índice de sistema s, con trip count fijo ANCHO_LOTE y sin
+ * dependencias entre sistemas, que es justo lo que el vectorizador necesita.
+ * Las versiones para n fijo se generan con DEFINIR_RESOLVER_GRUPO(N): al llamar
+ * a resolverGrupo() con una constante, el compilador conoce todos los límites de
+ * los bucles sobre filas y columnas y los desenrolla.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sistemas_por_lotes.h"
+
+#if defined(__GNUC__)
+#define SIEMPRE_EN_LINEA inline __attribute__((always_inline))
+#else
+#define SIEMPRE_EN_LINEA inline
+#endif
+
+int crearLoteSistemas(LoteSistemas *L, int n, int cantidad)
+{
+    memset(L, 0, sizeof(LoteSistemas));
+    if (n <= 0 || cantidad <= 0)
+        return 1;
+
+    int stride = (cantidad + ANCHO_LOTE - 1) / ANCHO_LOTE * ANCHO_LOTE;
+    size_t elementos_A = (size_t)n * n * stride;
+    size_t elementos_b = (size_t)n * stride;
+
+    L->A = (double *)reservarAlineado(elementos_A * sizeof(double));
+    L->b = (double *)reservarAlineado(elementos_b * sizeof(double));
+    L->x = (double *)reservarAlineado(elementos_b * sizeof(double));
+    L->singular = (unsigned char *)calloc((size_t)cantidad, 1);
+    if (L->A == NULL || L->b == NULL || L->x == NULL || L->singular == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para el lote de %d sistemas.\n", cantidad);
+        liberarLoteSistemas(L);
+        return 1;
+    }
+    memset(L->A, 0, elementos_A * sizeof(double));
+    memset(L->b, 0, elementos_b * sizeof(double));
+    memset(L->x, 0, elementos_b * sizeof(double));
+
+    L->n = n;
+    L->cantidad = cantidad;
+    L->stride = stride;
+
+    // Sistemas de relleno: identidad
+    for (int s = cantidad; s < stride; s++)
+        for (int i = 0; i < n; i++)
+            LOTE_A(L, s, i, i) = 1.0;
+    return 0;
+}
+
+void liberarLoteSistemas(LoteSistemas *L)
+{
+    liberarAlineado(L->A);
+    liberarAlineado(L->b);
+    liberarAlineado(L->x);
+    free(L->singular);
+    memset(L, 0, sizeof(LoteSistemas));
+}
+
+/**
+ * @brief Resuelve los ANCHO_LOTE sistemas que empiezan en s0.
+ * @param N Tamaño de los sistemas (constante en las versiones especializadas).
+ * @param a Área de trabajo de N*N*ANCHO_LOTE doubles.
+ * @param v Área de trabajo de N*ANCHO_LOTE doubles.
+ * @param inversa Área de trabajo de N*ANCHO_LOTE doubles (1/pivote de cada fila).
+ * @return Cantidad de sistemas singulares del grupo.
+ */
+static SIEMPRE_EN_LINEA int resolverGrupo(const int N, LoteSistemas *L, int s0,
+                                          double *restrict a, double *restrict v,
+                                          double *restrict inversa)
+{
+    const int W = ANCHO_LOTE;
+    const double *A_grupo = L->A + (size_t)s0 * N * N;
+    const double *b_grupo = L->b + (size_t)s0 * N;
+    double *x_grupo = L->x + (size_t)s0 * N;
+
+    // Copiar el grupo al área de trabajo (A y b del lote no se modifican)
+    memcpy(a, A_grupo, (size_t)N * N * W * sizeof(double));
+    memcpy(v, b_grupo, (size_t)N * W * sizeof(double));
+
+    double det[ANCHO_LOTE];
+    for (int s = 0; s < W; s++)
+        det[s] = 1.0;
+
+    // La fila i del grupo es a[i*N*W .. (i+1)*N*W); el elemento j de esa fila, para
+    // el sistema s, está en fila[j*W + s]. En la eliminación, los punteros restrict
+    // a filas distintas le permiten al compilador vectorizar sin comprobar solapamientos.
+    for (int k = 0; k < N; k++)
+    {
+        double *fila_k = a + (size_t)k * N * W;
+
+        // Fila pivote de cada sistema. Se guarda como double para que la
+        // comparación y la selección usen registros del mismo ancho que los datos.
+        double fila_pivote[ANCHO_LOTE];
+        double maximo[ANCHO_LOTE];
+        for (int s = 0; s < W; s++)
+        {
+            fila_pivote[s] = k;
+            maximo[s] = fabs(fila_k[k * W + s]);
+        }
+        for (int r = k + 1; r < N; r++)
+        {
+            const double *fila_r = a + (size_t)r * N * W;
+            const double indice = r;
+            for (int s = 0; s < W; s++)
+            {
+                double t = fabs(fila_r[k * W + s]);
+                int mayor = t > maximo[s];
+                fila_pivote[s] = mayor ? indice : fila_pivote[s];
+                maximo[s] = mayor ? t : maximo[s];
+            }
+        }
+
+        // Intercambio sin saltos: cada sistema intercambia la fila k con su fila
+        // pivote (consigo misma si el pivote ya es k)
+        for (int s = 0; s < W; s++)
+        {
+            int p = (int)fila_pivote[s];
+            double *fila_p = a + (size_t)p * N * W;
+            for (int j = k; j < N; j++)
+            {
+                double t = fila_k[j * W + s];
+                fila_k[j * W + s] = fila_p[j * W + s];
+                fila_p[j * W + s] = t;
+            }
+            double t = v[k * W + s];
+            v[k * W + s] = v[p * W + s];
+            v[p * W + s] = t;
+        }
+
+        // Un pivote nulo da inversa 0 (el sistema se marcará singular) en lugar de NaN
+        for (int s = 0; s < W; s++)
+        {
+            double p = fila_k[k * W + s];
+            det[s] *= p;
+            inversa[k * W + s] = (p != 0.0) ? 1.0 / p : 0.0;
+        }
+
+        const double *restrict pivote = fila_k;
+        for (int r = k + 1; r < N; r++)
+        {
+            double *restrict fila_r = a + (size_t)r * N * W;
+            double factor[ANCHO_LOTE];
+            for (int s = 0; s < W; s++)
+                factor[s] = fila_r[k * W + s] * inversa[k * W + s];
+            for (int j = k + 1; j < N; j++)
+                for (int s = 0; s < W; s++)
+                    fila_r[j * W + s] -= factor[s] * pivote[j * W + s];
+            for (int s = 0; s < W; s++)
+                v[r * W + s] -= factor[s] * v[k * W + s];
+        }
+    }
+
+    // Retrosustitución sobre v (v_i pasa a ser x_i) y copia de x al lote
+    for (int i = N - 1; i >= 0; i--)
+    {
+        const double *restrict fila_i = a + (size_t)i * N * W;
+        double suma[ANCHO_LOTE];
+        for (int s = 0; s < W; s++)
+            suma[s] = v[i * W + s];
+        for (int j = i + 1; j < N; j++)
+            for (int s = 0; s < W; s++)
+                suma[s] -= fila_i[j * W + s] * v[j * W + s];
+        for (int s = 0; s < W; s++)
+            v[i * W + s] = suma[s] * inversa[i * W + s];
+    }
+    memcpy(x_grupo, v, (size_t)N * W * sizeof(double));
+
+    int singulares = 0;
+    for (int s = 0; s < W && s0 + s < L->cantidad; s++)
+    {
+        L->singular[s0 + s] = fabs(det[s]) < 1e-12;
+        singulares += L->singular[s0 + s];
+    }
+    return singulares;
+}
+
+/* Genera resolverGrupoN(): resolverGrupo() con N constante y área de trabajo en la pila */
+#define DEFINIR_RESOLVER_GRUPO(N)                                                   \
+    static int resolverGrupo##N(LoteSistemas *L, int s0)                            \
+    {                                                                               \
+        double a[(N) * (N) * ANCHO_LOTE];                                           \
+        double v[(N) * ANCHO_LOTE];                                                 \
+        double inversa[(N) * ANCHO_LOTE];                                           \
+        return resolverGrupo(N, L, s0, a, v, inversa);                              \
+    }
+
+DEFINIR_RESOLVER_GRUPO(2)
+DEFINIR_RESOLVER_GRUPO(3)
+DEFINIR_RESOLVER_GRUPO(4)
+DEFINIR_RESOLVER_GRUPO(5)
+DEFINIR_RESOLVER_GRUPO(6)
+DEFINIR_RESOLVER_GRUPO(7)
+DEFINIR_RESOLVER_GRUPO(8)
+
+typedef int (*ResolverGrupoFijo)(LoteSistemas *L, int s0);
+
+int resolverLoteSistemas(LoteSistemas *L)
+{
+    static const ResolverGrupoFijo especializados[MAX_N_ESPECIALIZADO + 1] = {
+        NULL, NULL, resolverGrupo2, resolverGrupo3, resolverGrupo4,
+        resolverGrupo5, resolverGrupo6, resolverGrupo7, resolverGrupo8
+    };
+
+    int singulares = 0;
+    int n = L->n;
+
+    if (n <= MAX_N_ESPECIALIZADO && especializados[n] != NULL)
+    {
+        ResolverGrupoFijo resolver = especializados[n];
+        for (int s0 = 0; s0 < L->stride; s0 += ANCHO_LOTE)
+            singulares += resolver(L, s0);
+        return singulares;
+    }
+
+    // Versión genérica: una sola reserva del área de trabajo para todo el lote
+    double *trabajo = (double *)malloc((size_t)(n * n + 2 * n) * ANCHO_LOTE * sizeof(double));
+    if (trabajo == NULL)
+    {
+        fprintf(stderr, "[ERROR] No se pudo asignar memoria para resolver el lote.\n");
+        for (int s = 0; s < L->cantidad; s++)
+            L->singular[s] = 1;
+        return L->cantidad;
+    }
+    double *a = trabajo;
+    double *v = a + (size_t)n * n * ANCHO_LOTE;
+    double *inversa = v + (size_t)n * ANCHO_LOTE;
+    for (int s0 = 0; s0 < L->stride; s0 += ANCHO_LOTE)
+        singulares += resolverGrupo(n, L, s0, a, v, inversa);
+    free(trabajo);
+    return singulares;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file sistemas_por_lotes.h
+ * @brief Resolución simultánea de muchos sistemas pequeños e independientes (n = 2..8).
+ * @author Tobias Funes
+ * @version 1.0
+ *
+ * Resolver cientos de miles de sistemas de 3x3 a 8x8 de a uno (como gaussPivot())
+ * gasta más tiempo en reservar memoria y en saltos que en cuentas. Aquí todos los
+ * sistemas de un lote tienen el mismo n y se guardan como "estructura de arreglos"
+ * por grupos de ANCHO_LOTE sistemas: dentro de un grupo g, el mismo coeficiente
+ * a_ij de sus ANCHO_LOTE sistemas queda contiguo en memoria,
+ *
+ *   A[((g*n + i)*n + j)*ANCHO_LOTE + l]  = a_ij del sistema s = g*ANCHO_LOTE + l
+ *   b[(g*n + i)*ANCHO_LOTE + l]          = b_i  del sistema s
+ *
+ * (usar las macros LOTE_A, LOTE_B y LOTE_X), de modo que cada paso de la
+ * eliminación se aplica a ANCHO_LOTE sistemas a la vez con el mismo código, y el
+ * compilador lo traduce a instrucciones SIMD que recorren sistemas distintos en
+ * cada posición del registro. Cada grupo ocupa un bloque contiguo, así que el
+ * lote se recorre de forma secuencial.
+ *
+ * Para n = 2..8 el algoritmo se genera con n fijo en tiempo de compilación (los
+ * bucles sobre filas y columnas se desenrollan); para otros n se usa una versión
+ * genérica.
+ *
+ * Compilar con -O3 (y, si se desea, -march=native) para que se vectorice.
+ */
+#ifndef SISTEMAS_POR_LOTES_H
+#define SISTEMAS_POR_LOTES_H
+
+#include "../matriz_densa/matriz_densa.h"
+
+/**
+ * @brief Sistemas que se procesan juntos (un registro AVX-512 de double, o dos AVX2).
+ */
+#define ANCHO_LOTE 8
+
+/**
+ * @brief Mayor n con versión especializada en tiempo de compilación.
+ */
+#define MAX_N_ESPECIALIZADO 8
+
+/**
+ * @brief Lote de sistemas n x n en formato estructura de arreglos.
+ */
+typedef struct
+{
+    int n;                      // Tamaño de cada sistema
+    int cantidad;               // Cantidad de sistemas
+    int stride;                 // cantidad redondeada a múltiplo de ANCHO_LOTE
+    double *A;                  // n*n*stride coeficientes, agrupados como se explica arriba
+    double *b;                  // n*stride términos independientes
+    double *x;                  // n*stride soluciones (salida)
+    unsigned char *singular;    // cantidad indicadores: 1 si el sistema es singular (salida)
+} LoteSistemas;
+
+/* Acceso al elemento (i, j) del sistema s */
+#define LOTE_A(L, s, i, j) \
+    ((L)->A[(((size_t)(s) / ANCHO_LOTE * (L)->n + (i)) * (L)->n + (j)) * ANCHO_LOTE + (s) % ANCHO_LOTE])
+#define LOTE_B(L, s, i) \
+    ((L)->b[((size_t)(s) / ANCHO_LOTE * (L)->n + (i)) * ANCHO_LOTE + (s) % ANCHO_LOTE])
+#define LOTE_X(L, s, i) \
+    ((L)->x[((size_t)(s) / ANCHO_LOTE * (L)->n + (i)) * ANCHO_LOTE + (s) % ANCHO_LOTE])
+
+/**
+ * @brief Reserva un lote de cantidad sistemas de n x n (en cero).
+ * @details Los sistemas de relleno (de cantidad a stride-1) se inicializan con la
+ *          identidad para que nunca produzcan divisiones por cero.
+ * @return 0 si todo salió bien, 1 si hubo error de memoria o tamaños inválidos.
+ */
+int crearLoteSistemas(LoteSistemas *L, int n, int cantidad);
+
+/**
+ * @brief Libera la memoria del lote.
+ */
+void liberarLoteSistemas(LoteSistemas *L);
+
+/**
+ * @brief Resuelve todos los sistemas del lote con eliminación de Gauss y pivoteo parcial.
+ * @details A y b no se modifican (cada grupo de ANCHO_LOTE sistemas se copia a un
+ *          área de trabajo en la pila), así que el lote puede volver a resolverse
+ *          tras cambiar sólo algunos datos. El pivoteo se hace sin saltos: cada
+ *          sistema elige su fila pivote con selecciones condicionales y la
+ *          intercambia con la fila k siempre (consigo misma si ya es la k). Un sistema con
+ *          |det(A)| < 1e-12 se marca como singular (mismo criterio que
+ *          gaussPivotDensa()) y su x no es válida.
+ * @return Cantidad de sistemas singulares.
+ */
+int resolverLoteSistemas(LoteSistemas *L);
+
+#endif // SISTEMAS_POR_LOTES_H
@@ -0,0 +1,2516 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "matriz_densa/matriz_densa.h"
+#include "factorizacion_lu/factorizacion_lu.h"
+#include "iterativos_paralelos/iterativos_paralelos.h"
+#include "jacobi_procesos/jacobi_procesos.h"
+#include "lu_en_disco/lu_en_disco.h"
+#include "matriz_dispersa/matriz_dispersa.h"
+#include "krylov/krylov.h"
+#include "matriz_desde_archivo/matriz_desde_archivo.h"
+#include "sistemas_por_lotes/sistemas_por_lotes.h"
+#include "matriz_banda/matriz_banda.h"
+#include "precision_mixta/precision_mixta.h"
+#include "diagnostico_convergencia/diagnostico_convergencia.h"
+#include "espacio_trabajo/espacio_trabajo.h"
+#include "factorizacion_cholesky/factorizacion_cholesky.h"
+#include "nucleos_simd/nucleos_simd.h"
+#include "modo_lotes/modo_lotes.h"
+#include "../Ajuste_de_curvas/gauss_con_pivot.h"
+#include "../Ajuste_de_curvas/lagrange_baricentrico.h"
+#include "../Ajuste_de_curvas/newton_diferencias.h"
+#include "../Ajuste_de_curvas/spline_cubico.h"
+#include "../Ajuste_de_curvas/remuestreo_spline.h"
+
+/* ============================================================================
+   PROGRAMA DE PRUEBAS - SISTEMAS DE ECUACIONES LINEALES
+   ============================================================================
+
+   Prueba los solvers de la librería (matriz densa contigua) comparando la
+   solución obtenida contra el residuo ||A*x - b|| y contra soluciones conocidas.
+
+   Compilación (desde Sistema_Ecuaciones_Lineales):
+     gcc -O2 test_sistemas.c matriz_densa/matriz_densa.c \
+         factorizacion_lu/factorizacion_lu.c pool_hilos/pool_hilos.c \
+         iterativos_paralelos/iterativos_paralelos.c jacobi_procesos/jacobi_procesos.c \
+         matriz_dispersa/matriz_dispersa.c krylov/krylov.c matriz_desde_archivo/matriz_desde_archivo.c \
+         sistemas_por_lotes/sistemas_por_lotes.c matriz_banda/matriz_banda.c \
+         precision_mixta/precision_mixta.c diagnostico_convergencia/diagnostico_convergencia.c \
+         espacio_trabajo/espacio_trabajo.c factorizacion_cholesky/factorizacion_cholesky.c \
+         lu_en_disco/lu_en_disco.c nucleos_simd/nucleos_simd.c modo_lotes/modo_lotes.c \
+         ../Ajuste_de_curvas/gauss_con_pivot.c ../Ajuste_de_curvas/lagrange_baricentrico.c \
+         ../Ajuste_de_curvas/newton_diferencias.c ../Ajuste_de_curvas/spline_cubico.c \
+         ../Ajuste_de_curvas/remuestreo_spline.c -o test_sistemas.o -lm -pthread
+   ============================================================================ */
+
+static int pruebas_fallidas = 0;
+
+void imprimir_linea() {
+    printf("========================================================================\n");
+}
+
+void verificar(const char *descripcion, int condicion) {
+    printf("  %s %s\n", condicion ? "✓" : "✗", descripcion);
+    if (!condicion) pruebas_fallidas++;
+}
+
+/* Norma infinito del residuo b - A*x */
+double residuo_max(const MatrizDensa *A, const double *b, const double *x) {
+    double maximo = 0.0;
+    for (int i = 0; i < A->filas; i++) {
+        double suma = b[i];
+        for (int j = 0; j < A->columnas; j++)
+            suma -= MD(A, i, j) * x[j];
+        if (fabs(suma) > maximo) maximo = fabs(suma);
+    }
+    return maximo;
+}
+
+/* Genera una matriz diagonalmente dominante con solución exacta x = (1, 2, ..., n) */
+void generar_diagonal_dominante(MatrizDensa *A, double *b, int n, unsigned semilla) {
+    srand(semilla);
+    crearMatrizDensa(A, n, n);
+    for (int i = 0; i < n; i++) {
+        double suma = 0.0;
+        for (int j = 0; j < n; j++) {
+            if (i == j) continue;
+            MD(A, i, j) = (double)rand() / RAND_MAX - 0.5;
+            suma += fabs(MD(A, i, j));
+        }
+        MD(A, i, i) = suma + 1.0;
+    }
+    for (int i = 0; i < n; i++) {
+        b[i] = 0.0;
+        for (int j = 0; j < n; j++)
+            b[i] += MD(A, i, j) * (j + 1);
+    }
+}
+
+/* Genera una matriz tridiagonal (-1, 4, -1) con solución exacta x = (1, 2, ..., n) */
+void generar_tridiagonal(MatrizDensa *A, double *b, int n) {
+    crearMatrizDensa(A, n, n);
+    for (int i = 0; i < n; i++) {
+        MD(A, i, i) = 4.0;
+        if (i > 0) MD(A, i, i - 1) = -1.0;
+        if (i < n - 1) MD(A, i, i + 1) = -1.0;
+    }
+    for (int i = 0; i < n; i++) {
+        b[i] = 4.0 * (i + 1);
+        if (i > 0) b[i] -= i;
+        if (i < n - 1) b[i] -= i + 2;
+    }
+}
+
+/* ============================================================================
+   TEST 1: MATRIZ DENSA CONTIGUA
+   ============================================================================ */
+void test_matriz_densa() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 1: MatrizDensa (bloque contiguo, alineado, con stride)\n");
+    imprimir_linea();
+
+    MatrizDensa A;
+    verificar("crearMatrizDensa(5, 3) devuelve 0", crearMatrizDensa(&A, 5, 3) == 0);
+    verificar("datos alineados a 64 bytes", ((size_t)A.datos % ALINEACION_MATRIZ) == 0);
+    verificar("stride múltiplo de 8 doubles y >= columnas", A.stride % 8 == 0 && A.stride >= 3);
+    verificar("filas consecutivas separadas por stride",
+              filaMatrizDensa(&A, 1) - filaMatrizDensa(&A, 0) == A.stride);
+    liberarMatrizDensa(&A);
+    verificar("liberarMatrizDensa deja la matriz vacía", A.datos == NULL && A.filas == 0);
+
+    double fila0[] = {4, 1, 1};
+    double fila1[] = {1, 5, 1};
+    double fila2[] = {1, 1, 4};
+    double *punteros[] = {fila0, fila1, fila2};
+    matrizDensaDesdePunteros(&A, punteros, 3, 3);
+    verificar("conversión desde double** conserva los elementos",
+              MD(&A, 0, 0) == 4 && MD(&A, 1, 1) == 5 && MD(&A, 2, 0) == 1);
+    liberarMatrizDensa(&A);
+}
+
+/* ============================================================================
+   TEST 2: MÉTODOS DIRECTOS
+   ============================================================================ */
+void test_metodos_directos() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 2: Eliminación de Gauss y gaussPivot sobre MatrizDensa\n");
+    imprimir_linea();
+
+    int n = 50;
+    MatrizDensa A, copia;
+    double *b = malloc(n * sizeof(double));
+    double *b_copia = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+
+    generar_diagonal_dominante(&A, b, n, 1);
+    copiarMatrizDensa(&copia, &A);
+    for (int i = 0; i < n; i++) b_copia[i] = b[i];
+
+    double det = 0.0;
+    EstadoSolver estado = eliminacionGaussDensa(&copia, b_copia, x, &det);
+    verificar("eliminacionGaussDensa resuelve el sistema", estado == SOLVER_OK);
+    verificar("residuo de Gauss < 1e-10", residuo_max(&A, b, x) < 1e-10);
+    printf("    det(A) = %.6e\n", det);
+
+    liberarMatrizDensa(&copia);
+    copiarMatrizDensa(&copia, &A);
+    for (int i = 0; i < n; i++) b_copia[i] = b[i];
+    verificar("gaussPivotDensa resuelve el sistema", gaussPivotDensa(&copia, b_copia, x) == 0);
+    verificar("residuo de gaussPivotDensa < 1e-10", residuo_max(&A, b, x) < 1e-10);
+
+    // Matriz singular: dos filas iguales
+    MatrizDensa S;
+    crearMatrizDensa(&S, 2, 2);
+    MD(&S, 0, 0) = 1; MD(&S, 0, 1) = 2;
+    MD(&S, 1, 0) = 2; MD(&S, 1, 1) = 4;
+    double bs[2] = {1, 2};
+    verificar("matriz singular detectada", eliminacionGaussDensa(&S, bs, x, NULL) == SOLVER_SINGULAR);
+
+    liberarMatrizDensa(&S);
+    liberarMatrizDensa(&A);
+    liberarMatrizDensa(&copia);
+    free(b); free(b_copia); free(x);
+}
+
+/* ============================================================================
+   TEST 3: MÉTODOS ITERATIVOS
+   ============================================================================ */
+void test_metodos_iterativos() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 3: Jacobi y Gauss-Seidel (SOR) sobre MatrizDensa\n");
+    imprimir_linea();
+
+    int n = 100;
+    MatrizDensa A;
+    double *b = malloc(n * sizeof(double));
+    double *x = calloc(n, sizeof(double));
+    ParametrosIterativos param = { 1e-12, 10000, 1.0 };
+    ResultadoIterativo res;
+
+    generar_diagonal_dominante(&A, b, n, 2);
+
+    EstadoSolver estado = jacobiDensa(&A, b, x, &param, &res);
+    printf("    Jacobi: %d iteraciones, error %.3e\n", res.iteraciones, res.error);
+    verificar("Jacobi converge", estado == SOLVER_OK);
+    verificar("residuo de Jacobi < 1e-9", residuo_max(&A, b, x) < 1e-9);
+
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    estado = gaussSeidelDensa(&A, b, x, &param, &res);
+    printf("    Gauss-Seidel: %d iteraciones, error %.3e\n", res.iteraciones, res.error);
+    verificar("Gauss-Seidel converge", estado == SOLVER_OK);
+    verificar("residuo de Gauss-Seidel < 1e-9", residuo_max(&A, b, x) < 1e-9);
+
+    param.omega = 1.1;
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    estado = gaussSeidelDensa(&A, b, x, &param, &res);
+    printf("    SOR (omega = 1.1): %d iteraciones, error %.3e\n", res.iteraciones, res.error);
+    verificar("SOR converge", estado == SOLVER_OK);
+
+    liberarMatrizDensa(&A);
+    free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 4: FACTORIZACIÓN LU POR BLOQUES
+   ============================================================================ */
+void test_factorizacion_lu() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 4: Factorización LU por bloques (factorizar una vez, resolver muchas)\n");
+    imprimir_linea();
+
+    int n = 150; // No es múltiplo del bloque: prueba el panel final incompleto
+    MatrizDensa A;
+    FactorizacionLU F;
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+
+    generar_diagonal_dominante(&A, b, n, 3);
+    // Romper la dominancia diagonal para forzar intercambios de filas
+    for (int i = 0; i < n; i++) MD(&A, i, i) *= 0.01;
+    for (int i = 0; i < n; i++) {
+        b[i] = 0.0;
+        for (int j = 0; j < n; j++) b[i] += MD(&A, i, j) * (j + 1);
+    }
+
+    verificar("factorizarLU (bloque 32) devuelve SOLVER_OK", factorizarLU(&A, &F, 32) == SOLVER_OK);
+    resolverLU(&F, b, x);
+    double error_max = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - (i + 1)) > error_max) error_max = fabs(x[i] - (i + 1));
+    printf("    max |x_i - x_exacto_i| = %.3e\n", error_max);
+    verificar("resolverLU recupera la solución exacta", error_max < 1e-8);
+
+    // Varios términos independientes con la misma factorización
+    int m = 5;
+    MatrizDensa B;
+    crearMatrizDensa(&B, n, m);
+    for (int c = 0; c < m; c++)
+        for (int i = 0; i < n; i++)
+            MD(&B, i, c) = b[i] * (c + 1);
+    resolverLUMultiple(&F, &B);
+    error_max = 0.0;
+    for (int c = 0; c < m; c++)
+        for (int i = 0; i < n; i++)
+            if (fabs(MD(&B, i, c) - (c + 1) * (i + 1)) > error_max)
+                error_max = fabs(MD(&B, i, c) - (c + 1) * (i + 1));
+    verificar("resolverLUMultiple resuelve 5 sistemas a la vez", error_max < 1e-7);
+
+    // Misma factorización con bloque 1 (sin bloques) y con bloque mayor que n
+    FactorizacionLU F1, F2;
+    factorizarLU(&A, &F1, 1);
+    factorizarLU(&A, &F2, 1000);
+    double diferencia = 0.0;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++) {
+            double d1 = fabs(MD(&F.LU, i, j) - MD(&F1.LU, i, j));
+            double d2 = fabs(MD(&F.LU, i, j) - MD(&F2.LU, i, j));
+            if (d1 > diferencia) diferencia = d1;
+            if (d2 > diferencia) diferencia = d2;
+        }
+    verificar("el resultado no depende del tamaño de bloque", diferencia < 1e-10);
+
+    liberarFactorizacionLU(&F);
+    liberarFactorizacionLU(&F1);
+    liberarFactorizacionLU(&F2);
+    liberarMatrizDensa(&B);
+    liberarMatrizDensa(&A);
+    free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 5: JACOBI MULTIHILO
+   ============================================================================ */
+void test_jacobi_paralelo() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 5: Jacobi multihilo (pool de hilos + reducción del error)\n");
+    imprimir_linea();
+
+    int n = 300;
+    MatrizDensa A;
+    double *b = malloc(n * sizeof(double));
+    double *x1 = calloc(n, sizeof(double));
+    double *x4 = calloc(n, sizeof(double));
+    ParametrosIterativos param = { 1e-12, 10000, 1.0 };
+    ResultadoIterativo r1, r4;
+
+    generar_diagonal_dominante(&A, b, n, 4);
+
+    EstadoSolver e1 = jacobiParalelo(&A, b, x1, &param, 1, &r1);
+    EstadoSolver e4 = jacobiParalelo(&A, b, x4, &param, 4, &r4);
+    printf("    1 hilo: %d iteraciones | 4 hilos: %d iteraciones\n", r1.iteraciones, r4.iteraciones);
+    verificar("Jacobi multihilo converge", e1 == SOLVER_OK && e4 == SOLVER_OK);
+    verificar("residuo < 1e-9", residuo_max(&A, b, x4) < 1e-9);
+
+    int iguales = (r1.iteraciones == r4.iteraciones);
+    for (int i = 0; i < n; i++)
+        if (x1[i] != x4[i]) iguales = 0;
+    verificar("resultado idéntico con 1 y 4 hilos", iguales);
+
+    // Mismas iteraciones que jacobiDensa, bit a bit (15 < 2*VENTANA_CONVERGENCIA:
+    // ambos hacen exactamente max_iter iteraciones con tolerancia 0)
+    ParametrosIterativos fijas = { 0.0, 15, 1.0 };
+    double *x_densa = calloc(n, sizeof(double));
+    for (int i = 0; i < n; i++) x4[i] = 0.0;
+    EstadoSolver e_densa = jacobiDensa(&A, b, x_densa, &fijas, &r1);
+    e4 = jacobiParalelo(&A, b, x4, &fijas, 4, &r4);
+    iguales = (e_densa == SOLVER_MAX_ITER && e4 == SOLVER_MAX_ITER && r1.iteraciones == 15 && r4.iteraciones == 15);
+    for (int i = 0; i < n; i++)
+        if (x_densa[i] != x4[i]) iguales = 0;
+    verificar("15 iteraciones idénticas a jacobiDensa (bit a bit)", iguales);
+
+    liberarMatrizDensa(&A);
+    free(b); free(x1); free(x4); free(x_densa);
+}
+
+/* ============================================================================
+   TEST 6: GAUSS-SEIDEL MULTICOLOR (ROJO-NEGRO) Y SSOR
+   ============================================================================ */
+void test_gauss_seidel_multicolor() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 6: Gauss-Seidel multicolor (rojo-negro), SOR y SSOR\n");
+    imprimir_linea();
+
+    int n = 200;
+    MatrizDensa A;
+    double *b = malloc(n * sizeof(double));
+    double *x = calloc(n, sizeof(double));
+    double *x4 = calloc(n, sizeof(double));
+    int *colores = malloc(n * sizeof(int));
+    ParametrosIterativos param = { 1e-12, 10000, 1.0 };
+    ResultadoIterativo r, r4;
+
+    generar_tridiagonal(&A, b, n);
+    int num_colores = colorearFilas(&A, colores);
+    printf("    Colores de una matriz tridiagonal: %d\n", num_colores);
+    verificar("una tridiagonal se colorea rojo-negro (2 colores)", num_colores == 2);
+    verificar("filas vecinas con distinto color", colores[0] != colores[1] && colores[1] != colores[2]);
+
+    EstadoSolver e = gaussSeidelMulticolor(&A, b, x, &param, 0, 1, &r);
+    printf("    Gauss-Seidel rojo-negro: %d iteraciones\n", r.iteraciones);
+    verificar("Gauss-Seidel multicolor converge", e == SOLVER_OK);
+    verificar("residuo < 1e-9", residuo_max(&A, b, x) < 1e-9);
+
+    e = gaussSeidelMulticolor(&A, b, x4, &param, 0, 4, &r4);
+    int iguales = (e == SOLVER_OK && r.iteraciones == r4.iteraciones);
+    for (int i = 0; i < n; i++)
+        if (x[i] != x4[i]) iguales = 0;
+    verificar("resultado idéntico con 1 y 4 hilos", iguales);
+
+    param.omega = 1.05;
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    e = gaussSeidelMulticolor(&A, b, x, &param, 0, 4, &r);
+    printf("    SOR rojo-negro (omega = 1.05): %d iteraciones\n", r.iteraciones);
+    verificar("SOR multicolor converge", e == SOLVER_OK && residuo_max(&A, b, x) < 1e-9);
+
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    e = gaussSeidelMulticolor(&A, b, x, &param, 1, 4, &r);
+    printf("    SSOR rojo-negro (omega = 1.05): %d iteraciones\n", r.iteraciones);
+    verificar("SSOR multicolor converge", e == SOLVER_OK && residuo_max(&A, b, x) < 1e-9);
+
+    liberarMatrizDensa(&A);
+    free(b); free(x); free(x4); free(colores);
+}
+
+/* ============================================================================
+   TEST 7: MATRIZ DISPERSA CSR Y LECTOR MATRIX MARKET
+   ============================================================================ */
+void test_matriz_dispersa() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 7: Matriz dispersa CSR, Matrix Market, Jacobi y Gauss-Seidel\n");
+    imprimir_linea();
+
+    // Laplaciano 2D de 5 puntos (diagonal 5 para que Jacobi converja rápido)
+    // en una grilla m x m, escrito como Matrix Market simétrico (triángulo inferior)
+    int m = 40;
+    int n = m * m;
+    const char *archivo = "prueba_matriz_dispersa.mtx";
+    FILE *f = fopen(archivo, "w");
+    fprintf(f, "%%%%MatrixMarket matrix coordinate real symmetric\n");
+    fprintf(f, "%% Laplaciano 2D de prueba\n");
+    fprintf(f, "%d %d %d\n", n, n, n + 2 * m * (m - 1));
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            fprintf(f, "%d %d 5.0\n", k + 1, k + 1);
+            if (j > 0) fprintf(f, "%d %d -1.0\n", k + 1, k);
+            if (i > 0) fprintf(f, "%d %d -1.0\n", k + 1, k - m + 1);
+        }
+    fclose(f);
+
+    MatrizCSR A;
+    verificar("leerMatrixMarket lee el archivo", leerMatrixMarket(archivo, &A) == 0);
+    remove(archivo);
+    printf("    n = %d, nnz = %d (densidad %.3f%%)\n", A.filas, A.nnz, 100.0 * A.nnz / ((double)n * n));
+    verificar("se completó el triángulo superior (nnz = n + 4m(m-1))", A.nnz == n + 4 * m * (m - 1));
+
+    int ordenadas = 1;
+    for (int i = 0; i < n; i++)
+        for (int k = A.inicio_fila[i] + 1; k < A.inicio_fila[i + 1]; k++)
+            if (A.columna[k] <= A.columna[k - 1]) ordenadas = 0;
+    verificar("columnas ordenadas y sin repetidos en cada fila", ordenadas);
+
+    // b = A * (1, 2, ..., n)
+    double *exacta = malloc(n * sizeof(double));
+    double *b = malloc(n * sizeof(double));
+    double *x = calloc(n, sizeof(double));
+    for (int i = 0; i < n; i++) exacta[i] = i + 1;
+    productoCSRVector(&A, exacta, b);
+
+    ParametrosIterativos param = { 1e-10, 10000, 1.0 };
+    ResultadoIterativo r;
+    EstadoSolver e = jacobiCSR(&A, b, x, &param, &r);
+    double error_max = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) > error_max) error_max = fabs(x[i] - exacta[i]);
+    printf("    Jacobi CSR: %d iteraciones, max error %.3e\n", r.iteraciones, error_max);
+    verificar("Jacobi CSR converge a la solución", e == SOLVER_OK && error_max < 1e-8);
+
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    e = gaussSeidelCSR(&A, b, x, &param, &r);
+    error_max = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) > error_max) error_max = fabs(x[i] - exacta[i]);
+    printf("    Gauss-Seidel CSR: %d iteraciones, max error %.3e\n", r.iteraciones, error_max);
+    verificar("Gauss-Seidel CSR converge a la solución", e == SOLVER_OK && error_max < 1e-8);
+
+    // Tripletas desordenadas y repetidas
+    MatrizCSR T;
+    int fi[] = {1, 0, 1, 0, 1};
+    int co[] = {1, 0, 0, 0, 1};
+    double va[] = {2.0, 1.0, 3.0, 1.0, 2.0};
+    csrDesdeTripletas(&T, 2, 2, 5, fi, co, va);
+    verificar("tripletas repetidas se suman",
+              T.nnz == 3 && T.valor[0] == 2.0 && T.columna[1] == 0 && T.valor[2] == 4.0);
+
+    // Conversión desde densa
+    MatrizDensa D;
+    MatrizCSR C;
+    double bd[10];
+    generar_tridiagonal(&D, bd, 10);
+    csrDesdeDensa(&C, &D);
+    verificar("csrDesdeDensa guarda sólo los no nulos", C.nnz == 28);
+
+    // Archivos dañados: una entrada sin valor, y menos entradas que las declaradas
+    const char *danados[2] = {
+        "%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 4.0\n2 2\n",
+        "%%MatrixMarket matrix coordinate real general\n2 2 3\n1 1 4.0\n2 2 1.0\n"
+    };
+    int rechazados = 1;
+    for (int k = 0; k < 2; k++) {
+        f = fopen(archivo, "w");
+        fputs(danados[k], f);
+        fclose(f);
+        MatrizCSR R;
+        if (leerMatrixMarket(archivo, &R) == 0) {
+            rechazados = 0;
+            liberarMatrizCSR(&R);
+        }
+    }
+    remove(archivo);
+    verificar("leerMatrixMarket rechaza una entrada sin valor y un archivo truncado", rechazados);
+
+    liberarMatrizCSR(&A);
+    liberarMatrizCSR(&T);
+    liberarMatrizCSR(&C);
+    liberarMatrizDensa(&D);
+    free(exacta); free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 8: GRADIENTE CONJUGADO Y PRECONDICIONADORES
+   ============================================================================ */
+void test_gradiente_conjugado() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 8: Gradiente Conjugado (sin precondicionar, Jacobi, IC(0))\n");
+    imprimir_linea();
+
+    // Laplaciano 2D de 5 puntos con diagonal 4: SPD y mal condicionado (κ ~ m²)
+    int m = 50;
+    int n = m * m;
+    int capacidad = 5 * n;
+    int *fi = malloc(capacidad * sizeof(int));
+    int *co = malloc(capacidad * sizeof(int));
+    double *va = malloc(capacidad * sizeof(double));
+    int cantidad = 0;
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            fi[cantidad] = k; co[cantidad] = k; va[cantidad++] = 4.0;
+            if (j > 0)     { fi[cantidad] = k; co[cantidad] = k - 1; va[cantidad++] = -1.0; }
+            if (j < m - 1) { fi[cantidad] = k; co[cantidad] = k + 1; va[cantidad++] = -1.0; }
+            if (i > 0)     { fi[cantidad] = k; co[cantidad] = k - m; va[cantidad++] = -1.0; }
+            if (i < m - 1) { fi[cantidad] = k; co[cantidad] = k + m; va[cantidad++] = -1.0; }
+        }
+    MatrizCSR A;
+    csrDesdeTripletas(&A, n, n, cantidad, fi, co, va);
+    free(fi); free(co); free(va);
+
+    double *exacta = malloc(n * sizeof(double));
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    double *y = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) exacta[i] = sin(0.01 * i) + 1.0;
+    productoCSRVector(&A, exacta, b);
+
+    ParametrosIterativos param = { 1e-10, 20000, 1.0 };
+    ResultadoIterativo r;
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    gaussSeidelCSR(&A, b, x, &param, &r);
+    printf("    Gauss-Seidel CSR:  %5d iteraciones\n", r.iteraciones);
+    int iter_gs = r.iteraciones;
+
+    const char *nombres[] = { "ninguno", "Jacobi", "IC(0)" };
+    TipoPrecondicionador tipos[] = { PRECOND_NINGUNO, PRECOND_JACOBI, PRECOND_CHOLESKY_INCOMPLETO };
+    int iteraciones[3];
+    double *historial = malloc((param.max_iter + 1) * sizeof(double));
+    int historial_ok = 1;
+    for (int t = 0; t < 3; t++) {
+        for (int i = 0; i < n; i++) x[i] = 0.0;
+        EstadoSolver e = gradienteConjugadoCSR(&A, b, x, tipos[t], &param, &r, historial);
+        productoCSRVector(&A, x, y);
+        double residuo = 0.0, norma_b = 0.0;
+        for (int i = 0; i < n; i++) {
+            residuo += (y[i] - b[i]) * (y[i] - b[i]);
+            norma_b += b[i] * b[i];
+        }
+        residuo = sqrt(residuo / norma_b);
+        printf("    CG (%-7s):      %5d iteraciones, residuo relativo %.3e\n",
+               nombres[t], r.iteraciones, residuo);
+        if (e != SOLVER_OK || residuo > 1e-9) historial_ok = 0;
+        if (historial[r.iteraciones] != r.error || historial[0] != 1.0) historial_ok = 0;
+        iteraciones[t] = r.iteraciones;
+    }
+    verificar("CG converge con los tres precondicionadores", historial_ok);
+    verificar("CG necesita muchas menos iteraciones que Gauss-Seidel", iteraciones[0] * 5 < iter_gs);
+    verificar("IC(0) reduce las iteraciones de CG", iteraciones[2] < iteraciones[0]);
+
+    // Matriz densa SPD: ecuaciones normales de una regresión cuadrática
+    int puntos = 20, g = 3;
+    MatrizDensa N;
+    crearMatrizDensa(&N, g, g);
+    double bn[3] = {0}, xn[3] = {0};
+    for (int p = 0; p < puntos; p++) {
+        double t = (double)p / (puntos - 1);
+        double f = 1.0 - 2.0 * t + 3.0 * t * t;
+        double pot[3] = { 1.0, t, t * t };
+        for (int i = 0; i < g; i++) {
+            bn[i] += pot[i] * f;
+            for (int j = 0; j < g; j++) MD(&N, i, j) += pot[i] * pot[j];
+        }
+    }
+    param.tolerancia = 1e-14;
+    EstadoSolver e = gradienteConjugadoDensa(&N, bn, xn, PRECOND_CHOLESKY_INCOMPLETO, &param, &r, NULL);
+    printf("    Ecuaciones normales (densa, IC = Cholesky completo): %d iteraciones\n", r.iteraciones);
+    printf("    coeficientes: %.10f %.10f %.10f\n", xn[0], xn[1], xn[2]);
+    verificar("CG denso recupera los coeficientes 1, -2, 3",
+              e == SOLVER_OK && fabs(xn[0] - 1.0) < 1e-8 && fabs(xn[1] + 2.0) < 1e-8 && fabs(xn[2] - 3.0) < 1e-8);
+
+    // Una matriz no definida positiva se detecta
+    MD(&N, 0, 0) = -1.0;
+    Precondicionador P;
+    verificar("IC(0) rechaza una matriz no definida positiva",
+              crearPrecondicionadorDensa(&P, PRECOND_CHOLESKY_INCOMPLETO, &N) == SOLVER_SINGULAR);
+
+    liberarMatrizDensa(&N);
+    liberarMatrizCSR(&A);
+    free(exacta); free(b); free(x); free(y); free(historial);
+}
+
+/* Precondicionador personalizado de prueba: divide por la diagonal guardada en datos */
+static void precondicionador_diagonal(const void *datos, const double *r, double *z) {
+    const MatrizCSR *A = datos;
+    for (int i = 0; i < A->filas; i++)
+        for (int k = A->inicio_fila[i]; k < A->inicio_fila[i + 1]; k++)
+            if (A->columna[k] == i) z[i] = r[i] / A->valor[k];
+}
+
+/* ============================================================================
+   TEST 9: GMRES(m) Y BiCGSTAB PARA SISTEMAS NO SIMÉTRICOS
+   ============================================================================ */
+void test_gmres_bicgstab() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 9: GMRES(m) y BiCGSTAB (sistemas no simétricos)\n");
+    imprimir_linea();
+
+    // Convección-difusión 2D con convección fuerte: no simétrica y no
+    // diagonalmente dominante (|−2.5| + |0.5| + 1 + 1 > 4)
+    int m = 40;
+    int n = m * m;
+    int capacidad = 5 * n;
+    int *fi = malloc(capacidad * sizeof(int));
+    int *co = malloc(capacidad * sizeof(int));
+    double *va = malloc(capacidad * sizeof(double));
+    int cantidad = 0;
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < m; j++) {
+            int k = i * m + j;
+            fi[cantidad] = k; co[cantidad] = k; va[cantidad++] = 4.0;
+            if (j > 0)     { fi[cantidad] = k; co[cantidad] = k - 1; va[cantidad++] = -2.5; }
+            if (j < m - 1) { fi[cantidad] = k; co[cantidad] = k + 1; va[cantidad++] = 0.5; }
+            if (i > 0)     { fi[cantidad] = k; co[cantidad] = k - m; va[cantidad++] = -1.0; }
+            if (i < m - 1) { fi[cantidad] = k; co[cantidad] = k + m; va[cantidad++] = -1.0; }
+        }
+    MatrizCSR A;
+    csrDesdeTripletas(&A, n, n, cantidad, fi, co, va);
+    free(fi); free(co); free(va);
+
+    double *exacta = malloc(n * sizeof(double));
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    double *y = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) exacta[i] = cos(0.02 * i);
+    productoCSRVector(&A, exacta, b);
+
+    ParametrosIterativos param = { 1e-10, 5000, 1.0 };
+    ResultadoIterativo r;
+    OperadorLineal op = operadorCSR(&A);
+
+    const char *nombres[] = { "ninguno", "Jacobi", "ILU(0)" };
+    TipoPrecondicionador tipos[] = { PRECOND_NINGUNO, PRECOND_JACOBI, PRECOND_LU_INCOMPLETO };
+    int iter_gmres[3], iter_bicg[3];
+    int convergen = 1;
+    for (int t = 0; t < 3; t++) {
+        Precondicionador P;
+        crearPrecondicionadorCSR(&P, tipos[t], &A);
+
+        for (int i = 0; i < n; i++) x[i] = 0.0;
+        EstadoSolver e = gmres(&op, b, x, &P, 30, &param, &r, NULL);
+        double error_max = 0.0;
+        for (int i = 0; i < n; i++)
+            if (fabs(x[i] - exacta[i]) > error_max) error_max = fabs(x[i] - exacta[i]);
+        printf("    GMRES(30) (%-7s): %4d iteraciones, residuo %.2e, max error %.2e\n",
+               nombres[t], r.iteraciones, r.error, error_max);
+        if (e != SOLVER_OK || error_max > 1e-7) convergen = 0;
+        iter_gmres[t] = r.iteraciones;
+
+        for (int i = 0; i < n; i++) x[i] = 0.0;
+        e = bicgstab(&op, b, x, &P, &param, &r, NULL);
+        error_max = 0.0;
+        for (int i = 0; i < n; i++)
+            if (fabs(x[i] - exacta[i]) > error_max) error_max = fabs(x[i] - exacta[i]);
+        printf("    BiCGSTAB  (%-7s): %4d iteraciones, residuo %.2e, max error %.2e\n",
+               nombres[t], r.iteraciones, r.error, error_max);
+        if (e != SOLVER_OK || error_max > 1e-7) convergen = 0;
+        iter_bicg[t] = r.iteraciones;
+
+        liberarPrecondicionador(&P);
+    }
+    verificar("GMRES y BiCGSTAB convergen con los tres precondicionadores", convergen);
+    verificar("ILU(0) reduce las iteraciones de GMRES y BiCGSTAB",
+              iter_gmres[2] < iter_gmres[0] && iter_bicg[2] < iter_bicg[0]);
+
+    // Precondicionador personalizado: debe comportarse igual que Jacobi
+    Precondicionador personalizado = precondicionadorPersonalizado(n, precondicionador_diagonal, &A);
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    bicgstab(&op, b, x, &personalizado, &param, &r, NULL);
+    verificar("precondicionador personalizado equivale a Jacobi", r.iteraciones == iter_bicg[1]);
+
+    // Matriz densa no simétrica sin dominancia diagonal: GMRES sin reinicio
+    // termina en a lo sumo n iteraciones
+    int nd = 60;
+    MatrizDensa D;
+    crearMatrizDensa(&D, nd, nd);
+    srand(7);
+    for (int i = 0; i < nd; i++)
+        for (int j = 0; j < nd; j++)
+            MD(&D, i, j) = (double)rand() / RAND_MAX - 0.5 + (i == j ? 2.0 : 0.0);
+    productoMatrizVector(&D, exacta, b);
+    for (int i = 0; i < nd; i++) x[i] = 0.0;
+    OperadorLineal op_densa = operadorDensa(&D);
+    param.tolerancia = 1e-12;
+    EstadoSolver e = gmres(&op_densa, b, x, NULL, nd, &param, &r, NULL);
+    double error_max = 0.0;
+    for (int i = 0; i < nd; i++)
+        if (fabs(x[i] - exacta[i]) > error_max) error_max = fabs(x[i] - exacta[i]);
+    printf("    GMRES densa n=%d: %d iteraciones, max error %.2e\n", nd, r.iteraciones, error_max);
+    verificar("GMRES sin reinicio converge en a lo sumo n iteraciones",
+              e == SOLVER_OK && r.iteraciones <= nd && error_max < 1e-9);
+
+    // Jacobi no sirve en este sistema
+    for (int i = 0; i < nd; i++) x[i] = 0.0;
+    e = jacobiDensa(&D, b, x, &param, &r);
+    printf("    Jacobi densa: estado %d tras %d iteraciones\n", e, r.iteraciones);
+    verificar("Jacobi no converge donde GMRES sí", e != SOLVER_OK);
+
+    liberarMatrizDensa(&D);
+    liberarMatrizCSR(&A);
+    free(exacta); free(b); free(x); free(y);
+}
+
+/* ============================================================================
+   TEST 10: LECTURA DE SISTEMAS (TEXTO EN UNA PASADA Y BINARIO MAPEADO)
+   ============================================================================ */
+void test_lectura_archivos() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 10: Lectura de sistemas desde archivo (texto y binario mapeado)\n");
+    imprimir_linea();
+
+    int n = 400;
+    MatrizDensa A;
+    double *b = malloc(n * sizeof(double));
+    generar_diagonal_dominante(&A, b, n, 11);
+
+    // Archivo de texto con filas de más de 1024 caracteres
+    const char *archivo_texto = "prueba_sistema.txt";
+    FILE *f = fopen(archivo_texto, "w");
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) fprintf(f, "%.17g ", MD(&A, i, j));
+        fprintf(f, "%.17g\n", b[i]);
+    }
+    fclose(f);
+
+    clock_t inicio = clock();
+    MatrizDensa T;
+    double *bt;
+    int ok = leerSistemaTexto(archivo_texto, &T, &bt, 0) == 0;
+    double t_texto = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    verificar("leerSistemaTexto lee filas largas y deduce n", ok && T.filas == n);
+
+    int iguales = ok;
+    for (int i = 0; i < n && iguales; i++) {
+        if (bt[i] != b[i]) iguales = 0;
+        for (int j = 0; j < n; j++)
+            if (MD(&T, i, j) != MD(&A, i, j)) iguales = 0;
+    }
+    verificar("los valores leídos coinciden exactamente", iguales);
+
+    double **A_punteros, *b_punteros;
+    int n_leido;
+    ok = leerSistemaDesdeArchivo(archivo_texto, &A_punteros, &b_punteros, &n_leido, 0) == 0;
+    verificar("leerSistemaDesdeArchivo (doble puntero) lee el mismo sistema",
+              ok && n_leido == n && A_punteros[n - 1][n - 1] == MD(&A, n - 1, n - 1) &&
+              b_punteros[n - 1] == b[n - 1]);
+    if (ok) liberarMemoria(A_punteros, b_punteros, n_leido);
+
+    // Formato binario mapeado en memoria
+    const char *archivo_binario = "prueba_sistema.bin";
+    verificar("guardarSistemaBinario escribe el archivo", guardarSistemaBinario(archivo_binario, &A, b) == 0);
+    SistemaBinario S;
+    inicio = clock();
+    ok = mapearSistemaBinario(archivo_binario, &S) == 0;
+    double t_binario = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    printf("    n = %d: texto %.4f s, binario mapeado %.6f s\n", n, t_texto, t_binario);
+    verificar("mapearSistemaBinario carga el sistema", ok && S.n == n);
+    verificar("filas del mapeo alineadas a 64 bytes", ok && ((uintptr_t)S.A.datos % ALINEACION_MATRIZ) == 0);
+
+    iguales = ok;
+    for (int i = 0; i < n && iguales; i++) {
+        if (S.b[i] != b[i]) iguales = 0;
+        for (int j = 0; j < n; j++)
+            if (MD(&S.A, i, j) != MD(&A, i, j)) iguales = 0;
+    }
+    verificar("el sistema mapeado coincide con el original", iguales);
+
+    // Eliminación de Gauss modifica A y b en el mapeo privado, no en el archivo
+    double *x = malloc(n * sizeof(double));
+    EstadoSolver e = eliminacionGaussDensa(&S.A, S.b, x, NULL);
+    double error_max = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - (i + 1)) > error_max) error_max = fabs(x[i] - (i + 1));
+    verificar("se resuelve el sistema directamente sobre el mapeo", e == SOLVER_OK && error_max < 1e-9);
+    liberarSistemaBinario(&S);
+    ok = mapearSistemaBinario(archivo_binario, &S) == 0;
+    verificar("el archivo binario no cambió", ok && MD(&S.A, n - 1, 0) == MD(&A, n - 1, 0) && S.b[0] == b[0]);
+    liberarSistemaBinario(&S);
+
+    // Un archivo de texto no es un sistema binario
+    printf("    (se espera un mensaje de error)\n");
+    verificar("se rechaza un archivo que no es binario", mapearSistemaBinario(archivo_texto, &S) != 0);
+
+    // Líneas vacías al comienzo y una fila repartida en dos líneas
+    f = fopen(archivo_texto, "w");
+    fprintf(f, "\n\n  4 1 5\n1\n3 4\n");
+    fclose(f);
+    MatrizDensa P;
+    double *bp;
+    ok = leerSistemaTexto(archivo_texto, &P, &bp, 0) == 0;
+    verificar("fila repartida en varias líneas", ok && P.filas == 2 && MD(&P, 0, 1) == 1.0 &&
+              MD(&P, 1, 0) == 1.0 && MD(&P, 1, 1) == 3.0 && bp[1] == 4.0);
+    if (ok) { liberarMatrizDensa(&P); free(bp); }
+
+    // Un valor inválido en la primera fila o en las siguientes se rechaza
+    printf("    (se esperan dos mensajes de error)\n");
+    f = fopen(archivo_texto, "w");
+    fprintf(f, "4 1x 5\n1 3 4\n");
+    fclose(f);
+    verificar("se rechaza un valor inválido en la primera fila", leerSistemaTexto(archivo_texto, &P, &bp, 0) != 0);
+    f = fopen(archivo_texto, "w");
+    fprintf(f, "4 1 5\n1 3\n");
+    fclose(f);
+    verificar("se rechaza un archivo con valores de menos", leerSistemaTexto(archivo_texto, &P, &bp, 0) != 0);
+
+    remove(archivo_texto);
+    remove(archivo_binario);
+    liberarMatrizDensa(&A);
+    liberarMatrizDensa(&T);
+    free(b); free(bt); free(x);
+}
+
+/* ============================================================================
+   TEST 11: MUCHOS SISTEMAS PEQUEÑOS RESUELTOS POR LOTES
+   ============================================================================ */
+void test_sistemas_por_lotes() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 11: Sistemas pequeños por lotes (estructura de arreglos)\n");
+    imprimir_linea();
+
+    int cantidad = 100003;  // No múltiplo de ANCHO_LOTE: hay sistemas de relleno
+    srand(21);
+    for (int n = 3; n <= 9; n += 3) {
+        LoteSistemas L;
+        crearLoteSistemas(&L, n, cantidad);
+        for (int s = 0; s < cantidad; s++)
+            for (int i = 0; i < n; i++) {
+                // Sin dominancia diagonal: el pivoteo tiene que intercambiar filas
+                for (int j = 0; j < n; j++) LOTE_A(&L, s, i, j) = (double)rand() / RAND_MAX - 0.5;
+                LOTE_B(&L, s, i) = (double)rand() / RAND_MAX;
+            }
+        // Un sistema singular (dos filas iguales)
+        for (int j = 0; j < n; j++) LOTE_A(&L, 5, 1, j) = LOTE_A(&L, 5, 0, j);
+
+        clock_t inicio = clock();
+        int singulares = resolverLoteSistemas(&L);
+        double t_lote = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+
+        // Referencia: gaussPivotDensa sistema por sistema, con una matriz por llamada
+        double b[16], x[16];
+        double error_max = 0.0;
+        int coinciden_singulares = 1;
+        inicio = clock();
+        for (int s = 0; s < cantidad; s++) {
+            MatrizDensa M;
+            crearMatrizDensa(&M, n, n);
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) MD(&M, i, j) = LOTE_A(&L, s, i, j);
+                b[i] = LOTE_B(&L, s, i);
+            }
+            int singular = gaussPivotDensa(&M, b, x);
+            if (singular != L.singular[s]) coinciden_singulares = 0;
+            if (!singular)
+                for (int i = 0; i < n; i++) {
+                    double d = fabs(x[i] - LOTE_X(&L, s, i)) / (1.0 + fabs(x[i]));
+                    if (d > error_max) error_max = d;
+                }
+            liberarMatrizDensa(&M);
+        }
+        double t_uno = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+
+        printf("    n = %d: %d sistemas, lote %.4f s, de a uno %.4f s (x%.1f), "
+               "max dif. relativa %.2e, singulares %d\n",
+               n, cantidad, t_lote, t_uno, t_uno / (t_lote > 0 ? t_lote : 1e-9), error_max, singulares);
+        char desc[96];
+        sprintf(desc, "n = %d%s: coincide con gaussPivotDensa", n, n > MAX_N_ESPECIALIZADO ? " (genérico)" : "");
+        verificar(desc, error_max < 1e-8 && coinciden_singulares && L.singular[5] && singulares >= 1);
+        liberarLoteSistemas(&L);
+    }
+}
+
+/* ============================================================================
+   TEST 12: SISTEMAS TRIDIAGONALES Y BANDA
+   ============================================================================ */
+void test_matriz_banda() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 12: Sistemas tridiagonales (Thomas) y matrices banda\n");
+    imprimir_linea();
+
+    // Thomas contra la solución exacta del sistema tridiagonal (-1, 4, -1)
+    int n = 200;
+    double *inferior = malloc(n * sizeof(double));
+    double *diagonal = malloc(n * sizeof(double));
+    double *superior = malloc(n * sizeof(double));
+    double *d = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    MatrizDensa T;
+    generar_tridiagonal(&T, d, n);
+    for (int i = 0; i < n; i++) {
+        inferior[i] = (i > 0) ? MD(&T, i, i - 1) : 0.0;
+        diagonal[i] = MD(&T, i, i);
+        superior[i] = (i < n - 1) ? MD(&T, i, i + 1) : 0.0;
+    }
+    EstadoSolver estado = resolverTridiagonal(n, inferior, diagonal, superior, d, x);
+    double error = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - (i + 1)) > error) error = fabs(x[i] - (i + 1));
+    printf("    Thomas n = %d: error máximo %.2e\n", n, error);
+    verificar("resolverTridiagonal: solución exacta (1, 2, ..., n)", estado == SOLVER_OK && error < 1e-10);
+
+    // x y d pueden ser el mismo vector
+    estado = resolverTridiagonal(n, inferior, diagonal, superior, d, d);
+    verificar("resolverTridiagonal: resuelve en el lugar (x == d)", estado == SOLVER_OK && fabs(d[n - 1] - n) < 1e-10);
+
+    diagonal[0] = 0.0;
+    verificar("resolverTridiagonal: pivote nulo -> SINGULAR",
+              resolverTridiagonal(n, inferior, diagonal, superior, x, x) == SOLVER_SINGULAR);
+    liberarMatrizDensa(&T);
+
+    // Matriz banda no simétrica y sin dominancia diagonal (kl = 2, ku = 3): el
+    // pivoteo tiene que intercambiar filas. Se compara con Gauss denso.
+    int kl = 2, ku = 3;
+    MatrizBanda B;
+    MatrizDensa D;
+    crearMatrizBanda(&B, n, kl, ku);
+    crearMatrizDensa(&D, n, n);
+    srand(12);
+    for (int i = 0; i < n; i++)
+        for (int j = i - kl; j <= i + ku; j++)
+            if (j >= 0 && j < n) {
+                double valor = (double)rand() / RAND_MAX - 0.5;
+                MB(&B, i, j) = valor;
+                MD(&D, i, j) = valor;
+            }
+    for (int i = 0; i < n; i++) x[i] = i + 1;
+    productoBandaVector(&B, x, d);
+    double *b_denso = malloc(n * sizeof(double));
+    double *x_denso = malloc(n * sizeof(double));
+    productoMatrizVector(&D, x, b_denso);
+    double dif_producto = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(d[i] - b_denso[i]) > dif_producto) dif_producto = fabs(d[i] - b_denso[i]);
+    verificar("productoBandaVector coincide con el producto denso", dif_producto < 1e-14);
+
+    estado = eliminacionGaussBanda(&B, d, x);
+    eliminacionGaussDensa(&D, b_denso, x_denso, NULL);
+    error = 0.0;
+    double dif = 0.0;
+    for (int i = 0; i < n; i++) {
+        if (fabs(x[i] - (i + 1)) / (i + 1) > error) error = fabs(x[i] - (i + 1)) / (i + 1);
+        if (fabs(x[i] - x_denso[i]) / (1.0 + fabs(x_denso[i])) > dif) dif = fabs(x[i] - x_denso[i]) / (1.0 + fabs(x_denso[i]));
+    }
+    printf("    Banda n = %d, kl = %d, ku = %d: error relativo %.2e, dif. con Gauss denso %.2e\n",
+           n, kl, ku, error, dif);
+    verificar("eliminacionGaussBanda: coincide con eliminacionGaussDensa", estado == SOLVER_OK && error < 1e-8 && dif < 1e-8);
+    liberarMatrizBanda(&B);
+    liberarMatrizDensa(&D);
+    free(b_denso);
+    free(x_denso);
+
+    // Sistema de splines con muchos nodos: O(n) tiempo y memoria
+    int nodos = 1000000;
+    double *h = malloc((nodos - 1) * sizeof(double));
+    double *inf = malloc(nodos * sizeof(double));
+    double *dia = malloc(nodos * sizeof(double));
+    double *sup = malloc(nodos * sizeof(double));
+    double *M = malloc(nodos * sizeof(double));
+    for (int i = 0; i < nodos - 1; i++) h[i] = 1e-3 * (1.0 + 0.5 * sin(i));
+    inf[0] = sup[0] = 0.0; dia[0] = 1.0; M[0] = 0.0;
+    inf[nodos - 1] = sup[nodos - 1] = 0.0; dia[nodos - 1] = 1.0; M[nodos - 1] = 0.0;
+    for (int i = 1; i < nodos - 1; i++) {
+        inf[i] = h[i - 1];
+        dia[i] = 2.0 * (h[i - 1] + h[i]);
+        sup[i] = h[i];
+        M[i] = 1.0;
+    }
+    double *S = malloc(nodos * sizeof(double));
+    clock_t inicio = clock();
+    estado = resolverTridiagonal(nodos, inf, dia, sup, M, S);
+    double t = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    double residuo = 0.0;
+    for (int i = 1; i < nodos - 1; i++) {
+        double r = fabs(inf[i] * S[i - 1] + dia[i] * S[i] + sup[i] * S[i + 1] - M[i]);
+        if (r > residuo) residuo = r;
+    }
+    printf("    Splines con %d nodos: %.4f s, residuo máximo %.2e\n", nodos, t, residuo);
+    verificar("Sistema de splines de 10^6 nodos resuelto en O(n)", estado == SOLVER_OK && residuo < 1e-12);
+
+    free(h); free(inf); free(dia); free(sup); free(M); free(S);
+    free(inferior); free(diagonal); free(superior); free(d); free(x);
+}
+
+/* ============================================================================
+   TEST 13: PRECISIÓN MIXTA (LU EN FLOAT + REFINAMIENTO EN DOUBLE)
+   ============================================================================ */
+void test_precision_mixta() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 13: Precisión mixta (LU en float + refinamiento en double)\n");
+    imprimir_linea();
+
+    ParametrosIterativos param = { 1e-15, 30, 1.0 };
+    ResultadoIterativo res;
+
+    // Matriz aleatoria sin dominancia diagonal, bien condicionada, x exacta = (1, ..., n)
+    int n = 600;
+    MatrizDensa A;
+    crearMatrizDensa(&A, n, n);
+    srand(13);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            MD(&A, i, j) = (double)rand() / RAND_MAX - 0.5 + (i == j ? 10.0 : 0.0);
+    double *exacta = malloc(n * sizeof(double));
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) exacta[i] = i + 1;
+    productoMatrizVector(&A, exacta, b);
+
+    clock_t inicio = clock();
+    EstadoSolver estado = resolverPrecisionMixta(&A, b, x, &param, &res);
+    double t_mixta = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    double error = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) / exacta[i] > error) error = fabs(x[i] - exacta[i]) / exacta[i];
+    printf("    n = %d: %s en %d pasos de refinamiento, error hacia atrás %.2e, "
+           "error relativo %.2e\n", n, nombreEstadoSolver(estado), res.iteraciones, res.error, error);
+    verificar("Precisión mixta alcanza precisión de double", estado == SOLVER_OK && error < 1e-10);
+    verificar("Pocos pasos de refinamiento (<= 5)", res.iteraciones >= 1 && res.iteraciones <= 5);
+
+    // Factorización en float contra factorización en double
+    FactorizacionLUSimple Fs;
+    FactorizacionLU Fd;
+    inicio = clock();
+    factorizarLUSimple(&A, &Fs, TAM_BLOQUE_LU);
+    double t_float = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    inicio = clock();
+    factorizarLU(&A, &Fd, TAM_BLOQUE_LU);
+    double t_double = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    resolverLUSimple(&Fs, b, x);
+    double error_float = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) / exacta[i] > error_float) error_float = fabs(x[i] - exacta[i]) / exacta[i];
+    printf("    Factorización: float %.4f s, double %.4f s (x%.1f); total precisión mixta %.4f s\n",
+           t_float, t_double, t_double / (t_float > 0 ? t_float : 1e-9), t_mixta);
+    printf("    Sin refinar, la solución en float tiene error relativo %.2e\n", error_float);
+    verificar("Sin refinamiento el error es el de float (> 1e-10)", error_float > 1e-10 && error_float < 1e-3);
+    liberarFactorizacionLUSimple(&Fs);
+    liberarFactorizacionLU(&Fd);
+    liberarMatrizDensa(&A);
+
+    // Hilbert 12x12 (κ ≈ 1e16): el refinamiento no puede converger
+    int nh = 12;
+    MatrizDensa H;
+    crearMatrizDensa(&H, nh, nh);
+    for (int i = 0; i < nh; i++) {
+        for (int j = 0; j < nh; j++) MD(&H, i, j) = 1.0 / (i + j + 1);
+        exacta[i] = 1.0;
+    }
+    productoMatrizVector(&H, exacta, b);
+    estado = resolverPrecisionMixta(&H, b, x, &param, &res);
+    printf("    Hilbert %dx%d: %s tras %d pasos\n", nh, nh, nombreEstadoSolver(estado), res.iteraciones);
+    verificar("Hilbert mal condicionada: se informa que no converge", estado != SOLVER_OK);
+    liberarMatrizDensa(&H);
+
+    free(exacta); free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 14: DIAGNÓSTICO DE CONVERGENCIA Y DETECCIÓN DE ESTANCAMIENTO
+   ============================================================================ */
+static void llenarTridiagonal(MatrizDensa *A, int n, double diagonal) {
+    crearMatrizDensa(A, n, n);
+    for (int i = 0; i < n; i++) {
+        MD(A, i, i) = diagonal;
+        if (i > 0) MD(A, i, i - 1) = -1.0;
+        if (i < n - 1) MD(A, i, i + 1) = -1.0;
+    }
+}
+
+void test_diagnostico_convergencia() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 14: Diagnóstico de convergencia y detección de estancamiento\n");
+    imprimir_linea();
+
+    int n = 50;
+    ParametrosIterativos param = { 1e-10, 10000, 1.0 };
+    ResultadoIterativo res;
+    DiagnosticoConvergencia d;
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    double *unos = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) unos[i] = 1.0;
+
+    // tridiag(-1, 4, -1): ρ(Jacobi) = cos(π/(n+1))/2 y ρ(Gauss-Seidel) = ρ(Jacobi)²
+    MatrizDensa A;
+    llenarTridiagonal(&A, n, 4.0);
+    productoMatrizVector(&A, unos, b);
+    double rho_jacobi = 0.5 * cos(M_PI / (n + 1));
+
+    diagnosticarConvergencia(&A, b, NULL, METODO_JACOBI, &param, &d);
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    jacobiDensa(&A, b, x, &param, &res);
+    printf("    Jacobi: dominante=%d, ρ estimado %.6f (exacto %.6f), iteraciones previstas %d, reales %d\n",
+           d.diagonal_dominante, d.radio_espectral, rho_jacobi, d.iteraciones_estimadas, res.iteraciones);
+    verificar("Tridiagonal (-1, 4, -1) es diagonal dominante", d.diagonal_dominante && d.fila_no_dominante == -1);
+    verificar("ρ de Jacobi estimado con error < 1e-3", fabs(d.radio_espectral - rho_jacobi) < 1e-3);
+    verificar("Iteraciones previstas de Jacobi a ±25% de las reales",
+              abs(d.iteraciones_estimadas - res.iteraciones) <= res.iteraciones / 4);
+
+    diagnosticarConvergencia(&A, b, NULL, METODO_GAUSS_SEIDEL, &param, &d);
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    gaussSeidelDensa(&A, b, x, &param, &res);
+    printf("    Gauss-Seidel: ρ estimado %.6f (exacto %.6f), iteraciones previstas %d, reales %d\n",
+           d.radio_espectral, rho_jacobi * rho_jacobi, d.iteraciones_estimadas, res.iteraciones);
+    verificar("ρ de Gauss-Seidel estimado con error relativo < 15%",
+              fabs(d.radio_espectral / (rho_jacobi * rho_jacobi) - 1.0) < 0.15);
+    verificar("Iteraciones previstas de Gauss-Seidel a ±25% de las reales",
+              abs(d.iteraciones_estimadas - res.iteraciones) <= res.iteraciones / 4 + 1);
+    liberarMatrizDensa(&A);
+
+    // Matriz sin dominancia diagonal para la que Jacobi no converge
+    MatrizDensa B;
+    crearMatrizDensa(&B, n, n);
+    srand(14);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            MD(&B, i, j) = (double)rand() / RAND_MAX + (i == j ? 1.0 : 0.0);
+    productoMatrizVector(&B, unos, b);
+    diagnosticarConvergencia(&B, b, NULL, METODO_JACOBI, &param, &d);
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    EstadoSolver estado = jacobiDensa(&B, b, x, &param, &res);
+    printf("    Sin dominancia: fila %d no dominante, ρ estimado %.2f; Jacobi: %s en %d iteraciones\n",
+           d.fila_no_dominante, d.radio_espectral, nombreEstadoSolver(estado), res.iteraciones);
+    verificar("Se detecta la falta de dominancia diagonal", !d.diagonal_dominante && d.fila_no_dominante >= 0);
+    verificar("Se prevé que Jacobi no converge", d.converge == PRONOSTICO_NO_CONVERGE && d.iteraciones_estimadas == -1);
+    verificar("Jacobi diverge (confirmación)", estado == SOLVER_DIVERGE);
+    liberarMatrizDensa(&B);
+
+    // tridiag(-1, 2.0001, -1): converge, pero con ρ ≈ 0.998 necesitaría ~13000
+    // iteraciones; el control de convergencia lo detecta sin agotar max_iter
+    MatrizDensa C;
+    llenarTridiagonal(&C, n, 2.0001);
+    productoMatrizVector(&C, unos, b);
+    param.tolerancia = 1e-12;
+    diagnosticarConvergencia(&C, b, NULL, METODO_JACOBI, &param, &d);
+    for (int i = 0; i < n; i++) x[i] = 0.0;
+    estado = jacobiDensa(&C, b, x, &param, &res);
+    printf("    Convergencia lenta: ρ estimado %.5f, previstas %d iteraciones; Jacobi: %s tras %d\n",
+           d.radio_espectral, d.iteraciones_estimadas, nombreEstadoSolver(estado), res.iteraciones);
+    verificar("Se prevén más iteraciones que max_iter",
+              d.converge != PRONOSTICO_NO_CONVERGE && d.iteraciones_estimadas > param.max_iter);
+    verificar("Jacobi se detiene antes con MAX_ITER (< max_iter/10 iteraciones)",
+              estado == SOLVER_MAX_ITER && res.iteraciones < param.max_iter / 10);
+    liberarMatrizDensa(&C);
+
+    // [[1,2],[2,4]] singular y compatible: Jacobi tiene autovalores ±1 y
+    // Gauss-Seidel {0, 1}. Con ρ = 1 la estimación no decide; no se debe
+    // asegurar nada, y el control de estancamiento detiene las iteraciones
+    MatrizDensa E;
+    crearMatrizDensa(&E, 2, 2);
+    MD(&E, 0, 0) = 1.0; MD(&E, 0, 1) = 2.0;
+    MD(&E, 1, 0) = 2.0; MD(&E, 1, 1) = 4.0;
+    double b_singular[2] = { 3.0, 6.0 }, x_singular[2];
+    ParametrosIterativos param_singular = param;
+    param_singular.tolerancia = 1e-10;
+    DiagnosticoConvergencia d_jacobi, d_gs;
+    diagnosticarConvergencia(&E, b_singular, NULL, METODO_JACOBI, &param_singular, &d_jacobi);
+    diagnosticarConvergencia(&E, b_singular, NULL, METODO_GAUSS_SEIDEL, &param_singular, &d_gs);
+    x_singular[0] = x_singular[1] = 0.0;
+    estado = jacobiDensa(&E, b_singular, x_singular, &param_singular, &res);
+    printf("    Singular: ρ Jacobi %.4f, ρ Gauss-Seidel %.4f; Jacobi: %s tras %d iteraciones\n",
+           d_jacobi.radio_espectral, d_gs.radio_espectral, nombreEstadoSolver(estado), res.iteraciones);
+    verificar("ρ = 1: pronóstico incierto para Jacobi y Gauss-Seidel",
+              d_jacobi.converge == PRONOSTICO_INCIERTO && d_gs.converge == PRONOSTICO_INCIERTO);
+    verificar("Jacobi se detiene por estancamiento sin agotar max_iter",
+              estado != SOLVER_OK && res.iteraciones < param_singular.max_iter);
+    liberarMatrizDensa(&E);
+
+    // El error de un paso no baja siempre aunque el método converja: no es divergencia
+    // Triangular inferior con dominancia diagonal estricta (T nilpotente)
+    MatrizDensa L;
+    crearMatrizDensa(&L, 3, 3);
+    for (int i = 0; i < 3; i++) MD(&L, i, i) = 1.0;
+    MD(&L, 1, 0) = MD(&L, 2, 0) = 0.9;
+    double b_l[3] = { 1.0, 0.0, 0.0 }, x_l[3] = { 0.0, 0.0, 0.0 }, x_lp[3] = { 0.0, 0.0, 0.0 };
+    ResultadoIterativo res_p;
+    EstadoSolver e_serie = jacobiDensa(&L, b_l, x_l, &param_singular, &res);
+    EstadoSolver e_paralelo = jacobiParalelo(&L, b_l, x_lp, &param_singular, 2, &res_p);
+    printf("    Triangular: Jacobi %s en %d iteraciones, Jacobi paralelo %s en %d\n",
+           nombreEstadoSolver(e_serie), res.iteraciones, nombreEstadoSolver(e_paralelo), res_p.iteraciones);
+    verificar("Triangular dominante: Jacobi serie y paralelo convergen",
+              e_serie == SOLVER_OK && e_paralelo == SOLVER_OK && fabs(x_l[1] + 0.9) < 1e-12);
+    liberarMatrizDensa(&L);
+
+    // T = [[0, -4], [-0.01, 0]] (ρ = 0.2): el primer paso multiplica el error por 4
+    MatrizDensa N;
+    crearMatrizDensa(&N, 2, 2);
+    MD(&N, 0, 0) = 1.0;  MD(&N, 0, 1) = 4.0;
+    MD(&N, 1, 0) = 0.01; MD(&N, 1, 1) = 1.0;
+    double b_n[2] = { 0.0, 1.0 }, x_n[2] = { 0.0, 0.0 };
+    diagnosticarConvergencia(&N, b_n, NULL, METODO_JACOBI, &param_singular, &d);
+    estado = jacobiDensa(&N, b_n, x_n, &param_singular, &res);
+    printf("    No normal: ρ estimado %.3f, previstas %d; Jacobi %s en %d iteraciones\n",
+           d.radio_espectral, d.iteraciones_estimadas, nombreEstadoSolver(estado), res.iteraciones);
+    verificar("ρ = 0.2 con error no monótono: Jacobi converge como se pronosticó",
+              d.converge == PRONOSTICO_CONVERGE && estado == SOLVER_OK && residuo_max(&N, b_n, x_n) < 1e-9);
+    liberarMatrizDensa(&N);
+
+    free(b); free(x); free(unos);
+}
+
+/* ============================================================================
+   TEST 15: ESPACIO DE TRABAJO REUTILIZABLE (SIN RESERVAS POR SISTEMA)
+   ============================================================================ */
+void test_espacio_trabajo() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 15: Espacio de trabajo reutilizable entre sistemas\n");
+    imprimir_linea();
+
+    int capacidad = 60;
+    int tamanos[] = { 5, 60, 17, 1, 33 };
+    int cantidad = (int)(sizeof(tamanos) / sizeof(tamanos[0]));
+    ParametrosIterativos param = { 1e-10, 1000, 1.0 };
+
+    EspacioTrabajo E;
+    verificar("Espacio de trabajo creado", crearEspacioTrabajo(&E, capacidad) == 0);
+    double *datos = E.A.datos;
+    double *vectores = E.b;
+    int stride = E.A.stride;
+
+    double *b = malloc(capacidad * sizeof(double));
+    double *x = malloc(capacidad * sizeof(double));
+    int iguales = 1, sin_reserva = 1, correctos = 1;
+
+    for (int caso = 0; caso < cantidad; caso++) {
+        int n = tamanos[caso];
+        MatrizDensa A;
+        generar_diagonal_dominante(&A, b, n, 150 + caso);
+
+        // Gauss: espacio de trabajo contra eliminacionGaussDensa con memoria propia
+        ajustarEspacioTrabajo(&E, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) MD(&E.A, i, j) = MD(&A, i, j);
+            E.b[i] = b[i];
+        }
+        EstadoSolver estado = eliminacionGaussEspacio(&E, NULL);
+        MatrizDensa copia;
+        copiarMatrizDensa(&copia, &A);
+        double *b_copia = malloc(n * sizeof(double));
+        for (int i = 0; i < n; i++) b_copia[i] = b[i];
+        eliminacionGaussDensa(&copia, b_copia, x, NULL);
+        for (int i = 0; i < n; i++) {
+            if (E.x[i] != x[i]) iguales = 0;
+            if (fabs(E.x[i] - (i + 1)) > 1e-9 * (i + 1)) correctos = 0;
+        }
+        if (estado != SOLVER_OK) correctos = 0;
+        liberarMatrizDensa(&copia);
+        free(b_copia);
+
+        // Jacobi y Gauss-Seidel: mismas iteraciones que las versiones con reserva
+        ResultadoIterativo r_espacio, r_densa;
+        for (int metodo = 0; metodo < 2; metodo++) {
+            ajustarEspacioTrabajo(&E, n);
+            for (int i = 0; i < n; i++) {
+                for (int j = 0; j < n; j++) MD(&E.A, i, j) = MD(&A, i, j);
+                E.b[i] = b[i];
+                E.x[i] = 0.0;
+                x[i] = 0.0;
+            }
+            EstadoSolver e1 = metodo == 0 ? jacobiEspacio(&E, &param, &r_espacio)
+                                          : gaussSeidelEspacio(&E, &param, &r_espacio);
+            EstadoSolver e2 = metodo == 0 ? jacobiDensa(&A, b, x, &param, &r_densa)
+                                          : gaussSeidelDensa(&A, b, x, &param, &r_densa);
+            if (e1 != e2 || r_espacio.iteraciones != r_densa.iteraciones) iguales = 0;
+            for (int i = 0; i < n; i++)
+                if (E.x[i] != x[i]) iguales = 0;
+            if (e1 != SOLVER_OK) correctos = 0;
+        }
+        liberarMatrizDensa(&A);
+
+        if (E.A.datos != datos || E.b != vectores || E.A.stride != stride || E.capacidad != capacidad)
+            sin_reserva = 0;
+    }
+    printf("    %d sistemas (n = 1..%d) resueltos sobre el mismo espacio\n", cantidad, capacidad);
+    verificar("Mismos resultados que los solvers con memoria propia", iguales);
+    verificar("Soluciones correctas (Gauss, Jacobi y Gauss-Seidel)", correctos);
+    verificar("Sin reservas: n <= capacidad reutiliza la misma memoria", sin_reserva);
+
+    // Un sistema más grande que la capacidad agranda el espacio
+    verificar("n > capacidad agranda el espacio",
+              ajustarEspacioTrabajo(&E, capacidad + 10) == 0 && E.capacidad == capacidad + 10 &&
+              E.A.filas == capacidad + 10);
+    verificar("n <= 0 es un tamaño inválido", ajustarEspacioTrabajo(&E, 0) == 1);
+    liberarEspacioTrabajo(&E);
+
+    // Un espacio vacío se dimensiona en el primer uso
+    crearEspacioTrabajo(&E, 0);
+    verificar("Espacio vacío se dimensiona al ajustarlo",
+              E.capacidad == 0 && ajustarEspacioTrabajo(&E, 8) == 0 && E.capacidad == 8 && E.x != NULL);
+    liberarEspacioTrabajo(&E);
+
+    free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 16: CHOLESKY Y LDLᵀ PARA SISTEMAS SIMÉTRICOS
+   ============================================================================ */
+void test_cholesky() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 16: Cholesky y LDLᵀ (triángulo empaquetado) para sistemas simétricos\n");
+    imprimir_linea();
+
+    // Simétrica definida positiva: A = B Bᵀ + n I, x exacta = (1, ..., n)
+    int n = 400;
+    MatrizDensa A, B;
+    crearMatrizDensa(&A, n, n);
+    crearMatrizDensa(&B, n, n);
+    srand(16);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            MD(&B, i, j) = (double)rand() / RAND_MAX - 0.5;
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j <= i; j++) {
+            double suma = 0.0;
+            for (int k = 0; k < n; k++) suma += MD(&B, i, k) * MD(&B, j, k);
+            MD(&A, i, j) = MD(&A, j, i) = suma + (i == j ? n : 0.0);
+        }
+    liberarMatrizDensa(&B);
+    double *exacta = malloc(n * sizeof(double));
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) exacta[i] = i + 1;
+    productoMatrizVector(&A, exacta, b);
+
+    verificar("esSimetrica detecta la matriz simétrica", esSimetrica(&A));
+
+    FactorizacionCholesky F;
+    clock_t inicio = clock();
+    EstadoSolver estado = factorizarCholesky(&A, &F);
+    double t_cholesky = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    resolverCholesky(&F, b, x);
+    double error = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) / exacta[i] > error) error = fabs(x[i] - exacta[i]) / exacta[i];
+    verificar("Cholesky resuelve el sistema SPD (error < 1e-10)", estado == SOLVER_OK && error < 1e-10);
+
+    // Determinante contra LU (en logaritmos para no desbordar)
+    FactorizacionLU Flu;
+    inicio = clock();
+    factorizarLU(&A, &Flu, TAM_BLOQUE_LU);
+    double t_lu = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    double log_det_lu = 0.0, log_det_ch = 0.0;
+    for (int i = 0; i < n; i++) {
+        log_det_lu += log(fabs(MD(&Flu.LU, i, i)));
+        log_det_ch += 2.0 * log(F.L[POS_TRIANGULO(i, i)]);
+    }
+    printf("    n = %d: Cholesky %.4f s, LU %.4f s; factores %zu doubles (LU: %d)\n",
+           n, t_cholesky, t_lu, POS_TRIANGULO(n, 0), n * n);
+    verificar("log|det| de Cholesky coincide con LU", fabs(log_det_lu - log_det_ch) < 1e-9 * fabs(log_det_lu));
+    liberarFactorizacionLU(&Flu);
+    liberarFactorizacionCholesky(&F);
+
+    // x puede ser el mismo vector que b
+    for (int i = 0; i < n; i++) x[i] = b[i];
+    factorizarLDLT(&A, &F);
+    resolverCholesky(&F, x, x);
+    error = 0.0;
+    for (int i = 0; i < n; i++)
+        if (fabs(x[i] - exacta[i]) / exacta[i] > error) error = fabs(x[i] - exacta[i]) / exacta[i];
+    verificar("LDLᵀ resuelve el mismo sistema, en el lugar", error < 1e-10 && F.rango == n);
+    liberarFactorizacionCholesky(&F);
+
+    // Detección automática: SPD -> Cholesky
+    MetodoFactorizacion metodo = FACTORIZACION_GAUSS;
+    estado = resolverDetectandoSimetria(&A, b, x, NULL, &metodo);
+    verificar("SPD: se elige Cholesky", estado == SOLVER_OK && metodo == FACTORIZACION_CHOLESKY);
+    liberarMatrizDensa(&A);
+
+    // Ecuaciones normales con funciones base dependientes (1, x, 2x - 1): semidefinida
+    int m = 3, puntos = 20;
+    MatrizDensa N;
+    crearMatrizDensa(&N, m, m);
+    double c[3] = { 0.0, 0.0, 0.0 };
+    double bn[3] = { 0.0, 0.0, 0.0 };
+    for (int k = 0; k < puntos; k++) {
+        double t = 0.1 * k;
+        double phi[3] = { 1.0, t, 2.0 * t - 1.0 };
+        double y = 3.0 + 5.0 * t;
+        for (int i = 0; i < m; i++) {
+            bn[i] += phi[i] * y;
+            for (int j = 0; j < m; j++) MD(&N, i, j) += phi[i] * phi[j];
+        }
+    }
+    double det = 1.0;
+    estado = factorizarCholesky(&N, &F);
+    liberarFactorizacionCholesky(&F);
+    verificar("Cholesky rechaza la matriz semidefinida", estado == SOLVER_SINGULAR);
+    estado = resolverDetectandoSimetria(&N, bn, c, &det, &metodo);
+    // Cualquier solución debe reproducir y = 3 + 5t
+    double maximo = 0.0;
+    for (int k = 0; k < puntos; k++) {
+        double t = 0.1 * k;
+        double ajuste = c[0] + c[1] * t + c[2] * (2.0 * t - 1.0);
+        if (fabs(ajuste - (3.0 + 5.0 * t)) > maximo) maximo = fabs(ajuste - (3.0 + 5.0 * t));
+    }
+    printf("    Semidefinida: %s, det = %g, error del ajuste %.2e\n",
+           nombreMetodoFactorizacion(metodo), det, maximo);
+    verificar("Semidefinida: se elige LDLᵀ con un pivote nulo",
+              estado == SOLVER_OK && metodo == FACTORIZACION_LDLT && det == 0.0);
+    verificar("La solución elegida reproduce los datos", maximo < 1e-9);
+    liberarMatrizDensa(&N);
+
+    // Simétrica indefinida y no simétrica: Gauss con pivoteo
+    MatrizDensa S;
+    crearMatrizDensa(&S, 2, 2);
+    MD(&S, 0, 0) = 1.0; MD(&S, 0, 1) = 2.0;
+    MD(&S, 1, 0) = 2.0; MD(&S, 1, 1) = 1.0;
+    double bs[2] = { 3.0, 3.0 };
+    estado = resolverDetectandoSimetria(&S, bs, x, NULL, &metodo);
+    verificar("Simétrica indefinida: se usa Gauss",
+              estado == SOLVER_OK && metodo == FACTORIZACION_GAUSS &&
+              fabs(x[0] - 1.0) < 1e-14 && fabs(x[1] - 1.0) < 1e-14);
+    MD(&S, 0, 0) = 4.0; MD(&S, 0, 1) = 1.0;
+    MD(&S, 1, 0) = 2.0; MD(&S, 1, 1) = 3.0;
+    verificar("esSimetrica rechaza la matriz no simétrica", !esSimetrica(&S));
+    bs[0] = 5.0; bs[1] = 5.0;
+    estado = resolverDetectandoSimetria(&S, bs, x, NULL, &metodo);
+    verificar("No simétrica: se usa Gauss", estado == SOLVER_OK && metodo == FACTORIZACION_GAUSS);
+
+    // Simétrica indefinida con diagonal nula: el pivote nulo de LDLᵀ tiene la
+    // columna no nula debajo, así que no puede tomarse como semidefinida
+    MD(&S, 0, 0) = 0.0; MD(&S, 0, 1) = 1.0;
+    MD(&S, 1, 0) = 1.0; MD(&S, 1, 1) = 0.0;
+    estado = factorizarLDLT(&S, &F);
+    liberarFactorizacionCholesky(&F);
+    verificar("LDLᵀ rechaza [[0, 1], [1, 0]]", estado == SOLVER_SINGULAR);
+    bs[0] = 1.0; bs[1] = 2.0;
+    det = 1.0;
+    estado = resolverDetectandoSimetria(&S, bs, x, &det, &metodo);
+    verificar("[[0, 1], [1, 0]]: Gauss da x = (2, 1) y det = -1",
+              estado == SOLVER_OK && metodo == FACTORIZACION_GAUSS &&
+              fabs(x[0] - 2.0) < 1e-14 && fabs(x[1] - 1.0) < 1e-14 && fabs(det + 1.0) < 1e-14);
+    liberarMatrizDensa(&S);
+
+    // Pivote cancelado: d_1 = 1 - 1·1 = 0 pero a_21 = 1 (indefinida, no singular)
+    crearMatrizDensa(&S, 3, 3);
+    double valores[3][3] = { { 1, 1, 0 }, { 1, 1, 1 }, { 0, 1, 1 } };
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++) MD(&S, i, j) = valores[i][j];
+    double b3[3] = { 1.0, 2.0, 3.0 };
+    double b3_original[3] = { 1.0, 2.0, 3.0 };
+    MatrizDensa S_copia;    // Gauss transforma S y b3
+    copiarMatrizDensa(&S_copia, &S);
+    estado = factorizarLDLT(&S, &F);
+    liberarFactorizacionCholesky(&F);
+    verificar("LDLᵀ rechaza el pivote cancelado con la columna no nula", estado == SOLVER_SINGULAR);
+    estado = resolverDetectandoSimetria(&S, b3, x, NULL, &metodo);
+    verificar("Pivote cancelado: Gauss resuelve el sistema (residuo < 1e-14)",
+              estado == SOLVER_OK && metodo == FACTORIZACION_GAUSS &&
+              residuo_max(&S_copia, b3_original, x) < 1e-14);
+    liberarMatrizDensa(&S_copia);
+    liberarMatrizDensa(&S);
+
+    // Ecuaciones normales mal escaladas (pesos de 1e-5): det ~ 7e-14, pero la
+    // matriz está bien condicionada y gaussPivotEspacio no debe descartarla
+    EspacioTrabajo E;
+    crearEspacioTrabajo(&E, 3);
+    ajustarEspacioTrabajo(&E, 3);
+    double escalada[3][3] = { { 4, 1, 1 }, { 1, 5, 1 }, { 1, 1, 4 } };
+    double b_escalado[3] = { 6.0, 7.0, 6.0 };
+    for (int i = 0; i < 3; i++) {
+        E.b[i] = 1e-5 * b_escalado[i];
+        for (int j = 0; j < 3; j++) MD(&E.A, i, j) = 1e-5 * escalada[i][j];
+    }
+    int resultado = gaussPivotEspacio(&E);
+    verificar("gaussPivotEspacio acepta Cholesky con det < 1e-12",
+              resultado == 0 && fabs(E.x[0] - 1.0) < 1e-12 && fabs(E.x[1] - 1.0) < 1e-12 &&
+              fabs(E.x[2] - 1.0) < 1e-12);
+    liberarEspacioTrabajo(&E);
+
+    free(exacta); free(b); free(x);
+}
+
+/* ============================================================================
+   TEST 17: DETERMINANTE, INVERSA Y ESTIMACIÓN DE LA CONDICIÓN CON LU
+   ============================================================================ */
+
+/* κ₁ exacto a partir de la inversa (para comparar con la estimación) */
+static double condicionExacta(const MatrizDensa *A, const FactorizacionLU *F) {
+    MatrizDensa inv;
+    inversaLU(F, &inv);
+    double kappa = normaUnoMatrizDensa(A) * normaUnoMatrizDensa(&inv);
+    liberarMatrizDensa(&inv);
+    return kappa;
+}
+
+void test_condicion_lu() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 17: Determinante, inversa y condición estimada a partir de LU\n");
+    imprimir_linea();
+
+    // Determinante de una 3x3 conocida (necesita pivoteo: a_00 = 0)
+    MatrizDensa A;
+    crearMatrizDensa(&A, 3, 3);
+    double valores[3][3] = { { 0, 2, 1 }, { 1, 1, 0 }, { 3, 0, 1 } };
+    for (int i = 0; i < 3; i++)
+        for (int j = 0; j < 3; j++)
+            MD(&A, i, j) = valores[i][j];
+    FactorizacionLU F;
+    factorizarLU(&A, &F, TAM_BLOQUE_LU);
+    double det = determinanteLU(&F);
+    printf("    det = %.6f (esperado -5)\n", det);
+    verificar("determinanteLU con intercambios de filas", fabs(det + 5.0) < 1e-12);
+
+    // Aᵀ x = b
+    double bt[3] = { 4.0, 3.0, 2.0 }, xt[3];
+    resolverLUTraspuesta(&F, bt, xt);
+    double residuo = 0.0;
+    for (int j = 0; j < 3; j++) {
+        double suma = 0.0;
+        for (int i = 0; i < 3; i++)
+            suma += MD(&A, i, j) * xt[i];
+        residuo = fmax(residuo, fabs(suma - bt[j]));
+    }
+    verificar("resolverLUTraspuesta resuelve Aᵀ x = b", residuo < 1e-13);
+    liberarFactorizacionLU(&F);
+    liberarMatrizDensa(&A);
+
+    // Aleatoria 200x200: A * A⁻¹ = I y estimación contra κ₁ exacto
+    int n = 200;
+    crearMatrizDensa(&A, n, n);
+    srand(17);
+    for (int i = 0; i < n; i++)
+        for (int j = 0; j < n; j++)
+            MD(&A, i, j) = (double)rand() / RAND_MAX - 0.5;
+    factorizarLU(&A, &F, TAM_BLOQUE_LU);
+
+    MatrizDensa inv;
+    EstadoSolver estado = inversaLU(&F, &inv);
+    double error = 0.0;
+    for (int i = 0; i < n; i++) {
+        const double *fila = filaMatrizDensa(&A, i);
+        for (int j = 0; j < n; j++) {
+            double suma = 0.0;
+            for (int k = 0; k < n; k++)
+                suma += fila[k] * MD(&inv, k, j);
+            error = fmax(error, fabs(suma - (i == j ? 1.0 : 0.0)));
+        }
+    }
+    printf("    max |A*A⁻¹ - I| = %.2e\n", error);
+    verificar("inversaLU: A * A⁻¹ = I", estado == SOLVER_OK && error < 1e-10);
+    liberarMatrizDensa(&inv);
+
+    double estimada, exacta = condicionExacta(&A, &F);
+    estado = estimarCondicionLU(&A, &F, &estimada);
+    printf("    Aleatoria %dx%d: κ₁ estimado %.4e, exacto %.4e\n", n, n, estimada, exacta);
+    verificar("Condición estimada: cota inferior dentro de un factor 3",
+              estado == SOLVER_OK && estimada <= exacta * (1 + 1e-10) && estimada >= exacta / 3.0);
+    liberarFactorizacionLU(&F);
+    liberarMatrizDensa(&A);
+
+    // Hilbert (muy mal condicionada)
+    int nh = 8;
+    crearMatrizDensa(&A, nh, nh);
+    for (int i = 0; i < nh; i++)
+        for (int j = 0; j < nh; j++)
+            MD(&A, i, j) = 1.0 / (i + j + 1);
+    factorizarLU(&A, &F, TAM_BLOQUE_LU);
+    exacta = condicionExacta(&A, &F);
+    estimarCondicionLU(&A, &F, &estimada);
+    printf("    Hilbert %dx%d: κ₁ estimado %.4e, exacto %.4e\n", nh, nh, estimada, exacta);
+    verificar("Hilbert: la estimación coincide con κ₁ (error relativo < 1e-3)",
+              fabs(estimada - exacta) < 1e-3 * exacta);
+    liberarFactorizacionLU(&F);
+    liberarMatrizDensa(&A);
+
+    // Identidad: κ₁ = 1
+    crearMatrizDensa(&A, 5, 5);
+    for (int i = 0; i < 5; i++)
+        for (int j = 0; j < 5; j++)
+            MD(&A, i, j) = (i == j) ? 1.0 : 0.0;
+    factorizarLU(&A, &F, TAM_BLOQUE_LU);
+    estimarCondicionLU(&A, &F, &estimada);
+    verificar("Identidad: κ₁ estimado = 1", fabs(estimada - 1.0) < 1e-14);
+    liberarFactorizacionLU(&F);
+    liberarMatrizDensa(&A);
+}
+
+/* ============================================================================
+   TEST 18: JACOBI POR BLOQUES DE FILAS EN VARIOS PROCESOS
+   ============================================================================ */
+void test_jacobi_procesos() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 18: Jacobi por bloques repartido entre procesos (memoria compartida)\n");
+    imprimir_linea();
+
+    int n = 500;
+    MatrizDensa A;
+    double *b = malloc(n * sizeof(double));
+    double *x_serie = calloc(n, sizeof(double));
+    double *x_procesos = calloc(n, sizeof(double));
+    ParametrosIterativos param = { 1e-12, 10000, 1.0 };
+    ResultadoIterativo r_serie, r_procesos;
+
+    generar_diagonal_dominante(&A, b, n, 18);
+
+    EstadoSolver e_serie = jacobiDensa(&A, b, x_serie, &param, &r_serie);
+    EstadoSolver e_procesos = jacobiProcesos(&A, b, x_procesos, &param, 4, &r_procesos);
+    printf("    1 proceso: %d iteraciones | 4 procesos: %d iteraciones\n",
+           r_serie.iteraciones, r_procesos.iteraciones);
+    verificar("Jacobi en 4 procesos converge", e_serie == SOLVER_OK && e_procesos == SOLVER_OK);
+
+    int iguales = (r_serie.iteraciones == r_procesos.iteraciones && r_serie.error == r_procesos.error);
+    for (int i = 0; i < n; i++)
+        if (x_serie[i] != x_procesos[i]) iguales = 0;
+    verificar("iteraciones, error y solución idénticos a jacobiDensa", iguales);
+
+    // Con pocas iteraciones (MAX_ITER) la rotación de los tres vectores no debe perder la última
+    ParametrosIterativos corto = { 1e-30, 7, 1.0 };
+    for (int i = 0; i < n; i++) x_serie[i] = x_procesos[i] = 0.0;
+    e_serie = jacobiDensa(&A, b, x_serie, &corto, &r_serie);
+    e_procesos = jacobiProcesos(&A, b, x_procesos, &corto, 3, &r_procesos);
+    iguales = (e_serie == e_procesos && r_serie.iteraciones == r_procesos.iteraciones);
+    for (int i = 0; i < n; i++)
+        if (x_serie[i] != x_procesos[i]) iguales = 0;
+    verificar("MAX_ITER tras 7 barridos: mismo resultado con 3 procesos", iguales);
+
+    liberarMatrizDensa(&A);
+    free(b); free(x_serie); free(x_procesos);
+}
+
+/* ============================================================================
+   TEST 19: ELIMINACIÓN DE GAUSS FUERA DE MEMORIA (PANELES EN DISCO)
+   ============================================================================ */
+void test_lu_en_disco() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 19: LU fuera de memoria por paneles en disco, con lectura anticipada\n");
+    imprimir_linea();
+
+    // Matriz general (no diagonal dominante: hace falta pivotear), x exacta = 1
+    int n = 300;
+    MatrizDensa A;
+    crearMatrizDensa(&A, n, n);
+    double *b = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    double *x_lu = malloc(n * sizeof(double));
+    srand(19);
+    for (int i = 0; i < n; i++) {
+        b[i] = 0.0;
+        for (int j = 0; j < n; j++) {
+            MD(&A, i, j) = (double)rand() / RAND_MAX - 0.5;
+            b[i] += MD(&A, i, j);
+        }
+    }
+
+    // Presupuesto para paneles de 16 columnas: 19 paneles, el último de 12
+    MatrizEnDisco M;
+    size_t memoria = (size_t)PANELES_EN_MEMORIA * n * sizeof(double) * 16;
+    int error_carga = crearMatrizEnDisco(&M, NULL, n, memoria) || cargarMatrizEnDisco(&M, &A);
+    printf("    n = %d: %d paneles de %d columnas (%zu KB de paneles en memoria)\n",
+           n, M.num_paneles, M.ancho_panel, memoria / 1024);
+    verificar("Matriz cargada en el archivo de paneles", !error_carga && M.ancho_panel == 16);
+
+    EstadoSolver estado = factorizarEnDisco(&M);
+    if (estado == SOLVER_OK)
+        estado = resolverEnDisco(&M, b, x);
+
+    FactorizacionLU F;
+    factorizarLU(&A, &F, TAM_BLOQUE_LU);
+    resolverLU(&F, b, x_lu);
+    int mismos_pivotes = 1;
+    double diferencia = 0.0, error = 0.0;
+    for (int i = 0; i < n; i++) {
+        if (M.pivotes[i] != F.pivotes[i]) mismos_pivotes = 0;
+        diferencia = fmax(diferencia, fabs(x[i] - x_lu[i]));
+        error = fmax(error, fabs(x[i] - 1.0));
+    }
+    printf("    max |x - 1| = %.2e, max |x - x_LU| = %.2e\n", error, diferencia);
+    verificar("Resuelve el sistema (error < 1e-10)", estado == SOLVER_OK && error < 1e-10);
+    verificar("Mismos pivotes que factorizarLU", mismos_pivotes);
+    verificar("Misma solución que LU en memoria (diferencia < 1e-12)", diferencia < 1e-12);
+    liberarFactorizacionLU(&F);
+
+    // La factorización queda en el archivo: otro b sin volver a factorizar, en el lugar
+    for (int i = 0; i < n; i++) x[i] = b[i];
+    estado = resolverEnDisco(&M, x, x);
+    error = 0.0;
+    for (int i = 0; i < n; i++) error = fmax(error, fabs(x[i] - 1.0));
+    verificar("Reutiliza la factorización (x puede ser b)", estado == SOLVER_OK && error < 1e-10);
+    cerrarMatrizEnDisco(&M);
+
+    // Todo en un panel (memoria suficiente): el mismo resultado
+    crearMatrizEnDisco(&M, NULL, n, (size_t)1 << 30);
+    cargarMatrizEnDisco(&M, &A);
+    estado = factorizarEnDisco(&M);
+    if (estado == SOLVER_OK)
+        estado = resolverEnDisco(&M, b, x);
+    error = 0.0;
+    for (int i = 0; i < n; i++) error = fmax(error, fabs(x[i] - 1.0));
+    verificar("Un solo panel", estado == SOLVER_OK && M.num_paneles == 1 && error < 1e-10);
+    cerrarMatrizEnDisco(&M);
+
+    // Singular: con la columna 200 nula su pivote es exactamente cero
+    for (int i = 0; i < n; i++) MD(&A, i, 200) = 0.0;
+    crearMatrizEnDisco(&M, NULL, n, memoria);
+    cargarMatrizEnDisco(&M, &A);
+    estado = factorizarEnDisco(&M);
+    verificar("Detecta la matriz singular", estado == SOLVER_SINGULAR);
+    cerrarMatrizEnDisco(&M);
+
+    liberarMatrizDensa(&A);
+    free(b); free(x); free(x_lu);
+}
+
+/* ============================================================================
+   TEST 20: NÚCLEOS SIMD (AVX2 / AVX-512) CONTRA LA VERSIÓN ESCALAR
+   ============================================================================ */
+void test_nucleos_simd() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 20: Núcleos SIMD con selección por procesador\n");
+    imprimir_linea();
+
+    NivelSimd disponible = nivelSimdDisponible();
+    printf("    Nivel disponible: %s\n", nombreNivelSimd(disponible));
+    verificar("fijarNivelSimd no activa un nivel no soportado",
+              fijarNivelSimd(SIMD_AVX512) == disponible);
+
+    // Largos que cubren el bucle principal y todos los restos (hasta 16 + 15)
+    int max_n = 64, paso = 13;
+    double *u = malloc(max_n * paso * sizeof(double));
+    double *v = malloc(max_n * sizeof(double));
+    double *y_ref = malloc(max_n * sizeof(double));
+    double *y = malloc(max_n * sizeof(double));
+    srand(20);
+    for (int k = 0; k < max_n * paso; k++) u[k] = (double)rand() / RAND_MAX - 0.5;
+    for (int k = 0; k < max_n; k++) v[k] = (double)rand() / RAND_MAX - 0.5;
+
+    for (int nivel = SIMD_ESCALAR; nivel <= (int)disponible; nivel++) {
+        int axpy_ok = 1, producto_ok = 1, argmax_ok = 1;
+        for (int n = 0; n <= 40; n++) {
+            fijarNivelSimd(SIMD_ESCALAR);
+            for (int k = 0; k < n; k++) y_ref[k] = y[k] = v[k];
+            axpySimd(y_ref, u, -0.75, n);
+            double p_ref = productoEscalarSimd(u, v, n);
+            int i_ref = indiceMaximoAbsSimd(u, n, 1);
+            int i_paso_ref = indiceMaximoAbsSimd(u, n, paso);
+
+            // y[n] no se toca: y puede ser el principio de una fila más larga
+            if (n < max_n) y[n] = 12345.0;
+            fijarNivelSimd((NivelSimd)nivel);
+            axpySimd(y, u, -0.75, n);
+            for (int k = 0; k < n; k++)
+                if (fabs(y[k] - y_ref[k]) > 1e-15) axpy_ok = 0;
+            if (n < max_n && y[n] != 12345.0) axpy_ok = 0;
+            if (fabs(productoEscalarSimd(u, v, n) - p_ref) > 1e-13) producto_ok = 0;
+            if (indiceMaximoAbsSimd(u, n, 1) != i_ref) argmax_ok = 0;
+            if (indiceMaximoAbsSimd(u, n, paso) != i_paso_ref) argmax_ok = 0;
+        }
+        char desc[96];
+        sprintf(desc, "%s: axpy coincide con la versión escalar", nombreNivelSimd((NivelSimd)nivel));
+        verificar(desc, axpy_ok);
+        sprintf(desc, "%s: producto escalar coincide (1e-13)", nombreNivelSimd((NivelSimd)nivel));
+        verificar(desc, producto_ok);
+        sprintf(desc, "%s: mismo pivote (contiguo y con paso)", nombreNivelSimd((NivelSimd)nivel));
+        verificar(desc, argmax_ok);
+
+        // Empates, signo y NaN: el primer índice con el mayor |v|, sin contar los NaN
+        double w[19] = { 1, -3, 2, 3, 0, -3, 1, 1, 2, 0, 0, 3, 1, 1, 1, -2, 3, 0, 0 };
+        int empate = indiceMaximoAbsSimd(w, 19, 1);
+        w[1] = NAN;
+        int con_nan = indiceMaximoAbsSimd(w, 19, 1);
+        w[18] = -4.0;
+        int al_final = indiceMaximoAbsSimd(w, 19, 1);
+        sprintf(desc, "%s: empates, NaN y máximo en el resto", nombreNivelSimd((NivelSimd)nivel));
+        verificar(desc, empate == 1 && con_nan == 3 && al_final == 18);
+    }
+
+    // Gauss con los núcleos del nivel disponible: mismo resultado que el escalar
+    fijarNivelSimd(disponible);
+    int n = 203;
+    MatrizDensa A, copia;
+    crearMatrizDensa(&A, n, n);
+    double *b = malloc(n * sizeof(double));
+    double *b_copia = malloc(n * sizeof(double));
+    double *x = malloc(n * sizeof(double));
+    double *x_escalar = malloc(n * sizeof(double));
+    for (int i = 0; i < n; i++) {
+        b[i] = 0.0;
+        for (int j = 0; j < n; j++) {
+            MD(&A, i, j) = (double)rand() / RAND_MAX - 0.5;
+            b[i] += MD(&A, i, j);
+        }
+    }
+    copiarMatrizDensa(&copia, &A);
+    for (int i = 0; i < n; i++) b_copia[i] = b[i];
+    EstadoSolver estado = eliminacionGaussDensa(&copia, b_copia, x, NULL);
+
+    fijarNivelSimd(SIMD_ESCALAR);
+    liberarMatrizDensa(&copia);
+    copiarMatrizDensa(&copia, &A);
+    for (int i = 0; i < n; i++) b_copia[i] = b[i];
+    eliminacionGaussDensa(&copia, b_copia, x_escalar, NULL);
+    fijarNivelSimd(disponible);
+
+    double error = 0.0, diferencia = 0.0;
+    for (int i = 0; i < n; i++) {
+        error = fmax(error, fabs(x[i] - 1.0));
+        diferencia = fmax(diferencia, fabs(x[i] - x_escalar[i]));
+    }
+    printf("    n = %d con %s: max |x - 1| = %.2e, max |x - x_escalar| = %.2e\n",
+           n, nombreNivelSimd(disponible), error, diferencia);
+    verificar("eliminacionGaussDensa resuelve con los núcleos SIMD", estado == SOLVER_OK && error < 1e-10);
+    verificar("Coincide con la versión escalar (diferencia < 1e-11)", diferencia < 1e-11);
+
+    liberarMatrizDensa(&A);
+    liberarMatrizDensa(&copia);
+    free(u); free(v); free(y_ref); free(y);
+    free(b); free(b_copia); free(x); free(x_escalar);
+}
+
+/* ============================================================================
+   TEST 21: SISTEMAS TRIDIAGONALES CÍCLICOS (SHERMAN-MORRISON)
+   ============================================================================ */
+void test_tridiagonal_ciclico() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 21: Sistemas tridiagonales cíclicos (splines periódicos)\n");
+    imprimir_linea();
+
+    // Sistema no simétrico con esquinas contra Gauss denso, para n chicos y uno grande
+    int tamanios[] = { 1, 2, 3, 4, 300 };
+    int coinciden = 1;
+    double dif_max = 0.0;
+    srand(21);
+    for (int t = 0; t < 5; t++) {
+        int n = tamanios[t];
+        double *inferior = malloc(n * sizeof(double));
+        double *diagonal = malloc(n * sizeof(double));
+        double *superior = malloc(n * sizeof(double));
+        double *d = malloc(n * sizeof(double));
+        double *x = malloc(n * sizeof(double));
+        double *x_denso = malloc(n * sizeof(double));
+        MatrizDensa D;
+        crearMatrizDensa(&D, n, n);
+        for (int i = 0; i < n; i++) {
+            inferior[i] = (double)rand() / RAND_MAX - 0.5;
+            superior[i] = (double)rand() / RAND_MAX - 0.5;
+            diagonal[i] = 2.0 + (double)rand() / RAND_MAX;
+            d[i] = (double)rand() / RAND_MAX;
+            // Índices módulo n: con n <= 2 las esquinas se suman a los vecinos
+            MD(&D, i, i) += diagonal[i];
+            MD(&D, i, (i + n - 1) % n) += inferior[i];
+            MD(&D, i, (i + 1) % n) += superior[i];
+        }
+        EstadoSolver estado = resolverTridiagonalCiclico(n, inferior, diagonal, superior, d, x);
+        EstadoSolver estado_denso = eliminacionGaussDensa(&D, d, x_denso, NULL);
+        if (estado != SOLVER_OK || estado_denso != SOLVER_OK) coinciden = 0;
+        for (int i = 0; i < n; i++)
+            if (fabs(x[i] - x_denso[i]) > dif_max) dif_max = fabs(x[i] - x_denso[i]);
+        liberarMatrizDensa(&D);
+        free(inferior); free(diagonal); free(superior); free(d); free(x); free(x_denso);
+    }
+    printf("    n = 1, 2, 3, 4 y 300: diferencia máxima con Gauss denso %.2e\n", dif_max);
+    verificar("resolverTridiagonalCiclico coincide con eliminacionGaussDensa", coinciden && dif_max < 1e-12);
+
+    // Sistema de un spline periódico con 10^6 nodos, resuelto en el lugar (x == d)
+    int nodos = 1000000;
+    double *h = malloc(nodos * sizeof(double));
+    double *inf = malloc(nodos * sizeof(double));
+    double *dia = malloc(nodos * sizeof(double));
+    double *sup = malloc(nodos * sizeof(double));
+    double *d = malloc(nodos * sizeof(double));
+    double *M = malloc(nodos * sizeof(double));
+    for (int i = 0; i < nodos; i++) h[i] = 1e-3 * (1.0 + 0.5 * sin(i));
+    for (int i = 0; i < nodos; i++) {
+        double h_ant = h[(i + nodos - 1) % nodos];
+        inf[i] = h_ant;
+        dia[i] = 2.0 * (h_ant + h[i]);
+        sup[i] = h[i];
+        d[i] = M[i] = cos(1e-3 * i);
+    }
+    clock_t inicio = clock();
+    EstadoSolver estado = resolverTridiagonalCiclico(nodos, inf, dia, sup, M, M);
+    double t = (double)(clock() - inicio) / CLOCKS_PER_SEC;
+    double residuo = 0.0;
+    for (int i = 0; i < nodos; i++) {
+        double r = fabs(inf[i] * M[(i + nodos - 1) % nodos] + dia[i] * M[i] + sup[i] * M[(i + 1) % nodos] - d[i]);
+        if (r > residuo) residuo = r;
+    }
+    printf("    Spline periódico con %d nodos: %.4f s, residuo máximo %.2e\n", nodos, t, residuo);
+    verificar("Sistema cíclico de 10^6 incógnitas resuelto en O(n)", estado == SOLVER_OK && residuo < 1e-12);
+
+    // Circulante (1, -2, 1): las constantes están en el núcleo. Con n = 1 y 2 el
+    // pivote da exactamente cero (con n mayor el redondeo lo puede evitar, como en Thomas)
+    for (int i = 0; i < 2; i++) { inf[i] = sup[i] = 1.0; dia[i] = -2.0; }
+    verificar("resolverTridiagonalCiclico: circulante (1, -2, 1) -> SINGULAR",
+              resolverTridiagonalCiclico(1, inf, dia, sup, d, M) == SOLVER_SINGULAR &&
+              resolverTridiagonalCiclico(2, inf, dia, sup, d, M) == SOLVER_SINGULAR);
+
+    free(h); free(inf); free(dia); free(sup); free(d); free(M);
+}
+
+/* ============================================================================
+   TEST 22: MODO POR LOTES DEL PROGRAMA (OPCIONES Y UN ARCHIVO)
+   ============================================================================ */
+void test_modo_lotes() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 22: Modo por lotes (opciones, resolverArchivoLote y código de salida)\n");
+    imprimir_linea();
+
+    // 4x + y + z = 6, x + 5y + z = 7, x + y + 4z = 6: x = (1, 1, 1)
+    const char *archivo = "prueba_lote.txt";
+    FILE *f = fopen(archivo, "w");
+    fprintf(f, "4 1 1 6\n1 5 1 7\n1 1 4 6\n");
+    fclose(f);
+
+    OpcionesLote op;
+    const char *argumentos[] = { "sistema.o", "--entrada", archivo, "--metodo", "gauss" };
+    verificar("leerOpcionesLote acepta --entrada y --metodo", leerOpcionesLote(5, argumentos, &op) == 0);
+
+    const char *metodos[] = { "gauss", "lu", "jacobi", "gauss-seidel", "cg", "gmres" };
+    int lineas_ok = 1;
+    for (int k = 0; k < 6; k++) {
+        op.metodo = metodos[k];
+        op.param.tolerancia = 1e-12;
+        FILE *salida = tmpfile();
+        int resultado = resolverArchivoLote(&op, archivo, salida);
+        rewind(salida);
+        char ruta[64], metodo[32], estado[32];
+        int n = 0, iteraciones = 0;
+        double error, x[3];
+        int campos = fscanf(salida, "%63s %31s %d %31s %d %lf %lf %lf %lf", ruta, metodo, &n, estado,
+                            &iteraciones, &error, &x[0], &x[1], &x[2]);
+        fclose(salida);
+        int correcta = resultado == 0 && campos == 9 && n == 3 && strcmp(estado, "OK") == 0 &&
+                       strcmp(metodo, metodos[k]) == 0;
+        for (int i = 0; i < 3 && correcta; i++)
+            if (fabs(x[i] - 1.0) > 1e-9) correcta = 0;
+        if (!correcta) {
+            printf("    %s: resultado %d, %d campos, estado %s\n", metodos[k], resultado, campos, estado);
+            lineas_ok = 0;
+        }
+    }
+    verificar("resolverArchivoLote escribe una línea correcta con cada método", lineas_ok);
+
+    printf("    (se esperan mensajes de error)\n");
+    FILE *salida = tmpfile();
+    verificar("un archivo inexistente devuelve 1 y no escribe resultados",
+              resolverArchivoLote(&op, "no_existe_lote.txt", salida) == 1 && ftell(salida) == 0);
+    fclose(salida);
+
+    const char *tol_invalida[] = { "sistema.o", "--entrada", archivo, "--tol", "abc" };
+    verificar("--tol abc se rechaza", leerOpcionesLote(5, tol_invalida, &op) != 0);
+    const char *iter_invalida[] = { "sistema.o", "--entrada", archivo, "--max-iter", "10x" };
+    verificar("--max-iter 10x se rechaza", leerOpcionesLote(5, iter_invalida, &op) != 0);
+    const char *omega_invalida[] = { "sistema.o", "--entrada", archivo, "--omega", "" };
+    verificar("--omega vacío se rechaza", leerOpcionesLote(5, omega_invalida, &op) != 0);
+    const char *memoria_invalida[] = { "sistema.o", "--entrada", archivo, "--memoria", "0" };
+    verificar("--memoria 0 se rechaza", leerOpcionesLote(5, memoria_invalida, &op) != 0);
+    const char *procesos_invalidos[] = { "sistema.o", "--entrada", archivo, "--procesos", "dos" };
+    verificar("--procesos dos se rechaza", leerOpcionesLote(5, procesos_invalidos, &op) != 0);
+
+    // Programa completo: código de salida 0 y una sola línea en el archivo de resultados
+    const char *resultados = "prueba_lote_salida.txt";
+    const char *completo[] = { "sistema.o", "--entrada", archivo, "--metodo", "lu", "--salida", resultados };
+    int codigo = modoLotes(7, completo);
+    f = fopen(resultados, "r");
+    int lineas = 0;
+    for (int c; f != NULL && (c = fgetc(f)) != EOF;)
+        if (c == '\n') lineas++;
+    if (f != NULL) fclose(f);
+    verificar("modoLotes termina con 0 y escribe una línea", codigo == 0 && lineas == 1);
+
+    // --dir con un sistema y un subdirectorio: el subdirectorio no cuenta como sistema
+    const char *directorio = "prueba_lote_dir";
+    mkdir(directorio, 0700);
+    mkdir("prueba_lote_dir/sub", 0700);
+    f = fopen("prueba_lote_dir/a.txt", "w");
+    fprintf(f, "4 1 1 6\n1 5 1 7\n1 1 4 6\n");
+    fclose(f);
+    const char *con_dir[] = { "sistema.o", "--dir", directorio, "--salida", resultados };
+    codigo = modoLotes(5, con_dir);
+    f = fopen(resultados, "r");
+    lineas = 0;
+    for (int c; f != NULL && (c = fgetc(f)) != EOF;)
+        if (c == '\n') lineas++;
+    if (f != NULL) fclose(f);
+    verificar("--dir saltea los subdirectorios (código 0, una línea)", codigo == 0 && lineas == 1);
+    remove("prueba_lote_dir/a.txt");
+    rmdir("prueba_lote_dir/sub");
+    rmdir(directorio);
+
+    // Disco lleno: el error aparece al vaciar el buffer y el código de salida es 1
+    if (access("/dev/full", W_OK) == 0) {
+        const char *lleno[] = { "sistema.o", "--entrada", archivo, "--salida", "/dev/full" };
+        verificar("Error al escribir los resultados (/dev/full) -> código 1", modoLotes(5, lleno) == 1);
+    }
+
+    remove(archivo);
+    remove(resultados);
+}
+
+/* ============================================================================
+   TEST 23: INTERPOLACIÓN DE LAGRANGE BARICÉNTRICA
+   ============================================================================ */
+void test_lagrange_baricentrico() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 23: Interpolación de Lagrange en forma baricéntrica\n");
+    imprimir_linea();
+
+    // f(x) = x³ - 2x + 1 en 6 nodos desordenados: el interpolante es f
+    double x[] = { 0.5, -1.0, 2.0, 0.0, 1.5, -0.25 };
+    double y[6];
+    for (int k = 0; k < 6; k++) y[k] = x[k] * x[k] * x[k] - 2.0 * x[k] + 1.0;
+    InterpoladorBaricentrico P;
+    int error = crearInterpoladorBaricentrico(&P, x, y, 6);
+
+    int exacto_en_nodos = 1;
+    for (int k = 0; k < 6; k++)
+        if (evaluarBaricentrico(&P, x[k]) != y[k]) exacto_en_nodos = 0;
+    verificar("En cada nodo devuelve exactamente y_k", error == 0 && exacto_en_nodos);
+
+    // Cerca de un nodo x - x_k es diminuto; la fórmula sigue estable
+    double dif_cerca = 0.0;
+    double desvios[] = { 1e-300, 1e-15, 1e-12, 1e-8, -1e-10 };
+    for (int k = 0; k < 6; k++)
+        for (int i = 0; i < 5; i++) {
+            double t = x[k] + desvios[i];
+            double f = t * t * t - 2.0 * t + 1.0;
+            double p = evaluarBaricentrico(&P, t);
+            if (!(fabs(p - f) <= dif_cerca)) dif_cerca = fabs(p - f);
+        }
+    printf("    A 1e-300..1e-8 de los nodos: diferencia máxima con f %.2e\n", dif_cerca);
+    verificar("Cerca de los nodos el valor es finito y correcto", dif_cerca < 1e-13);
+
+    // Las bases de Lagrange suman 1 en cualquier x
+    double suma_bases = 0.0;
+    for (int k = 0; k < 6; k++) suma_bases += baseLagrangeBaricentrica(&P, k, 0.3);
+    verificar("Σ L_k(x) = 1", fabs(suma_bases - 1.0) < 1e-14);
+
+    // Evaluación vectorial: mismos sumandos en el mismo orden -> idéntica
+    double xs[37], px[37];
+    int identicos = 1;
+    for (int i = 0; i < 37; i++) xs[i] = -1.2 + 0.09 * i;
+    xs[5] = x[2];   // Un nodo dentro del bloque
+    evaluarBaricentricoVector(&P, xs, px, 37);
+    for (int i = 0; i < 37; i++)
+        if (px[i] != evaluarBaricentrico(&P, xs[i])) identicos = 0;
+    verificar("evaluarBaricentricoVector idéntico a evaluarBaricentrico", identicos);
+
+    // Agregar nodos uno a uno vs reconstruir con todos (f = cos en Chebyshev)
+    int n = 40;
+    double *xc = malloc(n * sizeof(double));
+    double *yc = malloc(n * sizeof(double));
+    for (int k = 0; k < n; k++) {
+        xc[k] = cos(M_PI * (2.0 * k + 1.0) / (2.0 * n));
+        yc[k] = cos(3.0 * xc[k]);
+    }
+    InterpoladorBaricentrico incremental, completo;
+    crearInterpoladorBaricentrico(&incremental, xc, yc, 2);
+    int agregados = 1;
+    for (int k = 2; k < n; k++)
+        if (agregarNodoBaricentrico(&incremental, xc[k], yc[k]) != 0) agregados = 0;
+    crearInterpoladorBaricentrico(&completo, xc, yc, n);
+    double dif_pesos = 0.0, dif_valores = 0.0;
+    for (int k = 0; k < n; k++) {
+        // Los pesos dependen de la escala: se comparan relativos al primero
+        double r = (incremental.mantisas[k] / incremental.mantisas[0]) *
+                   ldexp(1.0, incremental.exponentes[k] - incremental.exponentes[0]);
+        double c = (completo.mantisas[k] / completo.mantisas[0]) *
+                   ldexp(1.0, completo.exponentes[k] - completo.exponentes[0]);
+        if (fabs(r / c - 1.0) > dif_pesos) dif_pesos = fabs(r / c - 1.0);
+    }
+    for (int i = 0; i <= 200; i++) {
+        double t = -1.0 + 0.01 * i;
+        double d = fabs(evaluarBaricentrico(&incremental, t) - evaluarBaricentrico(&completo, t));
+        if (d > dif_valores) dif_valores = d;
+    }
+    printf("    %d nodos agregados uno a uno: pesos a %.2e (relativo), valores a %.2e\n",
+           n - 2, dif_pesos, dif_valores);
+    verificar("agregarNodoBaricentrico coincide con reconstruir",
+              agregados && incremental.n == n && dif_pesos < 1e-12 && dif_valores < 1e-13);
+    verificar("agregarNodoBaricentrico rechaza un nodo repetido (sin cambios)",
+              agregarNodoBaricentrico(&incremental, xc[7], 0.0) == 1 && incremental.n == n);
+
+    liberarInterpoladorBaricentrico(&P);
+    liberarInterpoladorBaricentrico(&incremental);
+    liberarInterpoladorBaricentrico(&completo);
+    free(xc); free(yc);
+}
+
+/* ============================================================================
+   TEST 24: INTERPOLACIÓN DE NEWTON CON DIFERENCIAS DIVIDIDAS
+   ============================================================================ */
+void test_newton_diferencias() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 24: Interpolación de Newton (diferencias divididas)\n");
+    imprimir_linea();
+
+    // Nodos agregados de a uno contra la tabla completa con los mismos nodos y orden
+    int n = 12;
+    double x[12], y[12];
+    for (int k = 0; k < n; k++) {
+        x[k] = ((k * 7) % n) * 0.25 - 1.0;  // Permutación de la grilla: orden no creciente
+        y[k] = exp(x[k]);
+    }
+    InterpoladorNewton incremental, completo;
+    crearInterpoladorNewton(&incremental, NULL, NULL, 0);
+    int agregados = 1;
+    for (int k = 0; k < n; k++)
+        if (agregarNodoNewton(&incremental, x[k], y[k]) != 0) agregados = 0;
+    int error = crearInterpoladorNewton(&completo, x, y, n);
+    double dif_coef = 0.0, dif_valores = 0.0;
+    for (int k = 0; k < n; k++) {
+        double d = fabs(incremental.coeficientes[k] - completo.coeficientes[k]);
+        if (d > dif_coef) dif_coef = d;
+    }
+    int exacto_en_nodos = 1;
+    for (int k = 0; k < n; k++)
+        if (fabs(evaluarNewton(&incremental, x[k]) - y[k]) > 1e-13) exacto_en_nodos = 0;
+    for (int i = 0; i <= 100; i++) {
+        double t = -1.0 + 0.0275 * i;
+        double d = fabs(evaluarNewton(&incremental, t) - evaluarNewton(&completo, t));
+        if (d > dif_valores) dif_valores = d;
+    }
+    printf("    %d nodos agregados de a uno: coeficientes a %.2e, valores a %.2e\n",
+           n, dif_coef, dif_valores);
+    verificar("agregarNodoNewton coincide con la tabla completa",
+              agregados && error == 0 && incremental.n == n && dif_coef < 1e-12 && dif_valores < 1e-14);
+    verificar("P(x_k) = y_k en todos los nodos", exacto_en_nodos);
+    verificar("agregarNodoNewton rechaza un nodo repetido (sin cambios)",
+              agregarNodoNewton(&incremental, x[3], 0.0) == 1 && incremental.n == n);
+
+    // Base de monomios: los 4 puntos de p(x) = 2 - x + 3x² - 0.5x³ dan sus coeficientes
+    double a_exactos[4] = { 2.0, -1.0, 3.0, -0.5 };
+    double xp[4] = { 3.0, -1.0, 0.5, 2.0 }, yp[4], a[4];
+    for (int k = 0; k < 4; k++)
+        yp[k] = a_exactos[0] + xp[k] * (a_exactos[1] + xp[k] * (a_exactos[2] + xp[k] * a_exactos[3]));
+    InterpoladorNewton cubico;
+    crearInterpoladorNewton(&cubico, xp, yp, 4);
+    coeficientesMonomiosNewton(&cubico, a);
+    double dif_monomios = 0.0;
+    for (int i = 0; i < 4; i++)
+        if (fabs(a[i] - a_exactos[i]) > dif_monomios) dif_monomios = fabs(a[i] - a_exactos[i]);
+    printf("    Monomios: %.4f %+.4f x %+.4f x² %+.4f x³\n", a[0], a[1], a[2], a[3]);
+    verificar("coeficientesMonomiosNewton recupera el polinomio", dif_monomios < 1e-13);
+
+    // Los monomios del interpolante de exp evaluados con Horner dan los mismos valores
+    double *monomios = malloc(n * sizeof(double));
+    coeficientesMonomiosNewton(&completo, monomios);
+    double dif_horner = 0.0;
+    for (int i = 0; i <= 20; i++) {
+        double t = -1.0 + 0.1375 * i, p = 0.0;
+        for (int j = n - 1; j >= 0; j--) p = p * t + monomios[j];
+        if (fabs(p - evaluarNewton(&completo, t)) > dif_horner) dif_horner = fabs(p - evaluarNewton(&completo, t));
+    }
+    verificar("Monomios y forma de Newton coinciden en [-1, 1.75]", dif_horner < 1e-12);
+
+    liberarInterpoladorNewton(&incremental);
+    liberarInterpoladorNewton(&completo);
+    liberarInterpoladorNewton(&cubico);
+    free(monomios);
+}
+
+/* Tramo de x por búsqueda lineal: mayor k en [0, n-2] con x_k <= x */
+int tramo_lineal(const double *nodos, int n, double x) {
+    int k = 0;
+    while (k < n - 2 && nodos[k + 1] <= x) k++;
+    return k;
+}
+
+/* ============================================================================
+   TEST 25: SPLINE CÚBICO REUTILIZABLE (TRAMOS, EVALUACIÓN ORDENADA, INTEGRAL)
+   ============================================================================ */
+void test_spline_cubico() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 25: Spline cúbico (búsqueda de tramo, evaluación ordenada, integral)\n");
+    imprimir_linea();
+
+    // Nodos equiespaciados con paso 0.1 (no representable) y no equiespaciados
+    int n = 31;
+    double x_unif[31], x_no_unif[31], y_unif[31], y_no_unif[31];
+    for (int k = 0; k < n; k++) {
+        x_unif[k] = 1.0 + 0.1 * k;
+        x_no_unif[k] = 1.0 + 3.0 * (k / 30.0) * (k / 30.0);
+        y_unif[k] = sin(x_unif[k]);
+        y_no_unif[k] = sin(x_no_unif[k]);
+    }
+    SplineCubico U, V;
+    int error = crearSplineCubico(&U, x_unif, y_unif, n) | crearSplineCubico(&V, x_no_unif, y_no_unif, n);
+    verificar("Se detectan los nodos equiespaciados", error == 0 && U.uniforme && !V.uniforme);
+
+    // Tramo en los nodos, a 1 ulp de ellos, en puntos interiores y fuera del rango
+    int tramos_ok = 1, consultas = 0;
+    const double *nodos[2] = { x_unif, x_no_unif };
+    const SplineCubico *splines[2] = { &U, &V };
+    for (int s = 0; s < 2; s++) {
+        const double *xn = nodos[s];
+        for (int k = 0; k < n; k++) {
+            double consulta[4] = { xn[k], nextafter(xn[k], -INFINITY), nextafter(xn[k], INFINITY),
+                                   k < n - 1 ? 0.5 * (xn[k] + xn[k + 1]) : xn[k] + 1.0 };
+            for (int i = 0; i < 4; i++, consultas++)
+                if (tramoSplineCubico(splines[s], consulta[i]) != tramo_lineal(xn, n, consulta[i]))
+                    tramos_ok = 0;
+        }
+        if (tramoSplineCubico(splines[s], 0.0) != 0 || tramoSplineCubico(splines[s], NAN) != 0)
+            tramos_ok = 0;
+    }
+    printf("    %d consultas de tramo contra búsqueda lineal\n", consultas);
+    verificar("tramoSplineCubico correcto con nodos uniformes y no uniformes", tramos_ok);
+
+    int interpola = 1;
+    for (int k = 0; k < n; k++)
+        if (fabs(evaluarSplineCubico(&U, x_unif[k]) - y_unif[k]) > 1e-15 ||
+            fabs(evaluarSplineCubico(&V, x_no_unif[k]) - y_no_unif[k]) > 1e-15) interpola = 0;
+    verificar("S(x_k) = y_k", interpola);
+
+    // Consultas crecientes, luego hacia atrás, y de nuevo crecientes: igual que una a una
+    int m = 200;
+    double *xs = malloc(m * sizeof(double));
+    double *ys = malloc(m * sizeof(double));
+    double *en_lugar = malloc(m * sizeof(double));
+    for (int i = 0; i < m; i++) {
+        if (i < 80) xs[i] = 0.8 + 0.03 * i;              // Desde antes de x_0
+        else if (i < 140) xs[i] = 4.3 - 0.05 * (i - 80); // Retrocede hasta pasar x_0
+        else xs[i] = 1.0 + 0.04 * (i - 140);             // Avanza otra vez
+        en_lugar[i] = xs[i];
+    }
+    int ordenado_ok = 1;
+    for (int s = 0; s < 2; s++) {
+        evaluarSplineCubicoOrdenado(splines[s], xs, ys, m);
+        for (int i = 0; i < m; i++)
+            if (ys[i] != evaluarSplineCubico(splines[s], xs[i])) ordenado_ok = 0;
+    }
+    evaluarSplineCubicoOrdenado(&V, en_lugar, en_lugar, m);
+    for (int i = 0; i < m; i++)
+        if (en_lugar[i] != ys[i]) ordenado_ok = 0;
+    verificar("evaluarSplineCubicoOrdenado idéntico aunque las consultas retrocedan (y en el lugar)",
+              ordenado_ok);
+
+    // Integral contra Simpson por tramo (exacto para cúbicas) entre a y b
+    double a = 1.234, b = 3.71;
+    double referencia = 0.0;
+    for (int k = 0; k < n - 1; k++) {
+        double izq = fmax(a, x_no_unif[k]), der = fmin(b, x_no_unif[k + 1]);
+        if (izq >= der) continue;
+        referencia += (der - izq) / 6.0 * (evaluarSplineCubico(&V, izq) +
+                      4.0 * evaluarSplineCubico(&V, 0.5 * (izq + der)) + evaluarSplineCubico(&V, der));
+    }
+    double integral = integralSplineCubico(&V, a, b);
+    printf("    ∫ S de %.3f a %.3f: %.15f (Simpson por tramo %.15f, ∫ sin %.15f)\n",
+           a, b, integral, referencia, cos(a) - cos(b));
+    verificar("integralSplineCubico exacta para el spline",
+              fabs(integral - referencia) < 1e-13 && integralSplineCubico(&V, b, a) == -integral);
+    verificar("integralSplineCubico aproxima ∫ sin", fabs(integral - (cos(a) - cos(b))) < 5e-5);
+    verificar("∫ de x_0 a x_{n-1} con nodos uniformes y no uniformes",
+              fabs(integralSplineCubico(&U, 1.0, 4.0) - (cos(1.0) - cos(4.0))) < 5e-5 &&
+              integralSplineCubico(&V, 2.0, 2.0) == 0.0);
+
+    liberarSplineCubico(&U);
+    liberarSplineCubico(&V);
+    free(xs); free(ys); free(en_lugar);
+}
+
+/* ============================================================================
+   TEST 26: CONDICIONES DE FRONTERA DEL SPLINE CÚBICO
+   ============================================================================ */
+void test_frontera_spline() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 26: Splines sujeto, not-a-knot, periódico y natural\n");
+    imprimir_linea();
+
+    // La cúbica p(x) = x³ - 2x² + 0.5 está en el espacio de los splines: las
+    // fronteras sujeta (con p' exacta) y not-a-knot la reproducen
+    int n = 9;
+    double x[9], y[9];
+    for (int k = 0; k < n; k++) {
+        x[k] = -1.0 + 0.4 * k + 0.05 * (k % 3);   // No equiespaciados
+        y[k] = x[k] * x[k] * x[k] - 2.0 * x[k] * x[k] + 0.5;
+    }
+    CondicionFrontera sujeta = { FRONTERA_SUJETA, 3.0 * x[0] * x[0] - 4.0 * x[0],
+                                 3.0 * x[n - 1] * x[n - 1] - 4.0 * x[n - 1] };
+    CondicionFrontera no_nodo = { FRONTERA_NO_NODO, 0.0, 0.0 };
+    CondicionFrontera natural = { FRONTERA_NATURAL, 0.0, 0.0 };
+    SplineCubico Sj, Nn, Nt;
+    int error = crearSplineCubicoFrontera(&Sj, x, y, n, &sujeta) |
+                crearSplineCubicoFrontera(&Nn, x, y, n, &no_nodo) |
+                crearSplineCubicoFrontera(&Nt, x, y, n, &natural);
+    double dif_sujeta = 0.0, dif_no_nodo = 0.0;
+    for (int i = 0; i <= 100; i++) {
+        double t = x[0] + (x[n - 1] - x[0]) * i / 100.0;
+        double p = t * t * t - 2.0 * t * t + 0.5;
+        dif_sujeta = fmax(dif_sujeta, fabs(evaluarSplineCubico(&Sj, t) - p));
+        dif_no_nodo = fmax(dif_no_nodo, fabs(evaluarSplineCubico(&Nn, t) - p));
+    }
+    printf("    Cúbica: diferencia máxima sujeta %.2e, not-a-knot %.2e\n", dif_sujeta, dif_no_nodo);
+    verificar("Sujeta reproduce la cúbica y respeta S'(x_0) y S'(x_{n-1})",
+              error == 0 && dif_sujeta < 1e-13 &&
+              fabs(derivadaSplineCubico(&Sj, x[0], 1) - sujeta.derivada_inicial) < 1e-13 &&
+              fabs(derivadaSplineCubico(&Sj, x[n - 1], 1) - sujeta.derivada_final) < 1e-13);
+    // Not-a-knot: S''' es la misma a ambos lados de x_1 y x_{n-2}
+    double salto = fabs(derivadaSplineCubico(&Nn, nextafter(x[1], -INFINITY), 3) -
+                        derivadaSplineCubico(&Nn, x[1], 3)) +
+                   fabs(derivadaSplineCubico(&Nn, nextafter(x[n - 2], -INFINITY), 3) -
+                        derivadaSplineCubico(&Nn, x[n - 2], 3));
+    verificar("Not-a-knot reproduce la cúbica, S''' continua en x_1 y x_{n-2}",
+              dif_no_nodo < 1e-13 && salto < 1e-10);
+    verificar("Natural: S''(x_0) = S''(x_{n-1}) = 0",
+              fabs(derivadaSplineCubico(&Nt, x[0], 2)) < 1e-13 &&
+              fabs(derivadaSplineCubico(&Nt, x[n - 1], 2)) < 1e-13);
+
+    // Not-a-knot con 3 nodos: la parábola 1 + x² por los tres puntos
+    double x3[3] = { 0.0, 1.0, 3.0 }, y3[3] = { 1.0, 2.0, 10.0 };
+    SplineCubico P3;
+    crearSplineCubicoFrontera(&P3, x3, y3, 3, &no_nodo);
+    verificar("Not-a-knot con 3 nodos da la parábola",
+              fabs(evaluarSplineCubico(&P3, 2.0) - 5.0) < 1e-13 &&
+              fabs(derivadaSplineCubico(&P3, 0.5, 3)) < 1e-13);
+
+    // Periódica: cos en [0, 2π] con y_0 = y_{n-1}
+    int np = 25;
+    double *xp = malloc(np * sizeof(double));
+    double *yp = malloc(np * sizeof(double));
+    for (int k = 0; k < np; k++) {
+        xp[k] = 2.0 * M_PI * k / (np - 1);
+        yp[k] = cos(xp[k]);
+    }
+    yp[np - 1] = yp[0];
+    CondicionFrontera periodica = { FRONTERA_PERIODICA, 0.0, 0.0 };
+    SplineCubico Pe;
+    error = crearSplineCubicoFrontera(&Pe, xp, yp, np, &periodica);
+    double T = xp[np - 1] - xp[0];
+    double saltos = 0.0;
+    for (int orden = 0; orden <= 2; orden++) {
+        // Límite por izquierda en x_{n-1} (último tramo, a 1 ulp) contra el valor en x_0
+        double izq = derivadaSplineCubico(&Pe, nextafter(xp[np - 1], -INFINITY), orden);
+        double der = derivadaSplineCubico(&Pe, xp[0], orden);
+        saltos = fmax(saltos, fabs(izq - der));
+    }
+    double dif_periodo = 0.0, dif_cos = 0.0;
+    for (int i = 0; i <= 50; i++) {
+        double t = 0.37 + 0.1 * i;
+        dif_periodo = fmax(dif_periodo, fabs(evaluarSplineCubico(&Pe, t + T) - evaluarSplineCubico(&Pe, t)));
+        dif_periodo = fmax(dif_periodo, fabs(evaluarSplineCubico(&Pe, t - 2.0 * T) - evaluarSplineCubico(&Pe, t)));
+        dif_cos = fmax(dif_cos, fabs(evaluarSplineCubico(&Pe, t) - cos(t)));
+    }
+    printf("    Periódica: saltos de S, S', S'' en los extremos %.2e, error contra cos %.2e\n", saltos, dif_cos);
+    verificar("Periódica: S, S' y S'' coinciden en x_0 y x_{n-1}", error == 0 && saltos < 1e-12);
+    verificar("Periódica: se repite fuera de [x_0, x_{n-1}] y aproxima cos",
+              dif_periodo < 1e-12 && dif_cos < 1e-4);
+    verificar("Periódica: ∫ de un período = 0 y cada vuelta suma un período",
+              fabs(integralSplineCubico(&Pe, 0.3, 0.3 + T)) < 1e-12 &&
+              fabs(integralSplineCubico(&Pe, 0.3, 0.9 + 2.0 * T) - integralSplineCubico(&Pe, 0.3, 0.9)) < 1e-12);
+    yp[np - 1] = 1.001;
+    SplineCubico rechazado;
+    verificar("Periódica rechaza y_0 != y_{n-1}", crearSplineCubicoFrontera(&rechazado, xp, yp, np, &periodica) == 1);
+
+    liberarSplineCubico(&Sj);
+    liberarSplineCubico(&Nn);
+    liberarSplineCubico(&Nt);
+    liberarSplineCubico(&P3);
+    liberarSplineCubico(&Pe);
+    free(xp); free(yp);
+}
+
+/* ============================================================================
+   TEST 27: REMUESTREO DE SPLINES Y FORMATO RÁPIDO DE TABLAS
+   ============================================================================ */
+void test_remuestreo_spline() {
+    printf("\n");
+    imprimir_linea();
+    printf("  TEST 27: Remuestreo de splines y formato de decimales sin printf\n");
+    imprimir_linea();
+
+    // formatearDecimal byte a byte contra snprintf("%.*f"): casos límite y aleatorios
+    double especiales[] = { 0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.375, 1e-20, -1e-20,
+                            0.05, 0.15, 0.25, 0.35, 1.005, 2.675, 9.9995, 99.995, 0.9999999,
+                            123456789.987654321, 4e15, 3.9999e15, 1e300, -1e300, 5e-324,
+                            INFINITY, -INFINITY, NAN, 4503599627370495.5, 1.0 / 3.0, M_PI };
+    int total = 0, distintos = 0;
+    char rapido[LARGO_MAX_DECIMAL], referencia[LARGO_MAX_DECIMAL];
+    for (int i = 0; i < (int)(sizeof(especiales) / sizeof(especiales[0])); i++)
+        for (int d = 0; d <= DECIMALES_MAX; d++, total++) {
+            int largo = formatearDecimal(especiales[i], d, rapido);
+            snprintf(referencia, sizeof(referencia), "%.*f", d, especiales[i]);
+            if (strcmp(rapido, referencia) != 0 || largo != (int)strlen(referencia)) {
+                if (distintos++ < 3)
+                    printf("    %.17g con %d decimales: \"%s\" en lugar de \"%s\"\n",
+                           especiales[i], d, rapido, referencia);
+            }
+        }
+    // Empates exactos k + 0.5 / 10^d (y sus vecinos) y valores aleatorios de varias escalas
+    srand(27);
+    for (int i = 0; i < 200000; i++, total++) {
+        int d = rand() % (DECIMALES_MAX + 1);
+        double v;
+        if (i % 4 == 0)
+            v = ((rand() % 100000) + 0.5) / 1024.0;     // Binario exacto: empates en muchos d
+        else
+            v = ((double)rand() / RAND_MAX - 0.5) * pow(10.0, rand() % 16 - 6);
+        if (i % 3 == 0) v = nextafter(v, (i % 2) ? INFINITY : -INFINITY);
+        int largo = formatearDecimal(v, d, rapido);
+        snprintf(referencia, sizeof(referencia), "%.*f", d, v);
+        if (strcmp(rapido, referencia) != 0 || largo != (int)strlen(referencia)) {
+            if (distintos++ < 3)
+                printf("    %.17g con %d decimales: \"%s\" en lugar de \"%s\"\n", v, d, rapido, referencia);
+        }
+    }
+    printf("    %d valores comparados con snprintf, %d distintos\n", total, distintos);
+    verificar("formatearDecimal idéntico byte a byte a \"%.*f\"", distintos == 0);
+
+    // Remuestreo en paralelo igual al secuencial, y escritura en texto igual a fprintf
+    int n = 101, m = 10007;
+    double x[101], y[101];
+    for (int k = 0; k < n; k++) { x[k] = 0.05 * k; y[k] = sin(x[k]) * exp(-0.2 * x[k]); }
+    SplineCubico S;
+    crearSplineCubico(&S, x, y, n);
+    double *xs = malloc(m * sizeof(double)), *ys = malloc(m * sizeof(double));
+    double *xs_serie = malloc(m * sizeof(double)), *ys_serie = malloc(m * sizeof(double));
+    PoolHilos *pool = crearPoolHilos(4);
+    double paso = (x[n - 1] - x[0]) / (m - 1);
+    remuestrearSplineEquiespaciado(&S, x[0], paso, m, xs, ys, pool);
+    remuestrearSplineEquiespaciado(&S, x[0], paso, m, xs_serie, ys_serie, NULL);
+    int iguales = 1;
+    for (int i = 0; i < m; i++)
+        if (xs[i] != xs_serie[i] || ys[i] != ys_serie[i] || ys[i] != evaluarSplineCubico(&S, xs[i])) iguales = 0;
+    verificar("Remuestreo en 4 hilos idéntico al secuencial", pool != NULL && iguales);
+
+    FILE *tabla = tmpfile(), *tabla_printf = tmpfile();
+    const double *columnas[3] = { NULL, xs, ys };
+    int decimales[3] = { 0, 4, 10 };
+    int escrito = tabla != NULL && tabla_printf != NULL &&
+                  escribirColumnasTexto(tabla, m, 3, columnas, decimales, '\t', pool) == 0;
+    int textos_iguales = escrito;
+    if (escrito) {
+        for (int i = 0; i < m; i++)
+            fprintf(tabla_printf, "%d\t%.4f\t%.10f\n", i, xs[i], ys[i]);
+        rewind(tabla);
+        rewind(tabla_printf);
+        int a, b;
+        do {
+            a = fgetc(tabla);
+            b = fgetc(tabla_printf);
+            if (a != b) textos_iguales = 0;
+        } while (a != EOF && b != EOF && textos_iguales);
+    }
+    verificar("escribirColumnasTexto escribe lo mismo que fprintf", textos_iguales);
+
+    if (tabla != NULL) fclose(tabla);
+    if (tabla_printf != NULL) fclose(tabla_printf);
+    destruirPoolHilos(pool);
+    liberarSplineCubico(&S);
+    free(xs); free(ys); free(xs_serie); free(ys_serie);
+}
+
+int main() {
+    printf("\n");
+    imprimir_linea();
+    printf("  SUITE DE PRUEBAS - SISTEMAS DE ECUACIONES LINEALES\n");
+    imprimir_linea();
+
+    test_matriz_densa();
+    test_metodos_directos();
+    test_metodos_iterativos();
+    test_factorizacion_lu();
+    test_jacobi_paralelo();
+    test_gauss_seidel_multicolor();
+    test_matriz_dispersa();
+    test_gradiente_conjugado();
+    test_gmres_bicgstab();
+    test_lectura_archivos();
+    test_sistemas_por_lotes();
+    test_matriz_banda();
+    test_precision_mixta();
+    test_diagnostico_convergencia();
+    test_espacio_trabajo();
+    test_cholesky();
+    test_condicion_lu();
+    test_jacobi_procesos();
+    test_lu_en_disco();
+    test_nucleos_simd();
+    test_tridiagonal_ciclico();
+    test_modo_lotes();
+    test_lagrange_baricentrico();
+    test_newton_diferencias();
+    test_spline_cubico();
+    test_frontera_spline();
+    test_remuestreo_spline();
+
+    printf("\n");
+    imprimir_linea();
+    printf("  RESUMEN DE PRUEBAS\n");
+    imprimir_linea();
+    if (pruebas_fallidas == 0)
+        printf("\n✓ Todas las pruebas pasaron\n\n");
+    else
+        printf("\n✗ %d prueba(s) fallaron\n\n", pruebas_fallidas);
+
+    return pruebas_fallidas == 0 ? 0 : 1;
+}